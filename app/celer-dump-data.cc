@@ -5,6 +5,7 @@
 //---------------------------------------------------------------------------//
 //! \file celer-dump-data.cc
 //---------------------------------------------------------------------------//
+#include <algorithm>
 #include <cstdlib>
 #include <iomanip>
 #include <iostream>
@@ -501,6 +502,41 @@ void print_regions(std::vector<ImportRegion> const& regions)
     cout << "\nCustomizations: FM = field manager, PC = production cuts, UL = "
             "user limits\n";
     cout << endl;
+
+    if (std::none_of(regions.begin(), regions.end(), [](ImportRegion const& r) {
+            return r.user_limits;
+        }))
+    {
+        return;
+    }
+
+    cout << R"gfm(
+## User limits
+
+| Region ID | Max step [len] | Max length [len] | Max time [time] | Min energy [MeV] | Min range [len] |
+| --------- | -------------- | ---------------- | --------------- | ---------------- | --------------- |
+)gfm";
+
+    for (auto region_id : range(regions.size()))
+    {
+        auto const& region = regions[region_id];
+        if (!region.user_limits)
+        {
+            continue;
+        }
+        auto const& ul = region.limits;
+
+        // clang-format off
+        cout << "| " << setw(9) << std::right << region_id
+             << " | " << setw(14) << setprecision(3) << ul.max_step
+             << " | " << setw(16) << setprecision(3) << ul.max_track_length
+             << " | " << setw(15) << setprecision(3) << ul.max_time
+             << " | " << setw(16) << setprecision(3) << ul.min_kinetic_energy
+             << " | " << setw(15) << setprecision(3) << ul.min_range
+             << " |\n";
+        // clang-format on
+    }
+    cout << endl;
 }
 
 //---------------------------------------------------------------------------//
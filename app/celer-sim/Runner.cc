@@ -43,6 +43,7 @@
 #include "celeritas/geo/GeoParams.hh"  // IWYU pragma: keep
 #include "celeritas/global/CoreParams.hh"
 #include "celeritas/global/alongstep/AlongStepGeneralLinearAction.hh"
+#include "celeritas/global/alongstep/AlongStepNeutralWoodcockAction.hh"
 #include "celeritas/global/alongstep/AlongStepUniformMscAction.hh"
 #include "celeritas/io/EventReader.hh"
 #include "celeritas/io/RootEventReader.hh"
@@ -51,7 +52,9 @@
 #include "celeritas/optical/MaterialParams.hh"
 #include "celeritas/optical/OpticalCollector.hh"
 #include "celeritas/optical/ScintillationParams.hh"
+#include "celeritas/optical/VisibilityLibrary.hh"
 #include "celeritas/phys/CutoffParams.hh"
+#include "celeritas/phys/PDGNumber.hh"
 #include "celeritas/phys/ParticleParams.hh"
 #include "celeritas/phys/PhysicsParams.hh"
 #include "celeritas/phys/Primary.hh"
@@ -60,11 +63,16 @@
 #include "celeritas/phys/Process.hh"
 #include "celeritas/phys/ProcessBuilder.hh"
 #include "celeritas/phys/RootEventSampler.hh"
+#include "celeritas/phys/WoodcockParams.hh"
 #include "celeritas/random/RngParams.hh"
+#include "celeritas/track/PermuteTracksAction.hh"
 #include "celeritas/track/SimParams.hh"
 #include "celeritas/track/TrackInitParams.hh"
+#include "celeritas/track/UserLimitsAction.hh"
+#include "celeritas/track/UserLimitsParams.hh"
 #include "celeritas/user/ActionDiagnostic.hh"
 #include "celeritas/user/RootStepWriter.hh"
+#include "celeritas/user/SamplingDiagnostic.hh"
 #include "celeritas/user/SimpleCalo.hh"
 #include "celeritas/user/SlotDiagnostic.hh"
 #include "celeritas/user/StepCollector.hh"
@@ -91,12 +99,17 @@ namespace
  * region at the corresponding nested level. The number of streams is set to
  * the first value in the list. If OMP_NUM_THREADS is not set, the value will
  * be implementation defined.
+ *
+ * Multiple streams are used when events are transported concurrently: either
+ * with event-level OpenMP parallelism or with task-based host scheduling.
  */
 size_type calc_num_streams(RunnerInput const& inp, size_type num_events)
 {
     size_type num_threads = 1;
-#if CELERITAS_OPENMP == CELERITAS_OPENMP_EVENT
-    if (!inp.merge_events)
+#ifdef _OPENMP
+    if (!inp.merge_events
+        && (CELERITAS_OPENMP == CELERITAS_OPENMP_EVENT
+            || inp.host_scheduling == HostScheduling::task))
     {
 #    pragma omp parallel
         {
@@ -187,7 +200,8 @@ void Runner::warm_up()
 /*!
  * Run on a single stream/thread, returning the transport result.
  *
- * This will partition the input primaries among all the streams.
+ * This will partition the input primaries among all the streams. Step
+ * interfaces are notified when the event is complete.
  */
 auto Runner::operator()(StreamId stream, EventId event) -> RunnerResult
 {
@@ -195,7 +209,12 @@ auto Runner::operator()(StreamId stream, EventId event) -> RunnerResult
     CELER_EXPECT(event < this->num_events());
 
     auto& transport = this->get_transporter(stream);
-    return transport(make_span(events_[event.get()]));
+    auto result = transport(make_span(events_[event.get()]));
+    if (step_collector_)
+    {
+        step_collector_->end_event(stream, event);
+    }
+    return result;
 }
 
 //---------------------------------------------------------------------------//
@@ -409,6 +428,33 @@ void Runner::build_core_params(RunnerInput const& inp,
         params.action_reg->insert(along_step);
     }
 
+    if (!inp.woodcock_volumes.empty())
+    {
+        // Create delta tracking action for photons in the given volumes
+        WoodcockParams::Input input;
+        input.particles = {params.particle->find(pdg::gamma())};
+        CELER_VALIDATE(input.particles.front(),
+                       << "cannot use Woodcock tracking without photons");
+        auto& volumes = input.regions.emplace_back();
+        for (Label const& label : inp.woodcock_volumes)
+        {
+            auto vol_id = params.geometry->volumes().find_exact(label);
+            CELER_VALIDATE(vol_id,
+                           << "no volume '" << label
+                           << "' exists for Woodcock tracking");
+            volumes.push_back(vol_id);
+        }
+        input.convex = {inp.woodcock_convex};
+        auto woodcock = std::make_shared<WoodcockParams>(*params.geomaterial,
+                                                         *params.material,
+                                                         *params.particle,
+                                                         *params.physics,
+                                                         input);
+        params.action_reg->insert(
+            std::make_shared<AlongStepNeutralWoodcockAction>(
+                params.action_reg->next_id(), std::move(woodcock)));
+    }
+
     // Construct RNG params
     params.rng = std::make_shared<RngParams>(inp.seed);
 
@@ -421,6 +467,8 @@ void Runner::build_core_params(RunnerInput const& inp,
 
     // Store the number of simultaneous threads/tasks per process
     params.max_streams = calc_num_streams(inp, num_events);
+    params.host_scheduling = inp.host_scheduling;
+    params.host_serial_threshold = inp.host_serial_threshold;
     CELER_VALIDATE(inp.mctruth_file.empty() || params.max_streams == 1,
                    << "cannot output MC truth with multiple "
                       "streams ("
@@ -439,6 +487,13 @@ void Runner::build_core_params(RunnerInput const& inp,
     }();
 
     core_params_ = std::make_shared<CoreParams>(std::move(params));
+
+    // Kill tracks that exceed Geant4 region user limits
+    if (auto limits
+        = UserLimitsParams::from_import(imported, *core_params_->geometry()))
+    {
+        UserLimitsAction::make_and_insert(*core_params_, std::move(limits));
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -555,6 +610,14 @@ void Runner::build_step_collectors(RunnerInput const& inp)
                                            *core_params_->geometry(),
                                            core_params_->max_streams());
 
+        if (!inp.simple_calo_event_prefix.empty())
+        {
+            CELER_VALIDATE(!inp.merge_events,
+                           << "per-event calorimeter output cannot be used "
+                              "with merged events");
+            simple_calo->set_event_output(inp.simple_calo_event_prefix);
+        }
+
         // Add to step interfaces
         step_interfaces.push_back(simple_calo);
         // Add to output interface
@@ -603,6 +666,11 @@ void Runner::build_optical_collector(RunnerInput const& inp,
     oc_inp.buffer_capacity = inp.optical.buffer_capacity;
     oc_inp.primary_capacity = inp.optical.primary_capacity;
     oc_inp.auto_flush = inp.optical.auto_flush;
+    oc_inp.bunch_size = inp.optical.bunch_size;
+    if (auto const& filename = inp.optical.visibility_file; !filename.empty())
+    {
+        oc_inp.visibility = optical::VisibilityLibrary::from_file(filename);
+    }
 
     CELER_ASSERT(oc_inp);
     optical_collector_
@@ -626,11 +694,25 @@ void Runner::build_diagnostics(RunnerInput const& inp)
                                         inp.step_diagnostic_bins);
     }
 
+    if (inp.sampling_diagnostic)
+    {
+        SamplingDiagnostic::make_and_insert(*core_params_,
+                                            inp.sampling_diagnostic_bins);
+    }
+
     if (!inp.slot_diagnostic_prefix.empty())
     {
         SlotDiagnostic::make_and_insert(*core_params_,
                                         inp.slot_diagnostic_prefix);
     }
+
+    if (inp.permute_interval > 0)
+    {
+        PermuteTracksAction::Input permute_inp;
+        permute_inp.interval = inp.permute_interval;
+        permute_inp.threshold = inp.permute_threshold;
+        PermuteTracksAction::make_and_insert(*core_params_, permute_inp);
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -57,11 +57,14 @@ struct RunnerInput
         size_type primary_capacity{};  //!< Maximum number of pending primaries
         size_type auto_flush{};  //!< Threshold number of primaries for
                                  //!< launching optical tracking loop
+        size_type bunch_size{1};  //!< Physical photons per optical track
+        std::string visibility_file;  //!< Library replacing the optical loop
 
         explicit operator bool() const
         {
-            return buffer_capacity > 0 && primary_capacity > 0
-                   && auto_flush > 0;
+            return buffer_capacity > 0 && bunch_size > 0
+                   && (!visibility_file.empty()
+                       || (primary_capacity > 0 && auto_flush > 0));
         };
     };
     static constexpr Real3 no_field() { return Real3{0, 0, 0}; }
@@ -89,9 +92,12 @@ struct RunnerInput
     std::string tracing_file;
     SimpleRootFilterInput mctruth_filter;
     std::vector<Label> simple_calo;
+    std::string simple_calo_event_prefix;  //!< Base name for per-event calo
     bool action_diagnostic{};
     bool step_diagnostic{};
     int step_diagnostic_bins{1000};
+    bool sampling_diagnostic{};  //!< Requires CELERITAS_SAMPLING_COUNTERS
+    int sampling_diagnostic_bins{16};
     std::string slot_diagnostic_prefix;  //!< Base name for slot diagnostic
     bool write_track_counts{true};  //!< Output track counts for each step
     bool write_step_times{true};  //!< Output elapsed times for each step
@@ -107,6 +113,9 @@ struct RunnerInput
     bool merge_events{false};  //!< Run all events at once on a single stream
     bool default_stream{false};  //!< Launch all kernels on the default stream
     bool warm_up{false};  //!< Run a nullop step first
+    //! Distribution of events and track slots among CPU threads
+    HostScheduling host_scheduling{default_host_scheduling()};
+    size_type host_serial_threshold{256};  //!< Active tracks for threading
 
     // Magnetic field vector [* 1/Tesla] and associated field options
     Real3 field{no_field()};
@@ -119,8 +128,15 @@ struct RunnerInput
     // Options for physics
     bool brem_combined{false};
 
+    // Volumes in which photons use Woodcock (delta) tracking
+    std::vector<Label> woodcock_volumes;
+    // Whether the Woodcock volumes together form a convex shape
+    bool woodcock_convex{false};
+
     // Track reordering options
     TrackOrder track_order{TrackOrder::none};
+    size_type permute_interval{};  //!< Steps between permutations (0 off)
+    real_type permute_threshold{0.25};  //!< Out-of-order fraction to permute
 
     // Optional setup options if loading directly from Geant4
     GeantPhysicsOptions physics_options;
@@ -136,6 +152,7 @@ struct RunnerInput
                && num_track_slots > 0 && max_steps > 0
                && initializer_capacity > 0 && secondary_stack_factor > 0
                && (step_diagnostic_bins > 0 || !step_diagnostic)
+               && (sampling_diagnostic_bins > 1 || !sampling_diagnostic)
                && (field == no_field() || field_options);
     }
 };
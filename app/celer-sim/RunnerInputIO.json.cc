@@ -73,9 +73,12 @@ void from_json(nlohmann::json const& j, RunnerInput& v)
     LDIO_LOAD_OPTION(tracing_file);
     LDIO_LOAD_OPTION(mctruth_filter);
     LDIO_LOAD_OPTION(simple_calo);
+    LDIO_LOAD_OPTION(simple_calo_event_prefix);
     LDIO_LOAD_OPTION(action_diagnostic);
     LDIO_LOAD_OPTION(step_diagnostic);
     LDIO_LOAD_OPTION(step_diagnostic_bins);
+    LDIO_LOAD_OPTION(sampling_diagnostic);
+    LDIO_LOAD_OPTION(sampling_diagnostic_bins);
     LDIO_LOAD_OPTION(slot_diagnostic_prefix);
     LDIO_LOAD_OPTION(write_track_counts);
     LDIO_LOAD_OPTION(write_step_times);
@@ -101,6 +104,9 @@ void from_json(nlohmann::json const& j, RunnerInput& v)
         v.warm_up = true;
     }
 
+    LDIO_LOAD_OPTION(host_scheduling);
+    LDIO_LOAD_OPTION(host_serial_threshold);
+
     LDIO_LOAD_DEPRECATED(mag_field, field);
 
     LDIO_LOAD_OPTION(field);
@@ -110,6 +116,8 @@ void from_json(nlohmann::json const& j, RunnerInput& v)
 
     LDIO_LOAD_OPTION(step_limiter);
     LDIO_LOAD_OPTION(brem_combined);
+    LDIO_LOAD_OPTION(woodcock_volumes);
+    LDIO_LOAD_OPTION(woodcock_convex);
     if (auto iter = j.find("track_order"); iter != j.end())
     {
         iter->get_to(v.track_order);
@@ -118,6 +126,8 @@ void from_json(nlohmann::json const& j, RunnerInput& v)
     {
         v.track_order = TrackOrder::init_charge;
     }
+    LDIO_LOAD_OPTION(permute_interval);
+    LDIO_LOAD_OPTION(permute_threshold);
     LDIO_LOAD_OPTION(physics_options);
 
     LDIO_LOAD_OPTION(optical);
@@ -171,9 +181,12 @@ void to_json(nlohmann::json& j, RunnerInput const& v)
     LDIO_SAVE_WHEN(tracing_file, CELERITAS_USE_PERFETTO);
     LDIO_SAVE_WHEN(mctruth_filter, !v.mctruth_file.empty());
     LDIO_SAVE(simple_calo);
+    LDIO_SAVE(simple_calo_event_prefix);
     LDIO_SAVE(action_diagnostic);
     LDIO_SAVE(step_diagnostic);
     LDIO_SAVE_OPTION(step_diagnostic_bins);
+    LDIO_SAVE(sampling_diagnostic);
+    LDIO_SAVE_OPTION(sampling_diagnostic_bins);
     LDIO_SAVE_OPTION(slot_diagnostic_prefix);
     LDIO_SAVE(write_track_counts);
     LDIO_SAVE(write_step_times);
@@ -188,14 +201,20 @@ void to_json(nlohmann::json& j, RunnerInput const& v)
     LDIO_SAVE(merge_events);
     LDIO_SAVE(default_stream);
     LDIO_SAVE(warm_up);
+    LDIO_SAVE(host_scheduling);
+    LDIO_SAVE(host_serial_threshold);
 
     LDIO_SAVE_OPTION(field);
     LDIO_SAVE_WHEN(field_options, v.field != RunnerInput::no_field());
 
     LDIO_SAVE_OPTION(step_limiter);
     LDIO_SAVE(brem_combined);
+    LDIO_SAVE_OPTION(woodcock_volumes);
+    LDIO_SAVE_WHEN(woodcock_convex, !v.woodcock_volumes.empty());
 
     LDIO_SAVE(track_order);
+    LDIO_SAVE_OPTION(permute_interval);
+    LDIO_SAVE_WHEN(permute_threshold, v.permute_interval > 0);
     LDIO_SAVE_WHEN(physics_options,
                    v.physics_file.empty()
                        || !ends_with(v.physics_file, ".root"));
@@ -226,8 +245,10 @@ void to_json(nlohmann::json& j, app::RunnerInput::EventFileSampling const& efs)
 void from_json(nlohmann::json const& j, app::RunnerInput::OpticalOptions& oo)
 {
     CELER_JSON_LOAD_REQUIRED(j, oo, buffer_capacity);
-    CELER_JSON_LOAD_REQUIRED(j, oo, primary_capacity);
-    CELER_JSON_LOAD_REQUIRED(j, oo, auto_flush);
+    CELER_JSON_LOAD_OPTION(j, oo, primary_capacity);
+    CELER_JSON_LOAD_OPTION(j, oo, auto_flush);
+    CELER_JSON_LOAD_OPTION(j, oo, bunch_size);
+    CELER_JSON_LOAD_OPTION(j, oo, visibility_file);
 }
 
 void to_json(nlohmann::json& j, app::RunnerInput::OpticalOptions const& oo)
@@ -236,7 +257,12 @@ void to_json(nlohmann::json& j, app::RunnerInput::OpticalOptions const& oo)
         CELER_JSON_PAIR(oo, buffer_capacity),
         CELER_JSON_PAIR(oo, primary_capacity),
         CELER_JSON_PAIR(oo, auto_flush),
+        CELER_JSON_PAIR(oo, bunch_size),
     };
+    if (!oo.visibility_file.empty())
+    {
+        j["visibility_file"] = oo.visibility_file;
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,349 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+# Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+# See the top-level COPYRIGHT file for details.
+# SPDX-License-Identifier: (Apache-2.0 OR MIT)
+"""
+Run a fixed matrix of celer-sim problems on the host and compare to a baseline.
+
+Each problem is run for every combination of thread count and track slot
+count, repeated to estimate run-to-run noise. Per-action times, total
+transport time, steps per second, and peak resident memory are written to a
+JSON file. If a baseline file from a previous run is given, each metric is
+compared with a Welch t-test and the script fails if any metric is
+significantly worse by more than the relative threshold.
+
+Environment variables (set by the ``celer-bench`` CMake target):
+
+``CELERITAS_EXE``
+    Path to the celer-sim executable
+``CELER_SOURCE_DIR``
+    Path to the Celeritas source directory (for geometry and physics files)
+``CELER_CORE_GEO``
+    Core geometry (``ORANGE-JSON`` if GDML cannot be loaded)
+``CELER_USE_GEANT4``, ``CELER_USE_ROOT``
+    Whether physics can be loaded from GDML or from exported ROOT files
+``CELER_BENCH_BASELINE``
+    Default baseline file for comparison
+"""
+import json
+import math
+import os
+import re
+import subprocess
+from argparse import ArgumentParser
+from itertools import product
+from os import environ, path
+from statistics import mean, stdev
+from sys import exit, stderr
+
+# Problem definitions: geometry, optional exported physics, and primaries.
+# Paths are relative to the source directory.
+PROBLEMS = {
+    "testem3": {
+        "geometry": "test/geocel/data/testem3-flat.gdml",
+        "physics": None,
+        "primary_options": {
+            "pdg": [11],
+            "num_events": 4,
+            "primaries_per_event": 8,
+            "energy": 1000.0,
+            "position": [-22, 0, 0],
+            "direction": [1, 0, 0],
+        },
+    },
+    "simple-cms": {
+        "geometry": "app/data/simple-cms.gdml",
+        "physics": "test/celeritas/data/simple-cms.root",
+        "primary_options": {
+            "pdg": [22],
+            "num_events": 4,
+            "primaries_per_event": 8,
+            "energy": 1000.0,
+            "position": [0, 0, 0],
+            "direction": {"distribution": "isotropic", "params": []},
+        },
+    },
+    "lar-sphere": {
+        "geometry": "test/geocel/data/lar-sphere.gdml",
+        "physics": "test/celeritas/data/lar-sphere.root",
+        "primary_options": {
+            "pdg": [11],
+            "num_events": 4,
+            "primaries_per_event": 8,
+            "energy": 100.0,
+            "position": [0, 0, 0],
+            "direction": {"distribution": "isotropic", "params": []},
+        },
+    },
+    "four-steel-slabs": {
+        "geometry": "test/geocel/data/four-steel-slabs.gdml",
+        "physics": "test/celeritas/data/four-steel-slabs.root",
+        "primary_options": {
+            "pdg": [11],
+            "num_events": 4,
+            "primaries_per_event": 8,
+            "energy": 1000.0,
+            "position": [0, 0, 0],
+            "direction": {"distribution": "isotropic", "params": []},
+        },
+    },
+}
+
+DEFAULT_THREADS = [1, 4]
+DEFAULT_TRACK_SLOTS = [1024, 8192]
+
+
+def strtobool(text):
+    text = text.lower()
+    if text in {"true", "on", "yes", "1"}:
+        return True
+    if text in {"false", "off", "no", "0", ""}:
+        return False
+    raise ValueError(text)
+
+
+def int_list(text):
+    return [int(v) for v in text.split(",")]
+
+
+def config_key(problem, threads, slots):
+    return f"{problem}/t{threads}/s{slots}"
+
+
+def build_input(problem, slots, source_dir, seed):
+    """Construct celer-sim input, returning None if the problem can't run."""
+    use_geant4 = strtobool(environ.get("CELER_USE_GEANT4", "false"))
+    use_root = strtobool(environ.get("CELER_USE_ROOT", "false"))
+    core_geo = environ.get("CELER_CORE_GEO", "ORANGE").lower()
+
+    geometry_filename = path.join(source_dir, problem["geometry"])
+    if core_geo == "orange-json" or (core_geo == "orange" and not use_geant4):
+        geometry_filename = re.sub(r"\.gdml$", ".org.json", geometry_filename)
+    if not path.exists(geometry_filename):
+        return None
+
+    if use_geant4:
+        # Load physics directly from Geant4
+        physics_filename = path.join(source_dir, problem["geometry"])
+    elif use_root and problem["physics"]:
+        physics_filename = path.join(source_dir, problem["physics"])
+    else:
+        return None
+
+    primary_options = dict(problem["primary_options"], seed=seed)
+    return {
+        "use_device": False,
+        "geometry_file": geometry_filename,
+        "physics_file": physics_filename,
+        "primary_options": primary_options,
+        "seed": seed,
+        "num_track_slots": slots,
+        "initializer_capacity": 8 * slots,
+        "secondary_stack_factor": 3,
+        "action_times": True,
+        "write_track_counts": False,
+        "write_step_times": False,
+        "merge_events": False,
+        "brem_combined": True,
+        "field": None,
+    }
+
+
+def run_once(exe, inp, threads, basename):
+    """Run celer-sim and return the runner output and peak memory [KiB]."""
+    inp_filename = basename + ".inp.json"
+    out_filename = basename + ".out.json"
+    with open(inp_filename, "w") as f:
+        json.dump(inp, f, indent=1)
+
+    env = dict(environ,
+               OMP_NUM_THREADS=str(threads),
+               CELER_DISABLE_DEVICE="1",
+               CELER_LOG="warning")
+    with open(out_filename, "w") as outf:
+        proc = subprocess.Popen([exe, inp_filename], stdout=outf, env=env)
+        # Wait directly to obtain resource usage for this child only
+        (_, status, rusage) = os.wait4(proc.pid, 0)
+        proc.returncode = (os.WEXITSTATUS(status) if os.WIFEXITED(status)
+                           else -os.WTERMSIG(status))
+    if proc.returncode:
+        print(f"fatal: {exe} {inp_filename} failed with error "
+              f"{proc.returncode}: see {out_filename}", file=stderr)
+        exit(proc.returncode)
+
+    with open(out_filename) as f:
+        result = json.load(f)["result"]["runner"]
+    return (result, rusage.ru_maxrss)
+
+
+def summarize(result, max_rss):
+    """Extract benchmark metrics from a single celer-sim run."""
+    time = result["time"]
+    num_steps = sum(result["num_steps"])
+    return {
+        "num_steps": num_steps,
+        "steps_per_sec": num_steps / time["total"],
+        "total_time": time["total"],
+        "setup_time": time["setup"],
+        "peak_rss": max_rss,
+        "actions": time["actions"],
+    }
+
+
+def run_matrix(args):
+    exe = environ.get("CELERITAS_EXE", "./celer-sim")
+    source_dir = environ.get("CELER_SOURCE_DIR",
+                             path.join(path.dirname(__file__), "..", ".."))
+    problems = args.problems or list(PROBLEMS)
+
+    results = {}
+    skipped = []
+    for (name, threads, slots) in product(problems, args.threads, args.slots):
+        key = config_key(name, threads, slots)
+        inp = build_input(PROBLEMS[name], slots, source_dir, args.seed)
+        if inp is None:
+            skipped.append(key)
+            continue
+
+        runs = []
+        for i in range(args.repeat):
+            print(f"Running {key} ({i + 1}/{args.repeat})", file=stderr)
+            basename = f"bench-{name}-t{threads}-s{slots}-{i}"
+            runs.append(summarize(*run_once(exe, inp, threads, basename)))
+
+        num_steps = {r["num_steps"] for r in runs}
+        if len(num_steps) != 1:
+            print(f"warning: {key} is not reproducible: step counts are "
+                  f"{sorted(num_steps)}", file=stderr)
+
+        results[key] = {
+            "problem": name,
+            "num_threads": threads,
+            "num_track_slots": slots,
+            "num_steps": runs[0]["num_steps"],
+            "steps_per_sec": [r["steps_per_sec"] for r in runs],
+            "total_time": [r["total_time"] for r in runs],
+            "setup_time": [r["setup_time"] for r in runs],
+            "peak_rss": [r["peak_rss"] for r in runs],
+            "actions": {
+                label: [r["actions"].get(label, 0.0) for r in runs]
+                for label in runs[0]["actions"]
+            },
+        }
+
+    if skipped:
+        print("Skipped (missing geometry or physics support):",
+              ", ".join(skipped), file=stderr)
+
+    return {
+        "_units": {
+            "steps_per_sec": "1/s",
+            "total_time": "s",
+            "setup_time": "s",
+            "peak_rss": "KiB",
+            "actions": "s",
+        },
+        "repeat": args.repeat,
+        "results": results,
+        "skipped": skipped,
+    }
+
+
+def compare_samples(base, new, higher_is_better, threshold, t_crit):
+    """Return a message if the new samples are a significant regression."""
+    (mb, mn) = (mean(base), mean(new))
+    if mb <= 0:
+        return None
+    rel = (mn - mb) / mb
+    if higher_is_better:
+        rel = -rel
+    if rel <= threshold:
+        return None
+
+    if len(base) > 1 and len(new) > 1:
+        # Welch's t-test
+        err = math.sqrt(stdev(base) ** 2 / len(base)
+                        + stdev(new) ** 2 / len(new))
+        if err > 0 and abs(mn - mb) / err < t_crit:
+            return None
+    return f"{mb:.4g} -> {mn:.4g} ({100 * rel:+.1f}% worse)"
+
+
+def compare(baseline, current, threshold, t_crit):
+    """Compare two benchmark results, returning a list of regressions."""
+    regressions = []
+
+    def check(key, metric, base, new, higher_is_better=False):
+        msg = compare_samples(base, new, higher_is_better, threshold, t_crit)
+        if msg:
+            regressions.append(f"{key} {metric}: {msg}")
+
+    for (key, new) in current["results"].items():
+        base = baseline["results"].get(key)
+        if base is None:
+            print(f"warning: no baseline for {key}", file=stderr)
+            continue
+        if base["num_steps"] != new["num_steps"]:
+            print(f"warning: {key} step count changed from "
+                  f"{base['num_steps']} to {new['num_steps']}", file=stderr)
+        check(key, "steps_per_sec", base["steps_per_sec"],
+              new["steps_per_sec"], higher_is_better=True)
+        check(key, "total_time", base["total_time"], new["total_time"])
+        check(key, "peak_rss", base["peak_rss"], new["peak_rss"])
+        for (label, samples) in new["actions"].items():
+            if label in base["actions"]:
+                check(key, f"actions/{label}", base["actions"][label],
+                      samples)
+    return regressions
+
+
+def main():
+    parser = ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("-o", "--output", default="celer-bench.json",
+                        help="output JSON file")
+    parser.add_argument("--baseline",
+                        default=environ.get("CELER_BENCH_BASELINE"),
+                        help="previous output to compare against")
+    parser.add_argument("--problems", nargs="+", choices=list(PROBLEMS),
+                        help="subset of problems to run")
+    parser.add_argument("--threads", type=int_list, default=DEFAULT_THREADS,
+                        help="comma-separated OpenMP thread counts")
+    parser.add_argument("--slots", type=int_list,
+                        default=DEFAULT_TRACK_SLOTS,
+                        help="comma-separated track slot counts")
+    parser.add_argument("--repeat", type=int, default=3,
+                        help="number of runs per configuration")
+    parser.add_argument("--seed", type=int, default=12345)
+    parser.add_argument("--threshold", type=float, default=0.05,
+                        help="relative change that counts as a regression")
+    parser.add_argument("--t-crit", type=float, default=3.0,
+                        help="t statistic needed for significance")
+    parser.add_argument("--compare-only", action="store_true",
+                        help="compare an existing output to the baseline")
+    args = parser.parse_args()
+
+    if args.compare_only:
+        with open(args.output) as f:
+            current = json.load(f)
+    else:
+        current = run_matrix(args)
+        with open(args.output, "w") as f:
+            json.dump(current, f, indent=1)
+        print("Results written to", args.output, file=stderr)
+
+    if not args.baseline:
+        return
+    with open(args.baseline) as f:
+        baseline = json.load(f)
+    regressions = compare(baseline, current, args.threshold, args.t_crit)
+    if regressions:
+        print(f"{len(regressions)} regression(s) against {args.baseline}:")
+        for r in regressions:
+            print("  " + r)
+        exit(1)
+    print(f"No regressions against {args.baseline}")
+
+
+if __name__ == "__main__":
+    main()
@@ -11,6 +11,7 @@
 #include <initializer_list>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <string_view>
 #include <type_traits>
 #include <utility>
@@ -25,6 +26,7 @@
 #include "corecel/Config.hh"
 #include "corecel/DeviceRuntimeApi.hh"
 #include "corecel/Version.hh"
+#include "corecel/cont/Range.hh"
 
 #include "corecel/io/BuildOutput.hh"
 #include "corecel/io/ExceptionOutput.hh"
@@ -122,17 +124,60 @@ void run(std::istream* is, std::shared_ptr<OutputRegistry> output)
         CELER_LOG(status) << "Transporting " << run_stream.num_events()
                           << " on " << num_streams << " threads";
         MultiExceptionHandler capture_exception;
-#if CELERITAS_OPENMP == CELERITAS_OPENMP_EVENT
-#    pragma omp parallel for
-#endif
-        for (size_type event = 0; event < run_stream.num_events(); ++event)
-        {
+        auto run_event = [&](StreamId stream, size_type event) {
             activate_device_local();
 
             // Run a single event on a single thread
-            CELER_TRY_HANDLE(result.events[event] = run_stream(
-                                 StreamId(get_openmp_thread()), EventId(event)),
-                             capture_exception);
+            CELER_TRY_HANDLE(
+                result.events[event] = run_stream(stream, EventId(event)),
+                capture_exception);
+        };
+        if (run_input->host_scheduling == HostScheduling::task)
+        {
+            // Run events as tasks: threads that finish their events steal
+            // chunks of track slots from the other streams. Any thread may
+            // pick up an event, so streams are assigned from a shared pool.
+            std::vector<StreamId> idle_streams;
+            for (auto s : range(num_streams))
+            {
+                idle_streams.push_back(StreamId(num_streams - 1 - s));
+            }
+            std::mutex stream_mutex;
+            auto run_event_task = [&](size_type event) {
+                StreamId stream;
+                {
+                    std::lock_guard<std::mutex> lock(stream_mutex);
+                    CELER_ASSERT(!idle_streams.empty());
+                    stream = idle_streams.back();
+                    idle_streams.pop_back();
+                }
+                run_event(stream, event);
+                std::lock_guard<std::mutex> lock(stream_mutex);
+                idle_streams.push_back(stream);
+            };
+#ifdef _OPENMP
+#    pragma omp parallel
+#    pragma omp single
+#endif
+            for (size_type event = 0; event < run_stream.num_events();
+                 ++event)
+            {
+#ifdef _OPENMP
+#    pragma omp task
+#endif
+                run_event_task(event);
+            }
+        }
+        else
+        {
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_EVENT
+#    pragma omp parallel for
+#endif
+            for (size_type event = 0; event < run_stream.num_events();
+                 ++event)
+            {
+                run_event(StreamId(get_openmp_thread()), event);
+            }
         }
         log_and_rethrow(std::move(capture_exception));
     }
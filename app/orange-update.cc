@@ -4,7 +4,7 @@
 // SPDX-License-Identifier: (Apache-2.0 OR MIT)
 //---------------------------------------------------------------------------//
 //! \file orange-update.cc
-//! \brief Read in and write back an ORANGE JSON file
+//! \brief Read in and write back an ORANGE JSON or binary file
 //---------------------------------------------------------------------------//
 #include <cstdlib>
 #include <fstream>
@@ -17,7 +17,9 @@
 
 #include "corecel/Assert.hh"
 #include "corecel/io/Logger.hh"
+#include "corecel/io/StringUtils.hh"
 #include "corecel/sys/ScopedMpiInit.hh"
+#include "orange/OrangeBinaryIO.hh"
 #include "orange/OrangeInputIO.json.hh"
 
 namespace celeritas
@@ -30,16 +32,40 @@ namespace
 void print_usage(char const* exec_name)
 {
     std::cerr << "usage: " << exec_name
-              << " {input}.org.json {output}.org.json\n";
+              << " {input}.org.{json,bin} {output}.org.{json,bin}\n";
 }
 
 //---------------------------------------------------------------------------//
-std::string run(std::istream* is)
+//! Whether a filename uses the binary format
+bool is_binary(std::string const& filename)
 {
+    return ends_with(filename, ".bin");
+}
+
+//---------------------------------------------------------------------------//
+OrangeInput read_input(std::istream* is, bool binary)
+{
+    if (binary)
+    {
+        return read_binary(*is);
+    }
+
     OrangeInput inp;
     nlohmann::json::parse(*is).get_to(inp);
+    return inp;
+}
 
-    return nlohmann::json(inp).dump(/* indent = */ 0);
+//---------------------------------------------------------------------------//
+void write_output(std::ostream* os, OrangeInput const& inp, bool binary)
+{
+    if (binary)
+    {
+        write_binary(*os, inp);
+    }
+    else
+    {
+        *os << nlohmann::json(inp).dump(/* indent = */ 0);
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -86,7 +112,7 @@ int main(int argc, char* argv[])
     else
     {
         // Open the specified file
-        infile.open(args[0]);
+        infile.open(args[0], std::ios::in | std::ios::binary);
         if (!infile)
         {
             CELER_LOG(critical) << "Failed to open '" << args[0] << "'";
@@ -95,10 +121,10 @@ int main(int argc, char* argv[])
         instream = &infile;
     }
 
-    std::string result;
+    OrangeInput inp;
     try
     {
-        result = celeritas::app::run(instream);
+        inp = read_input(instream, is_binary(args[0]));
     }
     catch (RuntimeError const& e)
     {
@@ -111,21 +137,34 @@ int main(int argc, char* argv[])
         return EXIT_FAILURE;
     }
 
+    // Open output only after reading so that the files can be the same
+    std::ofstream outfile;
+    std::ostream* outstream = nullptr;
     if (args[1] == "-")
     {
-        std::cout << result;
+        outstream = &std::cout;
     }
     else
     {
         // Open the specified file
-        std::ofstream outfile{args[1]};
+        outfile.open(args[1], std::ios::out | std::ios::binary);
         if (!outfile)
         {
             CELER_LOG(critical)
                 << "Failed to open '" << args[1] << "' for writing";
             return EXIT_FAILURE;
         }
-        outfile << result;
+        outstream = &outfile;
+    }
+
+    try
+    {
+        write_output(outstream, inp, is_binary(args[1]));
+    }
+    catch (RuntimeError const& e)
+    {
+        CELER_LOG(critical) << "Runtime error: " << e.what();
+        return EXIT_FAILURE;
     }
 
     return EXIT_SUCCESS;
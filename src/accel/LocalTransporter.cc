@@ -37,6 +37,7 @@
 #include "celeritas/io/RootEventWriter.hh"
 #include "celeritas/phys/PDGNumber.hh"
 #include "celeritas/phys/ParticleParams.hh"  // IWYU pragma: keep
+#include "celeritas/user/StepCollector.hh"
 
 #include "SetupOptions.hh"
 #include "SharedParams.hh"
@@ -149,7 +150,9 @@ LocalTransporter::LocalTransporter(SetupOptions const& options,
     if (auto const& hit_manager = params.hit_manager())
     {
         hit_processor_ = hit_manager->make_local_processor(stream_id);
+        step_collector_ = params.step_collector();
     }
+    stream_id_ = stream_id;
 
     // Create stepper
     StepperInput inp;
@@ -169,6 +172,9 @@ LocalTransporter::LocalTransporter(SetupOptions const& options,
 
     // Save state for reductions at the end
     params.set_state(stream_id.get(), step_->sp_state());
+
+    // Allocate space for offloaded tracks up front
+    buffer_.reserve(auto_flush_);
 }
 
 //---------------------------------------------------------------------------//
@@ -200,18 +206,14 @@ void LocalTransporter::Push(G4Track const& g4track)
 {
     CELER_EXPECT(*this);
 
-    Primary track;
+    G4ParticleDefinition const& pd = *g4track.GetDefinition();
+    ParticleId const particle_id = this->find_particle(pd);
 
-    PDGNumber const pdg{g4track.GetDefinition()->GetPDGEncoding()};
-    track.particle_id = particles_->find(pdg);
+    // Convert in place in the preallocated buffer
+    Primary& track = buffer_.emplace_back();
+    track.particle_id = particle_id;
     track.energy = units::MevEnergy(
         convert_from_geant(g4track.GetKineticEnergy(), CLHEP::MeV));
-
-    CELER_VALIDATE(track.particle_id,
-                   << "cannot offload '"
-                   << g4track.GetDefinition()->GetParticleName()
-                   << "' particles");
-
     track.position = convert_from_geant(g4track.GetPosition(), clhep_length);
     track.direction = convert_from_geant(g4track.GetMomentumDirection(), 1);
     track.time = convert_from_geant(g4track.GetGlobalTime(), clhep_time);
@@ -219,7 +221,7 @@ void LocalTransporter::Push(G4Track const& g4track)
     if (CELER_UNLIKELY(g4track.GetWeight() != 1.0))
     {
         //! \todo Non-unit weights: see issue #1268
-        CELER_LOG(error) << "incoming track (PDG " << pdg.get()
+        CELER_LOG(error) << "incoming track (PDG " << pd.GetPDGEncoding()
                          << ", track ID " << g4track.GetTrackID()
                          << ") has non-unit weight " << g4track.GetWeight();
     }
@@ -229,24 +231,46 @@ void LocalTransporter::Push(G4Track const& g4track)
      */
     track.event_id = EventId{0};
 
-    buffer_.push_back(track);
     if (buffer_.size() >= auto_flush_)
     {
         /*!
          * \todo Maybe only run one iteration? But then make sure that Flush
          * still transports active tracks to completion.
          */
-        this->Flush();
+        this->transport_buffer();
     }
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Transport the buffered tracks and all secondaries produced.
+ * Transport all buffered tracks to completion and end the event.
+ *
+ * This should be called once at the end of each event. After the remaining
+ * tracks are transported, the step interfaces (e.g., sensitive detectors
+ * processed by the hit manager) are notified that the event on this stream is
+ * complete so that they can reduce and reset their per-event data. Tracks
+ * flushed automatically when the buffer fills do not end the event.
  */
 void LocalTransporter::Flush()
 {
     CELER_EXPECT(*this);
+
+    this->transport_buffer();
+
+    if (step_collector_ && event_id_)
+    {
+        step_collector_->end_event(
+            stream_id_,
+            EventId{static_cast<EventId::size_type>(event_id_.get())});
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Transport the buffered tracks and all secondaries produced.
+ */
+void LocalTransporter::transport_buffer()
+{
     if (buffer_.empty())
     {
         return;
@@ -316,6 +340,32 @@ void LocalTransporter::Finalize()
     CELER_ENSURE(!*this);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Find the Celeritas particle ID for an offloaded particle type.
+ *
+ * Offloaded tracks are nearly always one of a handful of particle types, so a
+ * linear search over the Geant4 definitions seen by this thread is faster
+ * than hashing the PDG number for every track.
+ */
+ParticleId LocalTransporter::find_particle(G4ParticleDefinition const& pd)
+{
+    for (auto const& [def, particle_id] : particle_cache_)
+    {
+        if (def == &pd)
+        {
+            return particle_id;
+        }
+    }
+
+    ParticleId result = particles_->find(PDGNumber{pd.GetPDGEncoding()});
+    CELER_VALIDATE(result,
+                   << "cannot offload '" << pd.GetParticleName()
+                   << "' particles");
+    particle_cache_.emplace_back(&pd, result);
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Get the accumulated action times.
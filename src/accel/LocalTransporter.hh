@@ -10,6 +10,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "corecel/Types.hh"
@@ -19,6 +20,7 @@
 #include "celeritas/global/Stepper.hh"
 #include "celeritas/phys/Primary.hh"
 
+class G4ParticleDefinition;
 class G4Track;
 
 namespace celeritas
@@ -32,6 +34,7 @@ class OffloadWriter;
 
 struct SetupOptions;
 class SharedParams;
+class StepCollector;
 
 //---------------------------------------------------------------------------//
 /*!
@@ -76,7 +79,7 @@ class LocalTransporter
     // Offload this track
     void Push(G4Track const&);
 
-    // Transport all buffered tracks to completion
+    // Transport all buffered tracks to completion and end the event
     void Flush();
 
     // Clear local data and return to an invalid state
@@ -93,12 +96,17 @@ class LocalTransporter
 
   private:
     using SPOffloadWriter = std::shared_ptr<detail::OffloadWriter>;
+    using ParticleCacheEntry
+        = std::pair<G4ParticleDefinition const*, ParticleId>;
 
     std::shared_ptr<ParticleParams const> particles_;
+    std::vector<ParticleCacheEntry> particle_cache_;
     std::shared_ptr<StepperInterface> step_;
     std::vector<Primary> buffer_;
     std::shared_ptr<detail::HitProcessor> hit_processor_;
+    std::shared_ptr<StepCollector const> step_collector_;
 
+    StreamId stream_id_;
     UniqueEventId event_id_;
 
     size_type auto_flush_{};
@@ -106,6 +114,12 @@ class LocalTransporter
 
     // Shared across threads to write flushed particles
     SPOffloadWriter dump_primaries_;
+
+    // Find the Celeritas particle ID for an offloaded particle type
+    ParticleId find_particle(G4ParticleDefinition const&);
+
+    // Transport the buffered tracks and all secondaries produced
+    void transport_buffer();
 };
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,73 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/SDBatchInterface.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Types.hh"
+#include "corecel/cont/Span.hh"
+
+namespace celeritas
+{
+struct DetectorStepOutput;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Opt-in interface for sensitive detectors to process hits in bulk.
+ *
+ * A \c G4VSensitiveDetector that also inherits from this class receives all
+ * of its hits from a batch of Celeritas detector steps in a single call,
+ * rather than one reconstructed \c G4Step per hit. This skips the per-hit
+ * step point updates, touchable navigation, and virtual \c Hit calls.
+ *
+ * The detector steps are the raw Celeritas output for all detectors, in
+ * native Celeritas units, with only the attributes requested by \c
+ * SDSetupOptions filled. The \c hits argument lists the indices of the steps
+ * belonging to this detector, in the order they were recorded.
+ *
+ * Hits are not sent to a detector that is inactive (e.g., through \c
+ * /hits/inactivate). Unlike \c G4VSensitiveDetector::Hit , the batch path
+ * does \em not apply the detector's \c G4VSDFilter : the detector must
+ * select hits itself, using the particle and energy data in the steps.
+ *
+ * \code
+   class CaloSD final : public G4VSensitiveDetector,
+                        public celeritas::SDBatchInterface
+   {
+     public:
+       void ProcessHitBatch(DetectorStepOutput const& steps,
+                            SpanConstIndex hits) final
+       {
+           for (auto i : hits)
+           {
+               edep_ += steps.energy_deposition[i].value();
+           }
+       }
+       ...
+   };
+ * \endcode
+ */
+class SDBatchInterface
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SpanConstIndex = Span<size_type const>;
+    //!@}
+
+  public:
+    // Process the hits for this detector from a batch of steps
+    virtual void
+    ProcessHitBatch(DetectorStepOutput const& steps, SpanConstIndex hits)
+        = 0;
+
+  protected:
+    // Protected destructor prevents direct deletion of pointer-to-interface
+    ~SDBatchInterface() = default;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -41,6 +41,9 @@ struct AlongStepFactoryInput;
  *   when the combination of options is enabled
  * - Track and Parent IDs will \em never be a valid value since Celeritas track
  *   counters are independent from Geant4 track counters.
+ * - Sensitive detectors that implement \c SDBatchInterface bypass the
+ *   reconstructed \c G4Step entirely and receive the selected step data
+ *   directly.
  */
 struct SDSetupOptions
 {
@@ -115,6 +118,8 @@ struct SetupOptions
     std::string offload_output_file;
     //! Filename to dump a GDML file for debugging inside frameworks
     std::string geometry_output_file;
+    //! Existing directory for reusing imported physics and geometry
+    std::string cache_directory;
     //!@}
 
     //!@{
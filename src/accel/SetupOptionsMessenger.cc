@@ -178,6 +178,9 @@ SetupOptionsMessenger::SetupOptionsMessenger(SetupOptions* options)
     add_cmd(&options->geometry_output_file,
             "geometryOutputFile",
             "Filename for GDML export");
+    add_cmd(&options->cache_directory,
+            "cacheDirectory",
+            "Directory for reusing imported physics and geometry");
     add_cmd(&options->max_num_tracks,
             "maxNumTracks",
             "Number of track \"slots\" to be transported simultaneously");
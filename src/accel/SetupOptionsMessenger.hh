@@ -29,6 +29,7 @@ struct SetupOptions;
   physicsOutputFile    | Filename for ROOT dump of physics data
   offloadOutputFile    | Filename for HepMC3/ROOT dump of offloaded tracks
   geometryOutputFile   | Filename for GDML export
+  cacheDirectory       | Directory for reusing imported physics and geometry
   maxNumTracks         | Number of tracks to be transported simultaneously
   maxNumEvents         | Maximum number of events in use
   maxNumSteps          | Limit on number of step iterations before aborting
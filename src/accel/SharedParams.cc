@@ -10,6 +10,7 @@
 #include <fstream>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -57,6 +58,8 @@
 #include "celeritas/random/RngParams.hh"
 #include "celeritas/track/SimParams.hh"
 #include "celeritas/track/TrackInitParams.hh"
+#include "celeritas/track/UserLimitsAction.hh"
+#include "celeritas/track/UserLimitsParams.hh"
 #include "celeritas/user/SlotDiagnostic.hh"
 #include "celeritas/user/StepCollector.hh"
 
@@ -65,6 +68,7 @@
 
 #include "detail/HitManager.hh"
 #include "detail/OffloadWriter.hh"
+#include "detail/SetupCache.hh"
 
 namespace celeritas
 {
@@ -432,16 +436,34 @@ void SharedParams::initialize_core(SetupOptions const& options)
                    << "along-step action factory 'make_along_step' was not "
                       "defined in the celeritas::SetupOptions");
 
-    auto const imported = [&options] {
-        celeritas::GeantImporter load_geant_data(
-            GeantImporter::get_world_volume());
-        // Convert ImportVolume names to GDML versions if we're exporting
-        // TODO: optical particle/process import
-        GeantImportDataSelection import_opts;
-        import_opts.particles = GeantImportDataSelection::em_basic;
-        import_opts.processes = import_opts.particles;
-        import_opts.unique_volumes = options.geometry_file.empty();
-        return std::make_shared<ImportData>(load_geant_data(import_opts));
+    // Convert ImportVolume names to GDML versions if we're exporting
+    // TODO: optical particle/process import
+    GeantImportDataSelection import_opts;
+    import_opts.particles = GeantImportDataSelection::em_basic;
+    import_opts.processes = import_opts.particles;
+    import_opts.unique_volumes = options.geometry_file.empty();
+
+    // Reuse imported data from a previous job with the same setup
+    std::optional<detail::SetupCache> cache;
+    if (!options.cache_directory.empty())
+    {
+        cache.emplace(options.cache_directory,
+                      detail::SetupCache::calc_key(
+                          GeantImporter::get_world_volume(), import_opts));
+    }
+
+    auto const imported = [&cache, &import_opts] {
+        auto import_geant = [&import_opts] {
+            celeritas::GeantImporter load_geant_data(
+                GeantImporter::get_world_volume());
+            return load_geant_data(import_opts);
+        };
+        if (cache)
+        {
+            return cache->physics(import_geant);
+        }
+        return std::shared_ptr<ImportData const>(
+            std::make_shared<ImportData>(import_geant()));
     }();
     CELER_ASSERT(imported && !imported->particles.empty()
                  && !imported->geo_materials.empty()
@@ -473,7 +495,7 @@ void SharedParams::initialize_core(SetupOptions const& options)
     output_reg_ = params.output_reg;
 
     // Load geometry
-    params.geometry = [&options] {
+    params.geometry = [&options, &cache]() -> CoreParams::SPConstGeo {
         if (!options.geometry_file.empty())
         {
             // Read directly from GDML input
@@ -486,6 +508,11 @@ void SharedParams::initialize_core(SetupOptions const& options)
             return geant_geo_;
         }
 #endif
+        else if (cache)
+        {
+            // Load converted geometry or convert and save it
+            return cache->geometry(GeantImporter::get_world_volume());
+        }
         else
         {
             // Import from Geant4
@@ -614,6 +641,13 @@ void SharedParams::initialize_core(SetupOptions const& options)
     CELER_ASSERT(params);
     params_ = std::make_shared<CoreParams>(std::move(params));
 
+    // Kill tracks that exceed Geant4 region user limits
+    if (auto limits
+        = UserLimitsParams::from_import(*imported, *params_->geometry()))
+    {
+        UserLimitsAction::make_and_insert(*params_, std::move(limits));
+    }
+
     // Add diagnostics
     if (!options.slot_diagnostic_prefix.empty())
     {
@@ -114,10 +114,14 @@ class SharedParams
     using SPOutputRegistry = std::shared_ptr<OutputRegistry>;
     using SPState = std::shared_ptr<CoreStateInterface>;
     using SPConstGeantGeoParams = std::shared_ptr<GeantGeoParams const>;
+    using SPStepCollector = std::shared_ptr<StepCollector>;
 
     // Hit manager, to be used only by LocalTransporter
     inline SPHitManager const& hit_manager() const;
 
+    // Step collector for the hit manager, to be used only by LocalTransporter
+    inline SPStepCollector const& step_collector() const;
+
     // Optional offload writer, only for use by LocalTransporter
     inline SPOffloadWriter const& offload_writer() const;
 
@@ -199,6 +203,18 @@ auto SharedParams::hit_manager() const -> SPHitManager const&
     return hit_manager_;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Step collector for the hit manager, to be used only by LocalTransporter.
+ *
+ * This is null if the hit manager is.
+ */
+auto SharedParams::step_collector() const -> SPStepCollector const&
+{
+    CELER_EXPECT(*this);
+    return step_collector_;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Optional offload writer, only for use by LocalTransporter.
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #include "HitProcessor.hh"
 
+#include <algorithm>
 #include <string>
 #include <utility>
 #include <CLHEP/Units/SystemOfUnits.h>
@@ -32,6 +33,7 @@
 #include "celeritas/user/StepData.hh"
 
 #include "TouchableUpdater.hh"
+#include "../SDBatchInterface.hh"
 
 namespace celeritas
 {
@@ -128,6 +130,25 @@ HitProcessor::HitProcessor(SPConstVecLV detector_volumes,
                        << static_cast<void const*>(lv));
     }
 
+    // Find detectors that can process their hits in bulk
+    batch_detectors_.resize(detectors_.size());
+    for (auto i : range(detectors_.size()))
+    {
+        batch_detectors_[i] = dynamic_cast<SDBatchInterface*>(detectors_[i]);
+        if (batch_detectors_[i] && detectors_[i]->GetFilter())
+        {
+            CELER_LOG_LOCAL(warning)
+                << "Sensitive detector '" << detectors_[i]->GetName()
+                << "' processes hits in bulk: its filter will be ignored";
+        }
+    }
+    if (std::all_of(batch_detectors_.begin(),
+                    batch_detectors_.end(),
+                    [](SDBatchInterface const* sd) { return sd == nullptr; }))
+    {
+        batch_detectors_.clear();
+    }
+
     CELER_ENSURE(!detectors_.empty());
 }
 
@@ -189,11 +210,84 @@ void HitProcessor::operator()(DetectorStepOutput const& out) const
 
     CELER_LOG_LOCAL(debug) << "Processing " << out.size() << " hits";
 
-    EnumArray<StepPoint, G4StepPoint*> points
-        = {step_->GetPreStepPoint(), step_->GetPostStepPoint()};
+    if (!batch_detectors_.empty())
+    {
+        this->process_sorted(out);
+        return;
+    }
 
     for (auto i : range(out.size()))
     {
+        this->process_hit(out, i);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Group hits by detector and process each detector's hits together.
+ *
+ * A counting sort is stable, so the hits for each detector are sent in their
+ * original order.
+ */
+void HitProcessor::process_sorted(DetectorStepOutput const& out) const
+{
+    CELER_EXPECT(batch_detectors_.size() == detectors_.size());
+
+    // Count the hits per detector and convert to offsets
+    std::vector<size_type> offsets(detectors_.size() + 1, 0);
+    for (DetectorId did : out.detector)
+    {
+        CELER_ASSERT(did < detectors_.size());
+        ++offsets[did.unchecked_get() + 1];
+    }
+    for (auto i : range(detectors_.size()))
+    {
+        offsets[i + 1] += offsets[i];
+    }
+
+    // Scatter hit indices into detector-sorted order
+    std::vector<size_type> sorted(out.size());
+    {
+        std::vector<size_type> pos(offsets.begin(), offsets.end() - 1);
+        for (auto i : range(out.size()))
+        {
+            sorted[pos[out.detector[i].unchecked_get()]++] = i;
+        }
+    }
+
+    for (auto d : range(detectors_.size()))
+    {
+        Span<size_type const> hits{sorted.data() + offsets[d],
+                                   sorted.data() + offsets[d + 1]};
+        if (hits.empty())
+        {
+            continue;
+        }
+        if (auto* batch = batch_detectors_[d])
+        {
+            // Like G4VSensitiveDetector::Hit, skip inactive detectors
+            if (detectors_[d]->isActive())
+            {
+                batch->ProcessHitBatch(out, hits);
+            }
+            continue;
+        }
+        for (auto i : hits)
+        {
+            this->process_hit(out, i);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Reconstruct a single step and send it to its sensitive detector.
+ */
+void HitProcessor::process_hit(DetectorStepOutput const& out, size_type i) const
+{
+    EnumArray<StepPoint, G4StepPoint*> points
+        = {step_->GetPreStepPoint(), step_->GetPostStepPoint()};
+
 #define HP_SET(SETTER, OUT, UNITS)                   \
     do                                               \
     {                                                \
@@ -203,61 +297,58 @@ void HitProcessor::operator()(DetectorStepOutput const& out) const
         }                                            \
     } while (0)
 
-        HP_SET(step_->SetTotalEnergyDeposit, out.energy_deposition, CLHEP::MeV);
+    HP_SET(step_->SetTotalEnergyDeposit, out.energy_deposition, CLHEP::MeV);
 
-        for (auto sp : range(StepPoint::size_))
+    for (auto sp : range(StepPoint::size_))
+    {
+        if (!points[sp])
         {
-            if (!points[sp])
-            {
-                continue;
-            }
-            HP_SET(points[sp]->SetGlobalTime, out.points[sp].time, clhep_time);
-            HP_SET(points[sp]->SetPosition, out.points[sp].pos, clhep_length);
-            HP_SET(points[sp]->SetKineticEnergy,
-                   out.points[sp].energy,
-                   CLHEP::MeV);
-            HP_SET(points[sp]->SetMomentumDirection, out.points[sp].dir, 1);
-            /*!
-             * \todo Celeritas currently ignores incoming particle weight and
-             * does not perform any variance reduction. See issue #1268.
-             */
-            points[sp]->SetWeight(1.0);
+            continue;
         }
+        HP_SET(points[sp]->SetGlobalTime, out.points[sp].time, clhep_time);
+        HP_SET(points[sp]->SetPosition, out.points[sp].pos, clhep_length);
+        HP_SET(points[sp]->SetKineticEnergy, out.points[sp].energy, CLHEP::MeV);
+        HP_SET(points[sp]->SetMomentumDirection, out.points[sp].dir, 1);
+        /*!
+         * \todo Celeritas currently ignores incoming particle weight and
+         * does not perform any variance reduction. See issue #1268.
+         */
+        points[sp]->SetWeight(1.0);
+    }
 #undef HP_SET
 
-        if (navi_)
-        {
-            G4LogicalVolume const* lv = this->detector_volume(out.detector[i]);
-
-            // Update navigation state
-            constexpr auto sp = StepPoint::pre;
-            TouchableUpdater update_touchable{navi_.get(), touch_handle_()};
-
-            bool success = update_touchable(
-                out.points[sp].pos[i], out.points[sp].dir[i], lv);
-            if (CELER_UNLIKELY(!success))
-            {
-                // Inconsistent touchable: skip this energy deposition
-                CELER_LOG_LOCAL(error)
-                    << "Omitting energy deposition of "
-                    << step_->GetTotalEnergyDeposit() / CLHEP::MeV << " [MeV]";
-                continue;
-            }
+    if (navi_)
+    {
+        G4LogicalVolume const* lv = this->detector_volume(out.detector[i]);
 
-            // Copy attributes from logical volume
-            points[sp]->SetMaterial(lv->GetMaterial());
-            points[sp]->SetMaterialCutsCouple(lv->GetMaterialCutsCouple());
-            points[sp]->SetSensitiveDetector(lv->GetSensitiveDetector());
-        }
+        // Update navigation state
+        constexpr auto sp = StepPoint::pre;
+        TouchableUpdater update_touchable{navi_.get(), touch_handle_()};
 
-        if (!tracks_.empty())
+        bool success = update_touchable(
+            out.points[sp].pos[i], out.points[sp].dir[i], lv);
+        if (CELER_UNLIKELY(!success))
         {
-            this->update_track(out.particle[i]);
+            // Inconsistent touchable: skip this energy deposition
+            CELER_LOG_LOCAL(error)
+                << "Omitting energy deposition of "
+                << step_->GetTotalEnergyDeposit() / CLHEP::MeV << " [MeV]";
+            return;
         }
 
-        // Hit sensitive detector
-        this->detector(out.detector[i])->Hit(step_.get());
+        // Copy attributes from logical volume
+        points[sp]->SetMaterial(lv->GetMaterial());
+        points[sp]->SetMaterialCutsCouple(lv->GetMaterialCutsCouple());
+        points[sp]->SetSensitiveDetector(lv->GetSensitiveDetector());
     }
+
+    if (!tracks_.empty())
+    {
+        this->update_track(out.particle[i]);
+    }
+
+    // Hit sensitive detector
+    this->detector(out.detector[i])->Hit(step_.get());
 }
 
 //---------------------------------------------------------------------------//
@@ -27,6 +27,7 @@ namespace celeritas
 {
 struct StepSelection;
 struct DetectorStepOutput;
+class SDBatchInterface;
 
 namespace detail
 {
@@ -47,6 +48,11 @@ namespace detail
  * - Update step attributes based on hit selection for the detector (TODO:
  *   selection is global for now)
  * - Call the local detector (based on detector ID from map) with the step
+ *
+ * If any sensitive detector implements \c SDBatchInterface, the steps are
+ * instead grouped by detector ID (preserving their order within each
+ * detector). Batch detectors receive all their hits in a single call, and the
+ * remaining detectors are called one step at a time as above.
  */
 class HitProcessor
 {
@@ -91,6 +97,8 @@ class HitProcessor
     SPConstVecLV detector_volumes_;
     //! Map detector IDs to sensitive detectors
     std::vector<G4VSensitiveDetector*> detectors_;
+    //! Map detector IDs to batch interfaces (null if not supported)
+    std::vector<SDBatchInterface*> batch_detectors_;
     //! Temporary CPU hit information
     DetectorStepOutput steps_;
 
@@ -110,6 +118,8 @@ class HitProcessor
     StreamId stream_;
 
     void update_track(ParticleId id) const;
+    void process_hit(DetectorStepOutput const& out, size_type i) const;
+    void process_sorted(DetectorStepOutput const& out) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,524 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/SetupCache.cc
+//---------------------------------------------------------------------------//
+#include "SetupCache.hh"
+
+#include <algorithm>
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include <G4EmParameters.hh>
+#include <G4LogicalVolume.hh>
+#include <G4Material.hh>
+#include <G4MaterialCutsCouple.hh>
+#include <G4ParticleDefinition.hh>
+#include <G4ParticleTable.hh>
+#include <G4ProcessManager.hh>
+#include <G4ProcessVector.hh>
+#include <G4ProductionCuts.hh>
+#include <G4ProductionCutsTable.hh>
+#include <G4Region.hh>
+#include <G4VPVParameterisation.hh>
+#include <G4VPhysicalVolume.hh>
+#include <G4VProcess.hh>
+#include <G4VSolid.hh>
+#include <nlohmann/json.hpp>
+
+#include "corecel/Config.hh"
+#include "corecel/Version.hh"
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/math/HashUtils.hh"
+#include "corecel/sys/Environment.hh"
+#include "corecel/sys/Stopwatch.hh"
+#include "celeritas/ext/GeantImporter.hh"
+#include "celeritas/ext/RootExporter.hh"
+#include "celeritas/ext/RootImporter.hh"
+#include "celeritas/geo/GeoParams.hh"
+#include "celeritas/io/ImportData.hh"
+
+#if CELERITAS_CORE_GEO == CELERITAS_CORE_GEO_ORANGE
+#    include "orange/OrangeInput.hh"
+#    include "orange/OrangeInputIO.json.hh"
+#    include "orange/g4org/Converter.hh"
+#endif
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Write the size and modification time of every file in a data directory.
+ *
+ * Hashing the contents of the Geant4 data sets would take longer than the
+ * setup being cached, but the metadata changes whenever a data set is
+ * replaced or edited in place.
+ */
+void stream_data_files(std::ostream& os, std::string const& dirname)
+{
+    namespace fs = std::filesystem;
+
+    std::vector<std::string> lines;
+    std::error_code ec;
+    for (fs::recursive_directory_iterator iter{dirname, ec}, end;
+         !ec && iter != end;
+         iter.increment(ec))
+    {
+        if (!iter->is_regular_file(ec))
+        {
+            continue;
+        }
+        std::ostringstream line;
+        line << iter->path().string() << ' ' << iter->file_size(ec) << ' '
+             << iter->last_write_time(ec).time_since_epoch().count();
+        lines.push_back(std::move(line).str());
+    }
+    if (ec)
+    {
+        // Missing or unreadable directory
+        os << "error: " << ec.message() << '\n';
+    }
+
+    // Directory iteration order is unspecified
+    std::sort(lines.begin(), lines.end());
+    for (auto const& line : lines)
+    {
+        os << line << '\n';
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write the placement of a daughter volume.
+ */
+void stream_placement(std::ostream& os, G4VPhysicalVolume const& pv)
+{
+    os << ' ' << pv.GetTranslation();
+    if (auto const* rot = pv.GetRotation())
+    {
+        os << ' ' << *rot;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write the processes of every particle and the EM options.
+ */
+void stream_physics(std::ostream& os)
+{
+    G4ParticleTable::G4PTblDicIterator& particle_iterator
+        = *(G4ParticleTable::GetParticleTable()->GetIterator());
+    particle_iterator.reset();
+    while (particle_iterator())
+    {
+        G4ParticleDefinition const& particle = *particle_iterator.value();
+        os << particle.GetParticleName() << ':';
+        if (auto const* manager = particle.GetProcessManager())
+        {
+            G4ProcessVector const& processes = *manager->GetProcessList();
+            for (auto i : range(processes.size()))
+            {
+                os << ' ' << processes[i]->GetProcessName() << '/'
+                   << processes[i]->GetProcessSubType();
+            }
+        }
+        os << '\n';
+    }
+
+    G4EmParameters::Instance()->StreamInfo(os);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write the production cuts for every material-cuts couple.
+ */
+void stream_cuts(std::ostream& os)
+{
+    auto const* cuts_table = G4ProductionCutsTable::GetProductionCutsTable();
+    CELER_ASSERT(cuts_table);
+    for (auto i : range(cuts_table->GetTableSize()))
+    {
+        auto const* couple = cuts_table->GetMaterialCutsCouple(i);
+        os << couple->GetMaterial()->GetName() << ':';
+        for (auto const& cut : couple->GetProductionCuts()->GetProductionCuts())
+        {
+            os << ' ' << cut;
+        }
+        os << '\n';
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write every material, including its elemental composition.
+ */
+void stream_materials(std::ostream& os)
+{
+    for (G4Material const* material : *G4Material::GetMaterialTable())
+    {
+        os << material;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write the geometry hierarchy, visiting each logical volume once.
+ */
+void stream_geometry(std::ostream& os, G4VPhysicalVolume const* world)
+{
+    std::unordered_set<G4LogicalVolume const*> visited;
+    std::vector<G4LogicalVolume const*> stack{world->GetLogicalVolume()};
+    while (!stack.empty())
+    {
+        G4LogicalVolume const* lv = stack.back();
+        stack.pop_back();
+        if (!visited.insert(lv).second)
+        {
+            continue;
+        }
+
+        os << lv->GetName() << ": " << lv->GetMaterial()->GetName();
+        if (auto const* region = lv->GetRegion())
+        {
+            os << ' ' << region->GetName();
+        }
+        os << '\n';
+        lv->GetSolid()->StreamInfo(os);
+        for (auto i : range(lv->GetNoDaughters()))
+        {
+            G4VPhysicalVolume const* pv = lv->GetDaughter(i);
+            os << pv->GetName() << ' ' << pv->GetLogicalVolume()->GetName()
+               << ' ' << pv->GetCopyNo();
+            stream_placement(os, *pv);
+            if (auto* param = pv->GetParameterisation())
+            {
+                // Write the transformation, shape, and material of every
+                // copy. The parameterisation updates the volume and solid in
+                // place, as the navigator does during tracking.
+                auto* mutable_pv = const_cast<G4VPhysicalVolume*>(pv);
+                os << " x" << pv->GetMultiplicity() << '\n';
+                for (auto copy : range(pv->GetMultiplicity()))
+                {
+                    param->ComputeTransformation(copy, mutable_pv);
+                    os << "  " << copy;
+                    stream_placement(os, *pv);
+                    if (G4VSolid* solid
+                        = param->ComputeSolid(copy, mutable_pv))
+                    {
+                        solid->ComputeDimensions(param, copy, mutable_pv);
+                        os << '\n';
+                        solid->StreamInfo(os);
+                    }
+                    if (G4Material const* mat
+                        = param->ComputeMaterial(copy, mutable_pv, nullptr))
+                    {
+                        os << ' ' << mat->GetName();
+                    }
+                    os << '\n';
+                }
+            }
+            else if (pv->IsReplicated())
+            {
+                EAxis axis;
+                G4int num_replicas;
+                G4double width;
+                G4double offset;
+                G4bool consuming;
+                pv->GetReplicationData(
+                    axis, num_replicas, width, offset, consuming);
+                os << " x" << pv->GetMultiplicity() << ' ' << axis << ' '
+                   << width << ' ' << offset;
+            }
+            os << '\n';
+            stack.push_back(pv->GetLogicalVolume());
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write to a temporary file and move it into place.
+ *
+ * This prevents concurrent jobs sharing a cache from reading a partially
+ * written file.
+ */
+template<class F>
+bool write_atomic(std::string const& filename, F&& write)
+{
+    std::string temp_filename
+        = filename + ".tmp" + std::to_string(std::random_device{}());
+    try
+    {
+        write(temp_filename);
+    }
+    catch (std::exception const& e)
+    {
+        CELER_LOG(warning) << "Failed to write setup cache file '"
+                           << temp_filename << "': " << e.what();
+        std::remove(temp_filename.c_str());
+        return false;
+    }
+    if (std::rename(temp_filename.c_str(), filename.c_str()) != 0)
+    {
+        CELER_LOG(warning) << "Failed to move setup cache file to '"
+                           << filename << "'";
+        std::remove(temp_filename.c_str());
+        return false;
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+//! Whether a file exists and can be read
+bool is_readable(std::string const& filename)
+{
+    return std::ifstream(filename).good();
+}
+
+//---------------------------------------------------------------------------//
+//! Log a cache hit
+void log_hit(char const* component,
+             std::string const& filename,
+             double load_time,
+             double build_time)
+{
+    auto msg = CELER_LOG(info);
+    msg << "Loaded cached " << component << " from '" << filename << "' in "
+        << load_time << " s";
+    if (build_time > 0)
+    {
+        msg << " (saved " << build_time - load_time << " s)";
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the cache key for the current Geant4 setup.
+ *
+ * This must be called after the Geant4 physics tables have been built, i.e.
+ * at the beginning of the run.
+ */
+std::string SetupCache::calc_key(G4VPhysicalVolume const* world,
+                                 GeantImportDataSelection const& selection)
+{
+    CELER_EXPECT(world);
+
+    std::ostringstream os;
+    os << std::setprecision(std::numeric_limits<double>::max_digits10);
+    os << celeritas_version << ' ' << CELERITAS_REAL_TYPE << ' '
+       << CELERITAS_UNITS << ' ' << CELERITAS_CORE_GEO << '\n'
+       << selection.particles << ' ' << selection.materials << ' '
+       << selection.processes << ' ' << selection.unique_volumes << ' '
+       << selection.reader_data << '\n';
+    for (char const* var :
+         {"G4LEDATA", "G4LEVELGAMMADATA", "G4PARTICLEXSDATA"})
+    {
+        std::string const& dirname = celeritas::getenv(var);
+        os << var << '=' << dirname << '\n';
+        if (!dirname.empty())
+        {
+            stream_data_files(os, dirname);
+        }
+    }
+    stream_physics(os);
+    stream_cuts(os);
+    stream_materials(os);
+    stream_geometry(os, world);
+
+    std::string const str = std::move(os).str();
+    std::size_t hash{};
+    Hasher{&hash}(Span<std::byte const>{
+        reinterpret_cast<std::byte const*>(str.data()), str.size()});
+
+    std::ostringstream key;
+    key << std::hex << std::setfill('0') << std::setw(2 * sizeof(hash))
+        << hash;
+    return std::move(key).str();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the cache directory and key.
+ *
+ * The directory must already exist.
+ */
+SetupCache::SetupCache(std::string directory, std::string key)
+{
+    CELER_EXPECT(!directory.empty());
+    CELER_EXPECT(!key.empty());
+
+    base_ = std::move(directory);
+    if (base_.back() != '/')
+    {
+        base_ += '/';
+    }
+    base_ += "celeritas-setup-";
+    base_ += key;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Load cached physics data or import and save it.
+ */
+auto SetupCache::physics(BuildImport const& build) const -> SPConstImport
+{
+    CELER_EXPECT(build);
+
+    if constexpr (!CELERITAS_USE_ROOT)
+    {
+        CELER_LOG(warning) << "Cannot cache imported physics data: ROOT is "
+                              "disabled";
+        return std::make_shared<ImportData>(build());
+    }
+
+    std::string const filename = this->filename(".root");
+    if (is_readable(filename))
+    {
+        Stopwatch get_time;
+        auto result = std::make_shared<ImportData>(RootImporter{filename}());
+        log_hit("physics data",
+                filename,
+                get_time(),
+                this->load_build_time("physics"));
+        return result;
+    }
+
+    CELER_LOG(info) << "Physics data cache miss: importing from Geant4";
+    Stopwatch get_time;
+    auto result = std::make_shared<ImportData>(build());
+    double build_time = get_time();
+
+    if (write_atomic(filename, [&result](std::string const& temp) {
+            RootExporter{temp.c_str()}(*result);
+        }))
+    {
+        this->save_build_time("physics", build_time);
+        CELER_LOG(debug) << "Saved physics data to '" << filename << "'";
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Load cached geometry or convert and save it.
+ */
+auto SetupCache::geometry(G4VPhysicalVolume const* world) const -> SPConstGeo
+{
+    CELER_EXPECT(world);
+
+#if CELERITAS_CORE_GEO == CELERITAS_CORE_GEO_ORANGE
+    std::string const filename = this->filename(".org.json");
+    if (is_readable(filename))
+    {
+        Stopwatch get_time;
+        auto result = std::make_shared<GeoParams>(filename);
+        log_hit("geometry",
+                filename,
+                get_time(),
+                this->load_build_time("geometry"));
+        return result;
+    }
+
+    CELER_LOG(info) << "Geometry cache miss: converting from Geant4";
+    Stopwatch get_time;
+    auto input = g4org::Converter{}(world).input;
+    double build_time = get_time();
+
+    if (write_atomic(filename, [&input](std::string const& temp) {
+            std::ofstream outfile(temp);
+            CELER_VALIDATE(outfile, << "failed to open file");
+            outfile << nlohmann::json(input).dump();
+            CELER_VALIDATE(outfile, << "failed to write file");
+        }))
+    {
+        this->save_build_time("geometry", build_time);
+        CELER_LOG(debug) << "Saved geometry to '" << filename << "'";
+    }
+    return std::make_shared<GeoParams>(std::move(input));
+#else
+    CELER_LOG(debug) << "Geometry caching requires ORANGE";
+    return std::make_shared<GeoParams>(world);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the cache filename for a component.
+ */
+std::string SetupCache::filename(char const* ext) const
+{
+    return base_ + ext;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Load the time originally spent building a component, or zero if unknown.
+ */
+double SetupCache::load_build_time(char const* component) const
+{
+    std::ifstream infile(this->filename(".time.json"));
+    if (!infile)
+    {
+        return 0;
+    }
+    auto j = nlohmann::json::parse(
+        infile, nullptr, /* allow_exceptions = */ false);
+    if (!j.is_object() || !j.contains(component))
+    {
+        return 0;
+    }
+    return j.at(component).get<double>();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Save the time spent building a component.
+ */
+void SetupCache::save_build_time(char const* component, double seconds) const
+{
+    std::string const filename = this->filename(".time.json");
+
+    nlohmann::json j = nlohmann::json::object();
+    if (std::ifstream infile(filename); infile)
+    {
+        auto existing = nlohmann::json::parse(
+            infile, nullptr, /* allow_exceptions = */ false);
+        if (existing.is_object())
+        {
+            j = std::move(existing);
+        }
+    }
+    j[component] = seconds;
+
+    write_atomic(filename, [&j](std::string const& temp) {
+        std::ofstream outfile(temp);
+        CELER_VALIDATE(outfile, << "failed to open file");
+        outfile << j.dump();
+    });
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,89 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/SetupCache.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "celeritas/geo/GeoFwd.hh"
+
+class G4VPhysicalVolume;
+
+namespace celeritas
+{
+struct GeantImportDataSelection;
+struct ImportData;
+
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Reuse imported physics data and converted geometry between jobs.
+ *
+ * Importing physics data from Geant4 and converting the geometry to ORANGE
+ * are the most expensive parts of Celeritas setup, and they produce the same
+ * result as long as the Geant4 problem definition is unchanged. The cache key
+ * is a hash of:
+ * - the Celeritas version and build configuration,
+ * - the import data selection,
+ * - the processes attached to every particle and the EM parameters,
+ * - the production cuts of every material-cuts couple,
+ * - the size and modification time of every file in the Geant4 data
+ *   directories used during import,
+ * - the material table, and
+ * - the geometry hierarchy: solids, materials, regions, and daughter
+ *   placements, including the transformation, shape, and material of every
+ *   copy of a parameterised volume.
+ *
+ * Floating point values are written at full precision before hashing.
+ *
+ * On a cache miss, the imported \c ImportData is written as a ROOT file and
+ * the converted \c OrangeInput as a JSON file in the cache directory, named
+ * by the key. On a hit, they are read back instead of being rebuilt. The
+ * time spent building each component is stored alongside so that the time
+ * saved can be reported.
+ *
+ * Physics data caching requires ROOT, and geometry caching requires ORANGE
+ * as the core geometry. Components that cannot be cached are always built.
+ */
+class SetupCache
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SPConstImport = std::shared_ptr<ImportData const>;
+    using SPConstGeo = std::shared_ptr<GeoParams const>;
+    using BuildImport = std::function<ImportData()>;
+    //!@}
+
+  public:
+    // Calculate the cache key for the current Geant4 setup
+    static std::string calc_key(G4VPhysicalVolume const* world,
+                                GeantImportDataSelection const& selection);
+
+    // Construct with the cache directory and key
+    SetupCache(std::string directory, std::string key);
+
+    // Load cached physics data or import and save it
+    SPConstImport physics(BuildImport const& build) const;
+
+    // Load cached geometry or convert and save it
+    SPConstGeo geometry(G4VPhysicalVolume const* world) const;
+
+  private:
+    std::string base_;
+
+    std::string filename(char const* ext) const;
+    double load_build_time(char const* component) const;
+    void save_build_time(char const* component, double seconds) const;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
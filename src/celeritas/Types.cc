@@ -56,9 +56,12 @@ char const* to_cstring(TrackOrder value)
         "reindex_shuffle",
         "reindex_status",
         "reindex_particle_type",
+        "reindex_spatial",
+        "reindex_position",
         "reindex_along_step_action",
         "reindex_step_limit_action",
         "reindex_both_action",
+        "reindex_spatial_step_limit_action",
     };
     return to_cstring_impl(value);
 }
@@ -93,5 +96,20 @@ char const* to_cstring(NuclearFormFactorType value)
     return to_cstring_impl(value);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get a string corresponding to the host scheduling strategy.
+ */
+char const* to_cstring(HostScheduling value)
+{
+    static EnumStringMapper<HostScheduling> const to_cstring_impl{
+        "serial",
+        "parallel",
+        "task",
+        "pool",
+    };
+    return to_cstring_impl(value);
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
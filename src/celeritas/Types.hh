@@ -143,8 +143,10 @@ enum class StepPoint
  * 3. Tracks are \em reindexed one or more times per step so that the layout
  *    in memory is unchanged but an additional indirection maps threads onto
  *    different track slots based on particle attributes (\c reindex_status,
- *    \c reindex_particle_type ), actions (\c reindex_along_step_action,
- *    \c reindex_step_limit_action, \c reindex_both_action ).
+ *    \c reindex_particle_type ), location (\c reindex_spatial,
+ *    \c reindex_position ), actions (\c reindex_along_step_action,
+ *    \c reindex_step_limit_action, \c reindex_both_action ), or location
+ *    within each action (\c reindex_spatial_step_limit_action ).
  * 4. As a control to measure the cost of indirection, the track slots can be
  *    reindexed randomly at the beginning of execution (\c reindex_shuffle ).
  */
@@ -160,11 +162,15 @@ enum class TrackOrder
     reindex_shuffle = begin_reindex_,
     reindex_status,  //!< Partition by active/inactive status
     reindex_particle_type,  //!< Sort by particle type
+    reindex_spatial,  //!< Sort by volume, then position along a Z-order curve
+    reindex_position,  //!< Sort by position along a Z-order curve
     begin_reindex_action_,
     //! Sort only by the along-step action id
     reindex_along_step_action = begin_reindex_action_,
     reindex_step_limit_action,  //!< Sort only by the step limit action id
     reindex_both_action,  //!< Sort by along-step id, then post-step ID
+    //! Sort spatially, then (stably) by the step limit action id
+    reindex_spatial_step_limit_action,
     end_reindex_action_,
     end_reindex_ = end_reindex_action_,
     size_ = end_reindex_
@@ -192,6 +198,31 @@ enum class NuclearFormFactorType
     size_
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Strategy for distributing track slots among CPU threads.
+ *
+ * - \c serial executes all track slots of an action on the calling thread,
+ *   which is appropriate when events are run concurrently on separate threads.
+ * - \c parallel statically divides the track slots of each action among a
+ *   new OpenMP team.
+ * - \c task divides the track slots into chunks that are executed as OpenMP
+ *   tasks. When streams are themselves run as tasks inside a parallel region,
+ *   threads that have no event left to transport steal chunks from the
+ *   actions of busy streams.
+ * - \c pool distributes chunks of track slots among persistent worker
+ *   threads, avoiding the cost of creating a parallel region for every
+ *   action.
+ */
+enum class HostScheduling
+{
+    serial,
+    parallel,
+    task,
+    pool,
+    size_
+};
+
 //---------------------------------------------------------------------------//
 // HELPER STRUCTS
 //---------------------------------------------------------------------------//
@@ -219,6 +250,15 @@ CELER_CONSTEXPR_FUNCTION bool is_track_valid(TrackStatus status)
     return status != TrackStatus::inactive && status != TrackStatus::errored;
 }
 
+//---------------------------------------------------------------------------//
+//! Default host scheduling for the configured OpenMP mode
+CELER_CONSTEXPR_FUNCTION HostScheduling default_host_scheduling()
+{
+    return CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+               ? HostScheduling::pool
+               : HostScheduling::serial;
+}
+
 //---------------------------------------------------------------------------//
 // HELPER FUNCTIONS (HOST)
 //---------------------------------------------------------------------------//
@@ -241,5 +281,8 @@ char const* to_cstring(MscStepLimitAlgorithm value);
 // Get a string corresponding to the nuclear form factor model
 char const* to_cstring(NuclearFormFactorType value);
 
+// Get a string corresponding to the host scheduling strategy
+char const* to_cstring(HostScheduling value);
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -60,5 +60,26 @@ void to_json(nlohmann::json& j, TrackOrder const& value)
     j = std::string{to_cstring(value)};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Read host scheduling from JSON.
+ */
+void from_json(nlohmann::json const& j, HostScheduling& value)
+{
+    static auto const from_string
+        = StringEnumMapper<HostScheduling>::from_cstring_func(
+            to_cstring, "host scheduling");
+    value = from_string(j.get<std::string>());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write host scheduling to JSON.
+ */
+void to_json(nlohmann::json& j, HostScheduling const& value)
+{
+    j = std::string{to_cstring(value)};
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -17,5 +17,8 @@ namespace celeritas
 void from_json(nlohmann::json const& j, TrackOrder& value);
 void to_json(nlohmann::json& j, TrackOrder const& value);
 
+void from_json(nlohmann::json const& j, HostScheduling& value);
+void to_json(nlohmann::json& j, HostScheduling const& value);
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -53,6 +53,9 @@ class SBEnergyDistHelper
     template<class Engine>
     inline CELER_FUNCTION Energy sample_exit_energy(Engine& rng) const;
 
+    // Calculate the exit energy from a uniform sample on [0, 1)
+    inline CELER_FUNCTION Energy calc_exit_energy(real_type xi) const;
+
     // Calculate tabulated cross section for a given energy
     inline CELER_FUNCTION Xs calc_xs(Energy energy) const;
 
@@ -118,9 +121,19 @@ SBEnergyDistHelper::SBEnergyDistHelper(SBDXsec const& differential_xs,
 template<class Engine>
 CELER_FUNCTION auto
 SBEnergyDistHelper::sample_exit_energy(Engine& rng) const -> Energy
+{
+    return this->calc_exit_energy(generate_canonical(rng));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the exit energy from a uniform sample on [0, 1).
+ */
+CELER_FUNCTION auto SBEnergyDistHelper::calc_exit_energy(real_type xi) const
+    -> Energy
 {
     // Sample scaled energy and subtract correction factor
-    real_type esq = sample_exit_esq_(rng) - dens_corr_;
+    real_type esq = sample_exit_esq_.transform(xi) - dens_corr_;
     CELER_ASSERT(esq >= 0);
     return Energy{std::sqrt(esq)};
 }
@@ -7,11 +7,15 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "corecel/Assert.hh"
+#include "corecel/cont/Array.hh"
+#include "corecel/cont/Span.hh"
 #include "corecel/grid/TwodSubgridCalculator.hh"
 #include "corecel/math/Algorithms.hh"
 #include "celeritas/Quantities.hh"
 #include "celeritas/em/data/SeltzerBergerData.hh"
-#include "celeritas/random/distribution/RejectionSampler.hh"
+#include "celeritas/random/CountingRngEngine.hh"
+#include "celeritas/random/distribution/GenerateCanonical.hh"
 
 #include "SBEnergyDistHelper.hh"
 
@@ -149,14 +153,20 @@ CELER_FUNCTION auto SBEnergyDistribution<X>::operator()(Engine& rng) -> Energy
     Energy exit_energy;
     // Calculated cross section used inside rejection sampling
     real_type xs{};
+    // Uniform deviates for the energy and the rejection
+    Array<real_type, 2> xi;
     do
     {
+        count_iteration(rng);
+        fill_canonical(rng, make_span(xi));
+
         // Sample scaled energy and subtract correction factor
-        exit_energy = helper_.sample_exit_energy(rng);
+        exit_energy = helper_.calc_exit_energy(xi[0]);
 
         // Interpolate the differential cross setion at the sampled exit energy
         xs = helper_.calc_xs(exit_energy).value() * scale_xs_(exit_energy);
-    } while (RejectionSampler<>(xs, helper_.max_xs().value())(rng));
+        CELER_ASSERT(xs >= 0 && xs <= helper_.max_xs().value());
+    } while (xs < helper_.max_xs().value() * xi[1]);
     return exit_energy;
 }
 
@@ -11,6 +11,7 @@
 #include "corecel/Types.hh"
 #include "corecel/math/Algorithms.hh"
 #include "celeritas/Quantities.hh"
+#include "celeritas/random/CountingRngEngine.hh"
 #include "celeritas/random/distribution/BernoulliDistribution.hh"
 
 namespace celeritas
@@ -80,6 +81,7 @@ CELER_FUNCTION real_type TsaiUrbanDistribution::operator()(Engine& rng)
     real_type u;
     do
     {
+        count_iteration(rng);
         real_type uu
             = -std::log(generate_canonical(rng) * generate_canonical(rng));
         u = uu
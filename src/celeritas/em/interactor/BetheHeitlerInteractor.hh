@@ -21,6 +21,7 @@
 #include "celeritas/phys/Interaction.hh"
 #include "celeritas/phys/ParticleTrackView.hh"
 #include "celeritas/phys/Secondary.hh"
+#include "celeritas/random/CountingRngEngine.hh"
 #include "celeritas/random/distribution/BernoulliDistribution.hh"
 #include "celeritas/random/distribution/GenerateCanonical.hh"
 #include "celeritas/random/distribution/UniformRealDistribution.hh"
@@ -220,6 +221,7 @@ CELER_FUNCTION Interaction BetheHeitlerInteractor::operator()(Engine& rng)
         real_type g;
         do
         {
+            count_iteration(rng);
             if (choose_f1g1(rng))
             {
                 // Used to sample from f1
@@ -24,6 +24,7 @@
 #include "celeritas/phys/Interaction.hh"
 #include "celeritas/phys/ParticleTrackView.hh"
 #include "celeritas/phys/PhysicsTrackView.hh"
+#include "celeritas/random/CountingRngEngine.hh"
 #include "celeritas/random/distribution/BernoulliDistribution.hh"
 #include "celeritas/random/distribution/GenerateCanonical.hh"
 #include "celeritas/random/distribution/UniformRealDistribution.hh"
@@ -487,6 +488,7 @@ CELER_FUNCTION real_type UrbanMscScatter::simple_scattering(Engine& rng) const
     real_type result{};
     do
     {
+        count_iteration(rng);
         real_type rdm = generate_canonical(rng);
         result = 2 * (sample_pow(rng) ? fastpow(rdm, 1 / (a + 1)) : rdm) - 1;
     } while (std::fabs(result) > 1);
@@ -68,7 +68,8 @@ UrbanMscParams::UrbanMscParams(ParticleParams const& particles,
     detail::MscParamsHelper helper(
         particles, mdata_vec, ImportModelClass::urban_msc);
     helper.build_ids(&host_data.ids);
-    helper.build_xs(&host_data.xs, &host_data.reals);
+    helper.build_xs(&host_data.xs, &host_data.reals, &table_deviation_);
+    log_table_deviation("Urban MSC", table_deviation_);
 
     // Save electron mass
     host_data.electron_mass = particles.get(host_data.ids.electron).mass();
@@ -12,6 +12,7 @@
 #include "corecel/data/CollectionMirror.hh"
 #include "corecel/data/ParamsDataInterface.hh"
 #include "celeritas/em/data/UrbanMscData.hh"
+#include "celeritas/grid/ValueGridInserter.hh"
 
 namespace celeritas
 {
@@ -51,6 +52,9 @@ class UrbanMscParams final : public ParamsDataInterface<UrbanMscData>
     // TODO: possible "applicability" interface used for constructing
     // along-step kernels?
 
+    //! Maximum relative error of each stored cross section table
+    TableDeviation const& table_deviation() const { return table_deviation_; }
+
     //! Access UrbanMsc data on the host
     HostRef const& host_ref() const final { return data_.host_ref(); }
 
@@ -60,6 +64,7 @@ class UrbanMscParams final : public ParamsDataInterface<UrbanMscData>
   private:
     // Host/device storage and reference
     CollectionMirror<UrbanMscData> data_;
+    TableDeviation table_deviation_;
 
     static UrbanMscMaterialData
     calc_material_data(MaterialView const& material_view);
@@ -12,6 +12,7 @@
 #include "corecel/data/CollectionMirror.hh"
 #include "corecel/data/ParamsDataInterface.hh"
 #include "celeritas/em/data/WentzelVIMscData.hh"
+#include "celeritas/grid/ValueGridInserter.hh"
 
 namespace celeritas
 {
@@ -43,6 +44,9 @@ class WentzelVIMscParams final : public ParamsDataInterface<WentzelVIMscData>
     WentzelVIMscParams(ParticleParams const& particles,
                        VecImportMscModel const& mdata);
 
+    //! Maximum relative error of each stored cross section table
+    TableDeviation const& table_deviation() const { return table_deviation_; }
+
     //! Access Wentzel VI data on the host
     HostRef const& host_ref() const final { return data_.host_ref(); }
 
@@ -52,6 +56,7 @@ class WentzelVIMscParams final : public ParamsDataInterface<WentzelVIMscData>
   private:
     // Host/device storage and reference
     CollectionMirror<WentzelVIMscData> data_;
+    TableDeviation table_deviation_;
 };
 
 //---------------------------------------------------------------------------//
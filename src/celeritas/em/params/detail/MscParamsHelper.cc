@@ -105,9 +105,16 @@ void MscParamsHelper::build_ids(CoulombIds* ids) const
 //---------------------------------------------------------------------------//
 /*!
  * Build the macroscopic cross section scaled by energy squared.
+ *
+ * The maximum relative error from the table storage precision is saved for
+ * each particle, e.g. \c "e-/urban_msc".
  */
-void MscParamsHelper::build_xs(XsValues* scaled_xs, Values* reals) const
+void MscParamsHelper::build_xs(XsValues* scaled_xs,
+                               Values* reals,
+                               TableDeviation* deviation) const
 {
+    CELER_EXPECT(deviation);
+
     // Scaled cross section builder
     CollectionBuilder xs(scaled_xs);
     size_type num_materials
@@ -116,12 +123,20 @@ void MscParamsHelper::build_xs(XsValues* scaled_xs, Values* reals) const
 
     // TODO: simplify when refactoring ValueGridInserter, etc
     ValueGridInserter::XsGridCollection xgc;
-    ValueGridInserter vgi{reals, &xgc};
+    Array<double*, 2> table_dev;
+    for (size_type par_idx : range(par_ids_.size()))
+    {
+        table_dev[par_idx]
+            = &(*deviation)[particles_.id_to_label(par_ids_[par_idx]) + '/'
+                            + to_cstring(model_class_)];
+    }
 
     for (size_type mat_idx : range(num_materials))
     {
         for (size_type par_idx : range(par_ids_.size()))
         {
+            ValueGridInserter vgi{reals, &xgc, table_dev[par_idx]};
+
             // Get the cross section data for this particle and material
             CELER_ASSERT(mat_idx < xs_tables_[par_idx]->physics_vectors.size());
             ImportPhysicsVector const& pvec
@@ -13,13 +13,14 @@
 #include "corecel/data/Collection.hh"
 #include "celeritas/Quantities.hh"
 #include "celeritas/em/data/CommonCoulombData.hh"
+#include "celeritas/grid/ValueGridInserter.hh"
+#include "celeritas/grid/XsGridData.hh"
 #include "celeritas/io/ImportModel.hh"
 
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
 class ParticleParams;
-struct XsGridData;
 
 namespace detail
 {
@@ -36,7 +37,8 @@ class MscParamsHelper
     using EnergyBounds = Array<Energy, 2>;
     using VecImportMscModel = std::vector<ImportMscModel>;
     using XsValues = Collection<XsGridData, Ownership::value, MemSpace::host>;
-    using Values = Collection<real_type, Ownership::value, MemSpace::host>;
+    using Values
+        = Collection<table_real_type, Ownership::value, MemSpace::host>;
     //!@}
 
     MscParamsHelper(ParticleParams const&,
@@ -44,7 +46,7 @@ class MscParamsHelper
                     ImportModelClass);
 
     void build_ids(CoulombIds* ids) const;
-    void build_xs(XsValues*, Values*) const;
+    void build_xs(XsValues*, Values*, TableDeviation*) const;
     EnergyBounds energy_grid_bounds() const;
 
   private:
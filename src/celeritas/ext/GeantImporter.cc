@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <limits>
 #include <map>
 #include <memory>
 #include <string>
@@ -50,9 +51,11 @@
 #include <G4Region.hh>
 #include <G4RegionStore.hh>
 #include <G4String.hh>
+#include <G4Track.hh>
 #include <G4Transportation.hh>
 #include <G4TransportationManager.hh>
 #include <G4Types.hh>
+#include <G4UserLimits.hh>
 #include <G4VEnergyLossProcess.hh>
 #include <G4VMultipleScattering.hh>
 #include <G4VPhysicalVolume.hh>
@@ -765,6 +768,22 @@ std::vector<ImportRegion> import_regions()
 
     std::vector<ImportRegion> result(regions.size());
 
+    double const len_scale = native_value_from_clhep(ImportUnits::len);
+    double const time_scale = native_value_from_clhep(ImportUnits::time);
+
+    // Convert a limit, treating Geant4's "unlimited" value as infinite
+    auto convert_max = [](double value, double scale) {
+        if (value >= std::numeric_limits<double>::max())
+        {
+            return ImportUserLimits::inf;
+        }
+        return value * scale;
+    };
+
+    // Geant4 user limits are queried with a track (which the base class
+    // ignores)
+    G4Track const track;
+
     // Loop over region data
     for (auto i : range(result.size()))
     {
@@ -777,7 +796,19 @@ std::vector<ImportRegion> import_regions()
         region.name = g4reg->GetName();
         region.field_manager = (g4reg->GetFieldManager() != nullptr);
         region.production_cuts = (g4reg->GetProductionCuts() != nullptr);
-        region.user_limits = (g4reg->GetUserLimits() != nullptr);
+        if (G4UserLimits* ul = g4reg->GetUserLimits())
+        {
+            region.user_limits = true;
+            auto& limits = region.limits;
+            limits.max_step
+                = convert_max(ul->GetMaxAllowedStep(track), len_scale);
+            limits.max_track_length
+                = convert_max(ul->GetUserMaxTrackLength(track), len_scale);
+            limits.max_time
+                = convert_max(ul->GetUserMaxTime(track), time_scale);
+            limits.min_kinetic_energy = ul->GetUserMinEkine(track) * mev_scale;
+            limits.min_range = ul->GetUserMinRange(track) * len_scale;
+        }
 
         // Add region to result
         result[i] = std::move(region);
@@ -7,9 +7,12 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
-#include <map>
+#include <set>
+#include <utility>
 #include <vector>
 
+#include "corecel/Assert.hh"
+#include "celeritas/io/ElementDataCache.hh"
 #include "celeritas/io/ImportElement.hh"
 
 namespace celeritas
@@ -24,6 +27,10 @@ namespace detail
  * reproducibility. Note that the Celeritas interfaces uses the type-safe
  * \c AtomicNumber class but we store the atomic number as an int in
  * ImportFile.
+ *
+ * Every imported element is read, since \c MaterialParams constructs all of
+ * them and the models look up data for each one. The elements are read in
+ * parallel through a \c CachedElementReader .
  */
 class AllElementReader
 {
@@ -34,33 +41,43 @@ class AllElementReader
     //!@}
 
   public:
-    //! Construct from vector of imported elements
-    explicit AllElementReader(VecElements const& els) : elements_(els)
-    {
-        CELER_EXPECT(!elements_.empty());
-    }
+    // Construct from vector of imported elements
+    inline explicit AllElementReader(VecElements const& els);
 
     //! Load a map of data for all stored elements
     template<class ReadOneElement>
-    auto operator()(ReadOneElement&& read_el) const -> decltype(auto)
+    auto operator()(ReadOneElement&& read_el) const
     {
-        using result_type = typename ReadOneElement::result_type;
-
-        std::map<int, result_type> result_map;
-
-        for (ImportElement const& element : elements_)
-        {
-            AtomicNumber z{element.atomic_number};
-            CELER_ASSERT(z);
-            result_map.insert({z.unchecked_get(), read_el(z)});
-        }
-        return result_map;
+        CachedElementReader read{std::forward<ReadOneElement>(read_el)};
+        return read(atomic_numbers_);
     }
 
   private:
-    std::vector<ImportElement> const& elements_;
+    std::vector<AtomicNumber> atomic_numbers_;
 };
 
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from vector of imported elements.
+ */
+AllElementReader::AllElementReader(VecElements const& els)
+{
+    CELER_EXPECT(!els.empty());
+
+    std::set<int> atomic_numbers;
+    for (auto const& el : els)
+    {
+        atomic_numbers.insert(el.atomic_number);
+    }
+    for (int z : atomic_numbers)
+    {
+        CELER_ASSERT(AtomicNumber{z});
+        atomic_numbers_.push_back(AtomicNumber{z});
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace detail
 }  // namespace celeritas
@@ -69,7 +69,9 @@ is_action_sorted(StepActionOrder aorder, TrackOrder torder)
                && torder == TrackOrder::reindex_along_step_action)
            || (torder == TrackOrder::reindex_both_action
                && (aorder == StepActionOrder::post
-                   || aorder == StepActionOrder::along));
+                   || aorder == StepActionOrder::along))
+           || (aorder == StepActionOrder::post
+               && torder == TrackOrder::reindex_spatial_step_limit_action);
 }
 
 //---------------------------------------------------------------------------//
@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <exception>
+#include <mutex>
 #include <utility>
 
 #include "corecel/Config.hh"
@@ -21,12 +23,18 @@
 #include "CoreState.hh"
 #include "KernelContextException.hh"
 
+#include "detail/HostScheduler.hh"
+
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
  * Helper function to run an executor in parallel on CPU.
  *
+ * The track slots are distributed among threads according to the core
+ * params' host scheduling strategy, unless there are too few active tracks
+ * to amortize the threading overhead.
+ *
  * Example:
  * \code
  void FooHelper::step(CoreParams const& params,
@@ -43,17 +51,33 @@ void launch_core(std::string_view label,
                  F&& execute_thread)
 {
     MultiExceptionHandler capture_exception;
-#if defined(_OPENMP) && CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
-#    pragma omp parallel for
-#endif
-    for (size_type i = 0, size = state.size(); i != size; ++i)
+    std::mutex exception_mutex;
+    auto capture_locked = [&](std::exception_ptr p) {
+        // Worker pool threads are not synchronized by OpenMP
+        std::scoped_lock lock{exception_mutex};
+        capture_exception(std::move(p));
+    };
+    auto execute_range = [&](size_type begin, size_type end) {
+        for (size_type i = begin; i != end; ++i)
+        {
+            CELER_TRY_HANDLE_CONTEXT(
+                execute_thread(ThreadId{i}),
+                capture_locked,
+                KernelContextException(params.ref<MemSpace::host>(),
+                                       state.ref(),
+                                       ThreadId{i},
+                                       label));
+        }
+    };
+
+    HostScheduling sched = params.host_scheduling();
+    if (state.counters().num_active < params.host_serial_threshold())
     {
-        CELER_TRY_HANDLE_CONTEXT(
-            execute_thread(ThreadId{i}),
-            capture_exception,
-            KernelContextException(
-                params.ref<MemSpace::host>(), state.ref(), ThreadId{i}, label));
+        // Threading overhead exceeds the work for only a few tracks
+        sched = HostScheduling::serial;
     }
+    detail::launch_host(
+        sched, params.host_pool(), state.size(), execute_range);
     log_and_rethrow(std::move(capture_exception));
 }
 
@@ -55,6 +55,7 @@
 
 #include "ActionInterface.hh"
 #include "alongstep/AlongStepNeutralAction.hh"
+#include "alongstep/AlongStepNeutralWoodcockAction.hh"
 
 #if CELERITAS_CORE_GEO == CELERITAS_CORE_GEO_ORANGE
 #    include "orange/OrangeParams.hh"
@@ -107,6 +108,12 @@ ActionId find_along_step_id(ActionRegistry const& reg)
     {
         // Get abstract action shared pointer and see if it's explicit
         auto const& base = reg.action(ActionId{aidx});
+        if (std::dynamic_pointer_cast<AlongStepNeutralWoodcockAction const>(
+                base))
+        {
+            // Woodcock tracking only applies to neutral particles
+            continue;
+        }
         if (auto expl
             = std::dynamic_pointer_cast<CoreStepActionInterface const>(base))
         {
@@ -119,6 +126,21 @@ ActionId find_along_step_id(ActionRegistry const& reg)
     return {};
 }
 
+//---------------------------------------------------------------------------//
+
+ActionId find_woodcock_id(ActionRegistry const& reg)
+{
+    for (auto aidx : range(reg.num_actions()))
+    {
+        if (std::dynamic_pointer_cast<AlongStepNeutralWoodcockAction const>(
+                reg.action(ActionId{aidx})))
+        {
+            return ActionId{aidx};
+        }
+    }
+    return {};
+}
+
 //---------------------------------------------------------------------------//
 class PropagationLimitAction final : public StaticConcreteAction
 {
@@ -161,14 +183,22 @@ CoreScalars build_actions(ActionRegistry* reg)
                 reg->action(scalars.along_step_user_action));
     }
 
-    if (!along_step_neutral)
+    if (auto woodcock_id = find_woodcock_id(*reg))
     {
-        // Create neutral action if one doesn't exist
-        along_step_neutral
-            = make_shared<AlongStepNeutralAction>(reg->next_id());
-        reg->insert(along_step_neutral);
+        // Use user-provided delta tracking for neutral particles
+        scalars.along_step_neutral_action = woodcock_id;
+    }
+    else
+    {
+        if (!along_step_neutral)
+        {
+            // Create neutral action if one doesn't exist
+            along_step_neutral
+                = make_shared<AlongStepNeutralAction>(reg->next_id());
+            reg->insert(along_step_neutral);
+        }
+        scalars.along_step_neutral_action = along_step_neutral->action_id();
     }
-    scalars.along_step_neutral_action = along_step_neutral->action_id();
     if (!scalars.along_step_user_action)
     {
         // Use newly created neutral action by default
@@ -231,6 +261,11 @@ CoreParams::CoreParams(Input input) : input_(std::move(input))
     CP_VALIDATE_INPUT(output_reg);
     CP_VALIDATE_INPUT(max_streams);
 #undef CP_VALIDATE_INPUT
+    CELER_VALIDATE(input_.host_scheduling == HostScheduling::serial
+                       || input_.host_scheduling == HostScheduling::pool
+                       || CELERITAS_USE_OPENMP,
+                   << "host scheduling '" << to_cstring(input_.host_scheduling)
+                   << "' requires OpenMP");
 
     CELER_EXPECT(input_);
 
@@ -271,6 +306,8 @@ CoreParams::CoreParams(Input input) : input_(std::move(input))
         case TrackOrder::reindex_step_limit_action:
         case TrackOrder::reindex_along_step_action:
         case TrackOrder::reindex_particle_type:
+        case TrackOrder::reindex_spatial:
+        case TrackOrder::reindex_position:
             // Sort with just the given track order
             insert_sort_tracks_action(track_order);
             break;
@@ -279,6 +316,11 @@ CoreParams::CoreParams(Input input) : input_(std::move(input))
             insert_sort_tracks_action(TrackOrder::reindex_step_limit_action);
             insert_sort_tracks_action(TrackOrder::reindex_along_step_action);
             break;
+        case TrackOrder::reindex_spatial_step_limit_action:
+            // Sort spatially at the start of the step, then stably by action
+            insert_sort_tracks_action(TrackOrder::reindex_spatial);
+            insert_sort_tracks_action(TrackOrder::reindex_step_limit_action);
+            break;
         case TrackOrder::size_:
             CELER_ASSERT_UNREACHABLE();
     }
@@ -341,5 +383,26 @@ CoreParams::CoreParams(Input input) : input_(std::move(input))
     CELER_ENSURE(host_ref_.scalars.max_streams == this->max_streams());
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Persistent host threads for launching actions.
+ *
+ * The pool is created on first use so that device-only runs do not start
+ * host threads. The result is null unless the host scheduling is \c pool .
+ */
+HostWorkerPool* CoreParams::host_pool() const
+{
+    if (input_.host_scheduling != HostScheduling::pool)
+    {
+        return nullptr;
+    }
+    std::call_once(host_pool_flag_, [this] {
+        host_pool_ = std::make_unique<HostWorkerPool>();
+        CELER_LOG(debug) << "Created host worker pool with "
+                         << host_pool_->num_threads() << " threads";
+    });
+    return host_pool_.get();
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
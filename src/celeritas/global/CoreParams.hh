@@ -8,11 +8,13 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 
 #include "corecel/Assert.hh"
 #include "corecel/data/DeviceVector.hh"
 #include "corecel/data/ObserverPtr.hh"
 #include "corecel/data/ParamsDataInterface.hh"
+#include "corecel/sys/HostWorkerPool.hh"
 #include "celeritas/geo/GeoFwd.hh"
 #include "celeritas/random/RngParamsFwd.hh"
 
@@ -86,6 +88,11 @@ class CoreParams final : public ParamsDataInterface<CoreParamsData>
         //! Maximum number of simultaneous threads/tasks per process
         StreamId::size_type max_streams{1};
 
+        //! Distribution of track slots among CPU threads
+        HostScheduling host_scheduling{default_host_scheduling()};
+        //! Run host actions serially with fewer active tracks than this
+        size_type host_serial_threshold{256};
+
         //! True if all params are assigned and valid
         explicit operator bool() const
         {
@@ -136,8 +143,22 @@ class CoreParams final : public ParamsDataInterface<CoreParamsData>
     //! Maximum number of streams
     size_type max_streams() const { return input_.max_streams; }
 
+    //! Distribution of track slots among CPU threads
+    HostScheduling host_scheduling() const { return input_.host_scheduling; }
+
+    //! Run host actions serially with fewer active tracks than this
+    size_type host_serial_threshold() const
+    {
+        return input_.host_serial_threshold;
+    }
+
+    // Persistent host threads (null unless using pool scheduling)
+    HostWorkerPool* host_pool() const;
+
   private:
     Input input_;
+    mutable std::unique_ptr<HostWorkerPool> host_pool_;
+    mutable std::once_flag host_pool_flag_;
     HostRef host_ref_;
     DeviceRef device_ref_;
 
@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "corecel/Config.hh"
+
 #include "corecel/sys/ThreadId.hh"
 #include "celeritas/geo/GeoMaterialView.hh"
 #include "celeritas/geo/GeoTrackView.hh"
@@ -15,6 +17,7 @@
 #include "celeritas/phys/ParticleTrackView.hh"
 #include "celeritas/phys/PhysicsStepView.hh"
 #include "celeritas/phys/PhysicsTrackView.hh"
+#include "celeritas/random/CountingRngEngine.hh"
 #include "celeritas/random/RngEngine.hh"
 #include "celeritas/track/SimTrackView.hh"
 
@@ -37,6 +40,11 @@ class CoreTrackView
     //! \name Type aliases
     using ParamsRef = NativeCRef<CoreParamsData>;
     using StateRef = NativeRef<CoreStateData>;
+#if CELERITAS_SAMPLING_COUNTERS
+    using RngEngine = CountingRngEngine<::celeritas::RngEngine>;
+#else
+    using RngEngine = ::celeritas::RngEngine;
+#endif
     //!@}
 
   public:
@@ -246,10 +254,19 @@ CoreTrackView::make_physics_step_view() const -> PhysicsStepView
 //---------------------------------------------------------------------------//
 /*!
  * Return the RNG engine.
+ *
+ * If sampling counters are enabled, the engine's usage is tallied in the
+ * track's physics step data.
  */
 CELER_FUNCTION auto CoreTrackView::make_rng_engine() const -> RngEngine
 {
+#if CELERITAS_SAMPLING_COUNTERS
+    return RngEngine{
+        ::celeritas::RngEngine{params_.rng, states_.rng, this->track_slot_id()},
+        &states_.physics.sampling_counters[this->track_slot_id()]};
+#else
     return RngEngine{params_.rng, states_.rng, this->track_slot_id()};
+#endif
 }
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,60 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/alongstep/AlongStepNeutralWoodcockAction.cc
+//---------------------------------------------------------------------------//
+#include "AlongStepNeutralWoodcockAction.hh"
+
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "celeritas/global/ActionLauncher.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
+#include "celeritas/global/TrackExecutor.hh"
+#include "celeritas/phys/WoodcockParams.hh"
+
+#include "detail/WoodcockApplier.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with next action ID and majorant data.
+ */
+AlongStepNeutralWoodcockAction::AlongStepNeutralWoodcockAction(
+    ActionId id, SPConstWoodcock woodcock)
+    : id_(id), woodcock_(std::move(woodcock))
+{
+    CELER_EXPECT(id_);
+    CELER_EXPECT(woodcock_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Launch the along-step action on host.
+ */
+void AlongStepNeutralWoodcockAction::step(CoreParams const& params,
+                                          CoreStateHost& state) const
+{
+    auto execute = make_along_step_track_executor(
+        params.ptr<MemSpace::native>(),
+        state.ptr(),
+        this->action_id(),
+        detail::WoodcockApplier{woodcock_->ref<MemSpace::native>()});
+    return launch_action(*this, params, state, execute);
+}
+
+//---------------------------------------------------------------------------//
+#if !CELER_USE_DEVICE
+void AlongStepNeutralWoodcockAction::step(CoreParams const&,
+                                          CoreStateDevice&) const
+{
+    CELER_NOT_CONFIGURED("CUDA OR HIP");
+}
+#endif
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,84 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/alongstep/AlongStepNeutralWoodcockAction.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "corecel/Assert.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/global/ActionInterface.hh"
+
+namespace celeritas
+{
+class WoodcockParams;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Along-step kernel for neutral particles with Woodcock tracking.
+ *
+ * In user-tagged regions, neutral particles sample their distance to
+ * collision from a region-wide majorant cross section and are relocated
+ * directly to the tentative collision point, so that the number of geometry
+ * operations scales with the number of collisions rather than the number of
+ * boundary crossings. Elsewhere this behaves identically to \c
+ * AlongStepNeutralAction .
+ *
+ * When this action is registered, \c CoreParams uses it (rather than a
+ * default \c AlongStepNeutralAction ) for all neutral particles.
+ *
+ * \sa WoodcockParams
+ */
+class AlongStepNeutralWoodcockAction final : public CoreStepActionInterface
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SPConstWoodcock = std::shared_ptr<WoodcockParams const>;
+    //!@}
+
+  public:
+    // Construct with next action ID and majorant data
+    AlongStepNeutralWoodcockAction(ActionId id, SPConstWoodcock woodcock);
+
+    // Launch kernel with host data
+    void step(CoreParams const&, CoreStateHost&) const final;
+
+    // Launch kernel with device data
+    void step(CoreParams const&, CoreStateDevice&) const final;
+
+    //! ID of the model
+    ActionId action_id() const final { return id_; }
+
+    //! Short name for the along-step kernel
+    std::string_view label() const final
+    {
+        return "along-step-neutral-woodcock";
+    }
+
+    //! Short description of the action
+    std::string_view description() const final
+    {
+        return "apply along-step for neutral particles with delta tracking";
+    }
+
+    //! Dependency ordering of the action
+    StepActionOrder order() const final { return StepActionOrder::along; }
+
+    //// ACCESSORS ////
+
+    //! Majorant cross section data
+    SPConstWoodcock const& woodcock() const { return woodcock_; }
+
+  private:
+    ActionId id_;
+    SPConstWoodcock woodcock_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
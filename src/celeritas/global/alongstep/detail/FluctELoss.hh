@@ -55,7 +55,8 @@ class FluctELoss
 
     template<EnergyLossFluctuationModel M>
     inline CELER_FUNCTION Energy
-    sample_energy_loss(EnergyLossHelper const& helper, RngEngine& rng);
+    sample_energy_loss(EnergyLossHelper const& helper,
+                       CoreTrackView::RngEngine& rng);
 };
 
 //---------------------------------------------------------------------------//
@@ -181,7 +182,7 @@ CELER_FUNCTION auto FluctELoss::calc_eloss(CoreTrackView const& track,
 template<EnergyLossFluctuationModel M>
 CELER_FUNCTION auto
 FluctELoss::sample_energy_loss(EnergyLossHelper const& helper,
-                               RngEngine& rng) -> Energy
+                               CoreTrackView::RngEngine& rng) -> Energy
 {
     CELER_EXPECT(helper.model() == M);
 
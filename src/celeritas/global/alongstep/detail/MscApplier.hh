@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "corecel/Config.hh"
+
 #include "celeritas/global/CoreTrackView.hh"
 
 namespace celeritas
@@ -53,7 +55,15 @@ CELER_FUNCTION void MscApplier<MH>::operator()(CoreTrackView const& track)
     {
         // Scatter the track and transform the "geometrical" step back to
         // "physical" step
+#if CELERITAS_SAMPLING_COUNTERS
+        auto step = track.make_physics_step_view();
+        step.sampling_counters() = {};
+        msc.apply_step(track);
+        step.msc_sampling() = {track.make_sim_view().along_step_action(),
+                               step.sampling_counters()};
+#else
         msc.apply_step(track);
+#endif
     }
 }
 
@@ -15,7 +15,7 @@ namespace detail
 {
 //---------------------------------------------------------------------------//
 /*!
- * Update the lab frame time.
+ * Update the lab frame time and the track length.
  */
 struct TimeUpdater
 {
@@ -33,6 +33,8 @@ CELER_FUNCTION void TimeUpdater::operator()(CoreTrackView const& track)
     if (sim.status() == TrackStatus::errored)
         return;
 
+    sim.add_track_length(sim.step_length());
+
     auto particle = track.make_particle_view();
     real_type speed = native_value_from(particle.speed());
     CELER_ASSERT(speed >= 0);
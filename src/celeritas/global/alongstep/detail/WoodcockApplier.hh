@@ -0,0 +1,259 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/alongstep/detail/WoodcockApplier.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/math/ArrayUtils.hh"
+#include "celeritas/field/LinearPropagator.hh"
+#include "celeritas/global/CoreTrackView.hh"
+#include "celeritas/grid/XsCalculator.hh"
+#include "celeritas/phys/PhysicsStepUtils.hh"
+#include "celeritas/phys/WoodcockData.hh"
+#include "celeritas/random/distribution/GenerateCanonical.hh"
+
+#include "LinearPropagatorFactory.hh"
+#include "PropagationApplier.hh"
+#include "TimeUpdater.hh"
+#include "TrackUpdater.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Apply a Woodcock (delta) tracking step to a neutral particle.
+ *
+ * Inside a tagged region, the distance to the next collision is sampled using
+ * the region-wide majorant cross section, and the track is relocated directly
+ * to the tentative collision point without navigating to any intermediate
+ * boundaries. The collision is real with probability \f$ \Sigma(x) /
+ * \Sigma_\mathrm{maj} \f$, in which case the usual discrete interaction is
+ * selected; otherwise it is fictitious and the track continues with a newly
+ * sampled distance. Fictitious collisions are marked with the physics
+ * "integral rejection" action since they are handled identically.
+ *
+ * The tentative collision is only accepted if the straight flight to it stays
+ * inside the region: for regions not declared convex, the flight is
+ * navigated through the region's internal boundaries to check that no other
+ * volume (whose cross section may exceed the majorant) is traversed.
+ *
+ * Delta tracking only starts from points in the interior of a volume: a
+ * track on a boundary (e.g. just having entered the region) is transported
+ * conventionally for that step, so the starting point can always be
+ * relocated unambiguously. If the tentative collision point lies outside the
+ * starting region, or the flight to it leaves the region, no collision (real
+ * or fictitious) occurred inside the region; the track is then returned to
+ * its starting point and moved conventionally up to the next boundary, which
+ * is unbiased due to the memorylessness of the exponential distribution.
+ *
+ * Tracks outside of any region, or of a particle type without a majorant,
+ * use the standard neutral along-step algorithm.
+ */
+struct WoodcockApplier
+{
+    //// TYPES ////
+
+    using ParamsRef = NativeCRef<WoodcockParamsData>;
+
+    //// DATA ////
+
+    ParamsRef params;
+
+    //// METHODS ////
+
+    inline CELER_FUNCTION void operator()(CoreTrackView& track) const;
+
+  private:
+    inline CELER_FUNCTION real_type
+    calc_majorant(CoreTrackView const& track, WoodcockRegionId region) const;
+
+    inline CELER_FUNCTION bool is_path_in_region(CoreTrackView& track,
+                                                 Real3 const& start_pos,
+                                                 real_type distance,
+                                                 WoodcockRegionId region) const;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+CELER_FUNCTION void WoodcockApplier::operator()(CoreTrackView& track) const
+{
+    auto sim = track.make_sim_view();
+    auto geo = track.make_geo_view();
+
+    WoodcockRegionId region;
+    real_type majorant = 0;
+    if (!geo.is_on_boundary()
+        && sim.post_step_action()
+               == track.make_physics_view().scalars().discrete_action())
+    {
+        region = params.volume_region[geo.volume_id()];
+        majorant = this->calc_majorant(track, region);
+    }
+
+    if (!(majorant > 0))
+    {
+        // Use conventional transport
+        PropagationApplier{LinearPropagatorFactory{}}(track);
+        TimeUpdater{}(track);
+        TrackUpdater{}(track);
+        return;
+    }
+
+    // Replace the local step limit with the distance to the next tentative
+    // collision
+    real_type const step = [&track, majorant] {
+        auto phys = track.make_physics_view();
+        CELER_ASSERT(phys.has_interaction_mfp());
+        return phys.interaction_mfp() / majorant;
+    }();
+    Real3 const start_pos = geo.pos();
+    Real3 const dir = geo.dir();
+
+    // Locate the tentative collision point
+    Real3 pos = start_pos;
+    axpy(step, dir, &pos);
+    geo = GeoTrackInitializer{pos, dir};
+    bool in_region = !geo.failed() && !geo.is_outside()
+                     && params.volume_region[geo.volume_id()] == region;
+    if (in_region && !params.convex[region])
+    {
+        // A non-convex region may be left and reentered along the flight
+        in_region = this->is_path_in_region(track, start_pos, step, region);
+    }
+
+    if (in_region)
+    {
+        // Update the material at the collision point: all volumes in a
+        // region are guaranteed to have a material
+        MaterialId matid
+            = track.make_geo_material_view().material_id(geo.volume_id());
+        CELER_ASSERT(matid);
+        {
+            auto mat = track.make_material_view();
+            mat = {matid};
+        }
+        sim.step_length(step);
+        TimeUpdater{}(track);
+
+        // Calculate the true cross sections at the collision point
+        auto mat = track.make_material_view();
+        auto particle = track.make_particle_view();
+        auto phys = track.make_physics_view();
+        auto pstep = track.make_physics_step_view();
+        calc_physics_step_limit(mat, particle, phys, pstep);
+
+        auto rng = track.make_rng_engine();
+        if (generate_canonical(rng) * majorant < pstep.macro_xs())
+        {
+            // Real collision: sample the discrete interaction
+            sim.post_step_action(phys.scalars().discrete_action());
+        }
+        else
+        {
+            // Fictitious collision: resample the distance at the next step
+            phys.reset_interaction_mfp();
+            sim.post_step_action(phys.scalars().integral_rejection_action());
+        }
+    }
+    else
+    {
+        // The flight to the tentative collision leaves the region, so no
+        // collision occurs before reaching the region boundary: return to
+        // the start and move conventionally to the next boundary
+        geo = GeoTrackInitializer{start_pos, dir};
+        if (CELER_UNLIKELY(geo.failed()))
+        {
+            track.apply_errored();
+            return;
+        }
+        Propagation p = LinearPropagator{geo}(step);
+        sim.step_length(p.distance);
+        TimeUpdater{}(track);
+
+        auto phys = track.make_physics_view();
+        real_type mfp = phys.interaction_mfp() - p.distance * majorant;
+        if (p.boundary && mfp > 0)
+        {
+            phys.interaction_mfp(mfp);
+            sim.post_step_action(track.boundary_action());
+        }
+        else
+        {
+            // Reached the tentative collision point without crossing a
+            // boundary due to roundoff: treat it as a fictitious collision
+            phys.reset_interaction_mfp();
+            sim.post_step_action(
+                p.boundary ? track.boundary_action()
+                           : phys.scalars().integral_rejection_action());
+        }
+    }
+
+    sim.increment_num_steps();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the majorant cross section for the track in the given region.
+ *
+ * This returns zero if the track is not delta-tracked in the region.
+ */
+CELER_FUNCTION real_type WoodcockApplier::calc_majorant(
+    CoreTrackView const& track, WoodcockRegionId region) const
+{
+    if (!region)
+    {
+        return 0;
+    }
+    auto particle = track.make_particle_view();
+    XsGridData const& grid = params.majorant(region, particle.particle_id());
+    if (!grid)
+    {
+        return 0;
+    }
+    return XsCalculator{grid, params.reals}(particle.energy());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether a straight flight from the start point stays inside a region.
+ *
+ * The track is moved from the start point through every boundary along the
+ * flight. On success, it is left at the end of the flight.
+ */
+CELER_FUNCTION bool
+WoodcockApplier::is_path_in_region(CoreTrackView& track,
+                                   Real3 const& start_pos,
+                                   real_type distance,
+                                   WoodcockRegionId region) const
+{
+    auto geo = track.make_geo_view();
+    geo = GeoTrackInitializer{start_pos, geo.dir()};
+    while (!geo.failed() && distance > 0)
+    {
+        Propagation p = LinearPropagator{geo}(distance);
+        if (!p.boundary)
+        {
+            break;
+        }
+        distance -= p.distance;
+        geo.cross_boundary();
+        if (geo.failed() || geo.is_outside()
+            || params.volume_region[geo.volume_id()] != region)
+        {
+            return false;
+        }
+    }
+    return !geo.failed();
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,144 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/detail/HostScheduler.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Types.hh"
+#include "corecel/math/Algorithms.hh"
+#include "corecel/sys/HostWorkerPool.hh"
+#include "celeritas/Types.hh"
+
+#ifdef _OPENMP
+#    include <omp.h>
+#endif
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+//! Minimum number of track slots in a dynamically scheduled chunk
+inline constexpr size_type min_chunk_size = 64;
+//! Target number of chunks per thread, for load balancing
+inline constexpr size_type chunks_per_thread = 8;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the number of track slots per dynamically scheduled chunk.
+ */
+inline size_type calc_chunk_size(size_type size, size_type num_threads)
+{
+    CELER_EXPECT(num_threads > 0);
+    return celeritas::max(min_chunk_size,
+                          ceil_div(size, chunks_per_thread * num_threads));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Execute chunks of a range of track slots as OpenMP tasks.
+ *
+ * The encountering thread waits for all chunks to complete, executing its own
+ * chunks while other threads in the team may steal the rest. Because tasks
+ * are tied, a thread waiting on one stream's chunks can only execute chunks
+ * from that same stream, so a thread never transports two events at once.
+ *
+ * If not called from inside a parallel region, a new team is created so that
+ * the chunks are still executed concurrently.
+ */
+template<class F>
+void launch_host_tasks(size_type size, F const& execute_range)
+{
+    size_type num_threads = 1;
+#ifdef _OPENMP
+    num_threads = omp_in_parallel() ? omp_get_num_threads()
+                                    : omp_get_max_threads();
+#endif
+    size_type const chunk_size = calc_chunk_size(size, num_threads);
+
+    // Tasks capture local variables by value
+    F const* execute_ptr = &execute_range;
+    auto spawn_tasks = [execute_ptr, size, chunk_size] {
+#ifdef _OPENMP
+#    pragma omp taskgroup
+#endif
+        {
+            for (size_type begin = 0; begin < size; begin += chunk_size)
+            {
+                size_type end = celeritas::min(begin + chunk_size, size);
+#ifdef _OPENMP
+#    pragma omp task
+#endif
+                (*execute_ptr)(begin, end);
+            }
+        }
+    };
+
+#ifdef _OPENMP
+    if (!omp_in_parallel())
+    {
+#    pragma omp parallel
+#    pragma omp single
+        spawn_tasks();
+        return;
+    }
+#endif
+    spawn_tasks();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Execute a range of track slots on CPU threads.
+ *
+ * The functor is called with half-open [begin, end) ranges of thread
+ * indices that together cover [0, size). The worker pool is only used (and
+ * required) for the \c pool strategy.
+ */
+template<class F>
+void launch_host(HostScheduling sched,
+                 HostWorkerPool* pool,
+                 size_type size,
+                 F const& execute_range)
+{
+    switch (sched)
+    {
+        case HostScheduling::serial:
+            execute_range(size_type{0}, size);
+            return;
+        case HostScheduling::parallel:
+#ifdef _OPENMP
+#    pragma omp parallel
+            {
+                // Statically partition the slots among the threads
+                size_type num_threads = omp_get_num_threads();
+                size_type thread = omp_get_thread_num();
+                size_type chunk_size = ceil_div(size, num_threads);
+                size_type begin = celeritas::min(thread * chunk_size, size);
+                size_type end = celeritas::min(begin + chunk_size, size);
+                execute_range(begin, end);
+            }
+#else
+            execute_range(size_type{0}, size);
+#endif
+            return;
+        case HostScheduling::task:
+            launch_host_tasks(size, execute_range);
+            return;
+        case HostScheduling::pool:
+            CELER_ASSERT(pool);
+            (*pool)(size,
+                    calc_chunk_size(size, pool->num_threads()),
+                    execute_range);
+            return;
+        default:
+            CELER_ASSERT_UNREACHABLE();
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
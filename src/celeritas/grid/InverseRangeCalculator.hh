@@ -45,8 +45,9 @@ class InverseRangeCalculator
     //!@{
     //! \name Type aliases
     using Energy = Quantity<XsGridData::EnergyUnits>;
-    using Values
-        = Collection<real_type, Ownership::const_reference, MemSpace::native>;
+    using Values = Collection<table_real_type,
+                              Ownership::const_reference,
+                              MemSpace::native>;
     //!@}
 
   public:
@@ -59,7 +60,7 @@ class InverseRangeCalculator
 
   private:
     UniformGrid log_energy_;
-    NonuniformGrid<real_type> range_;
+    NonuniformGrid<table_real_type> range_;
 };
 
 //---------------------------------------------------------------------------//
@@ -96,10 +97,11 @@ InverseRangeCalculator::operator()(real_type range) const -> Energy
                       * ipow<2>(range / range_.front())};
     }
     // Range should *never* exceed the longest range (highest energy) since
-    // that should have limited the step
-    if (CELER_UNLIKELY(range >= range_.back()))
+    // that should have limited the step; compare at the table precision so
+    // that a range just below the end doesn't round up to the last point
+    if (CELER_UNLIKELY(static_cast<table_real_type>(range) >= range_.back()))
     {
-        CELER_ASSERT(range == range_.back());
+        CELER_ASSERT(static_cast<table_real_type>(range) == range_.back());
         return Energy{std::exp(log_energy_.back())};
     }
 
@@ -7,7 +7,13 @@
 //---------------------------------------------------------------------------//
 #include "ValueGridInserter.hh"
 
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
 #include "corecel/Types.hh"
+#include "corecel/io/Join.hh"
+#include "corecel/io/Logger.hh"
 
 #include "XsGridData.hh"
 
@@ -16,10 +22,14 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 /*!
  * Construct with a reference to mutable host data.
+ *
+ * The optional deviation pointer accumulates the maximum relative error from
+ * converting the inserted values to the table storage precision.
  */
 ValueGridInserter::ValueGridInserter(RealCollection* real_data,
-                                     XsGridCollection* xs_grid)
-    : values_(real_data), xs_grids_(xs_grid)
+                                     XsGridCollection* xs_grid,
+                                     double* max_deviation)
+    : values_(real_data), xs_grids_(xs_grid), max_deviation_(max_deviation)
 {
     CELER_EXPECT(real_data && xs_grid);
 }
@@ -41,6 +51,19 @@ auto ValueGridInserter::operator()(UniformGridData const& log_grid,
     grid.log_energy = log_grid;
     grid.prime_index = prime_index;
     grid.value = values_.insert_back(values.begin(), values.end());
+
+    if (max_deviation_)
+    {
+        for (double v : values)
+        {
+            if (v != 0)
+            {
+                double stored = static_cast<table_real_type>(v);
+                *max_deviation_
+                    = std::max(*max_deviation_, std::fabs(stored / v - 1));
+            }
+        }
+    }
     return xs_grids_.push_back(grid);
 }
 
@@ -54,5 +77,30 @@ auto ValueGridInserter::operator()(UniformGridData const& log_grid,
     return (*this)(log_grid, XsGridData::no_scaling(), values);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Log the table deviations if tables are stored at reduced precision.
+ *
+ * This is used by params classes that have no diagnostic output of their own.
+ */
+void log_table_deviation(char const* label, TableDeviation const& deviation)
+{
+    if constexpr (!std::is_same_v<table_real_type, double>)
+    {
+        if (deviation.empty())
+        {
+            return;
+        }
+        CELER_LOG(info) << "Maximum relative error of reduced-precision "
+                        << label << " tables: "
+                        << join_stream(deviation.begin(),
+                                       deviation.end(),
+                                       ", ",
+                                       [](std::ostream& os, auto const& kv) {
+                                           os << kv.first << '=' << kv.second;
+                                       });
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <map>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -21,6 +23,10 @@
 
 namespace celeritas
 {
+//---------------------------------------------------------------------------//
+//! Maximum relative error of reduced-precision storage for each named table
+using TableDeviation = std::map<std::string, double>;
+
 //---------------------------------------------------------------------------//
 /*!
  * Manage data and help construction of physics value grids.
@@ -30,6 +36,11 @@ namespace celeritas
  * ValueGridXsBuilder::build method taking an instance of this class) it can be
  * extended to build additional grid types as well.
  *
+ * The values are converted to \c table_real_type on insertion. If a
+ * deviation pointer is given, the maximum relative difference between the
+ * input and stored values is accumulated into it so that the loss of
+ * precision from reduced-precision tables can be reported.
+ *
  * \code
     ValueGridInserter insert(&data.host.values, &data.host.grids);
     insert(uniform_grid, values);
@@ -43,7 +54,7 @@ class ValueGridInserter
     //!@{
     //! \name Type aliases
     using RealCollection
-        = Collection<real_type, Ownership::value, MemSpace::host>;
+        = Collection<table_real_type, Ownership::value, MemSpace::host>;
     using XsGridCollection
         = Collection<XsGridData, Ownership::value, MemSpace::host>;
     using SpanConstDbl = Span<double const>;
@@ -52,7 +63,9 @@ class ValueGridInserter
 
   public:
     // Construct with a reference to mutable host data
-    ValueGridInserter(RealCollection* real_data, XsGridCollection* xs_grid);
+    ValueGridInserter(RealCollection* real_data,
+                      XsGridCollection* xs_grid,
+                      double* max_deviation = nullptr);
 
     // Add a grid of xs-like data
     XsIndex operator()(UniformGridData const& log_grid,
@@ -63,9 +76,17 @@ class ValueGridInserter
     XsIndex operator()(UniformGridData const& log_grid, SpanConstDbl values);
 
   private:
-    CollectionBuilder<real_type, MemSpace::host, ItemId<real_type>> values_;
+    CollectionBuilder<table_real_type, MemSpace::host, ItemId<table_real_type>>
+        values_;
     CollectionBuilder<XsGridData, MemSpace::host, ItemId<XsGridData>> xs_grids_;
+    double* max_deviation_;
 };
 
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+// Log the table deviations if tables are stored at reduced precision
+void log_table_deviation(char const* label, TableDeviation const& deviation);
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
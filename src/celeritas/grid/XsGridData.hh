@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "corecel/Config.hh"
+
 #include "corecel/Types.hh"
 #include "corecel/data/Collection.hh"
 #include "corecel/grid/UniformGridData.hh"
@@ -15,6 +17,16 @@
 
 namespace celeritas
 {
+//---------------------------------------------------------------------------//
+#if CELERITAS_TABLE_REAL_TYPE == CELERITAS_TABLE_REAL_TYPE_DOUBLE
+//! Storage type for tabulated physics grid values
+using table_real_type = double;
+#elif CELERITAS_TABLE_REAL_TYPE == CELERITAS_TABLE_REAL_TYPE_FLOAT
+using table_real_type = float;
+#else
+using table_real_type = void;
+#endif
+
 //---------------------------------------------------------------------------//
 /*!
  * Parameterization of a discrete scalar field on a given 1D grid.
@@ -24,6 +36,11 @@ namespace celeritas
  *
  * Interpolation is linear-linear after transforming to log-E space and before
  * scaling the value by E (if the grid point is above prime_index).
+ *
+ * The values are stored as \c table_real_type, which may be lower precision
+ * than \c real_type (see \c CELERITAS_TABLE_REAL_TYPE) to reduce the memory
+ * footprint of the physics tables. Calculators always interpolate using
+ * \c real_type.
  */
 struct XsGridData
 {
@@ -38,7 +55,7 @@ struct XsGridData
 
     UniformGridData log_energy;
     size_type prime_index{no_scaling()};
-    ItemRange<real_type> value;
+    ItemRange<table_real_type> value;
 
     //! Whether the interface is initialized and valid
     explicit CELER_FUNCTION operator bool() const
@@ -38,6 +38,11 @@ class AtomicRelaxationReader
     // Read the data for the given element
     result_type operator()(AtomicNumber atomic_number) const;
 
+    //! Directory containing the EADL radiative transition data
+    std::string const& fluor_path() const { return fluor_path_; }
+    //! Directory containing the EADL non-radiative transition data
+    std::string const& auger_path() const { return auger_path_; }
+
   private:
     // Directory containing the EADL radiative transition data
     std::string fluor_path_;
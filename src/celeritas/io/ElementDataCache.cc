@@ -0,0 +1,571 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/ElementDataCache.cc
+//---------------------------------------------------------------------------//
+#include "ElementDataCache.hh"
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <random>
+#include <type_traits>
+#include <utility>
+
+#include "corecel/Config.hh"
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/math/HashUtils.hh"
+#include "corecel/sys/Environment.hh"
+#include "corecel/sys/MultiExceptionHandler.hh"
+#include "corecel/sys/Stopwatch.hh"
+
+#include "AtomicRelaxationReader.hh"
+#include "LivermorePEReader.hh"
+#include "SeltzerBergerReader.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// FILE FORMAT
+//---------------------------------------------------------------------------//
+//! Format version: increment when the layout of any cached data changes
+constexpr std::uint32_t format_version = 2;
+
+//! Identifier at the start of every cache file
+constexpr char format_magic[8] = {'C', 'E', 'L', 'E', 'R', 'E', 'L', 'D'};
+
+//! File header
+struct Header
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t atomic_number;
+    std::uint64_t source_hash;
+    std::uint64_t payload_size;
+};
+static_assert(sizeof(Header) == 32, "unexpected header padding");
+
+//---------------------------------------------------------------------------//
+/*!
+ * Append data to a binary payload.
+ *
+ * Integers are stored as 64-bit values so that every field is aligned.
+ */
+class BinaryWriter
+{
+  public:
+    template<class T>
+    void integer(T& value)
+    {
+        this->append(static_cast<std::int64_t>(value));
+    }
+
+    void real(double& value) { this->append(value); }
+
+    void reals(std::vector<double>& values)
+    {
+        this->size(values);
+        this->append_bytes(values.data(), values.size() * sizeof(double));
+    }
+
+    template<class T>
+    void size(std::vector<T>& values)
+    {
+        this->append(static_cast<std::int64_t>(values.size()));
+    }
+
+    std::vector<char> const& data() const { return data_; }
+
+  private:
+    std::vector<char> data_;
+
+    template<class T>
+    void append(T value)
+    {
+        this->append_bytes(&value, sizeof(T));
+    }
+
+    void append_bytes(void const* src, std::size_t count)
+    {
+        auto const* begin = static_cast<char const*>(src);
+        data_.insert(data_.end(), begin, begin + count);
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Extract data from a binary payload, checking for truncation.
+ */
+class BinaryReader
+{
+  public:
+    explicit BinaryReader(Span<char const> data) : data_(data) {}
+
+    template<class T>
+    void integer(T& value)
+    {
+        value = static_cast<T>(this->extract<std::int64_t>());
+    }
+
+    void real(double& value) { value = this->extract<double>(); }
+
+    void reals(std::vector<double>& values)
+    {
+        this->size(values);
+        this->extract_bytes(values.data(), values.size() * sizeof(double));
+    }
+
+    template<class T>
+    void size(std::vector<T>& values)
+    {
+        auto size = this->extract<std::int64_t>();
+        // Every element uses at least one 8-byte field
+        CELER_VALIDATE(size >= 0
+                           && static_cast<std::size_t>(size)
+                                  <= this->remaining() / sizeof(std::int64_t),
+                       << "invalid array size " << size);
+        values.resize(size);
+    }
+
+    //! Whether the entire payload has been read
+    bool finished() const { return pos_ == data_.size(); }
+
+  private:
+    Span<char const> data_;
+    std::size_t pos_{0};
+
+    std::size_t remaining() const { return data_.size() - pos_; }
+
+    template<class T>
+    T extract()
+    {
+        T result;
+        this->extract_bytes(&result, sizeof(T));
+        return result;
+    }
+
+    void extract_bytes(void* dst, std::size_t count)
+    {
+        CELER_VALIDATE(count <= this->remaining(), << "truncated data");
+        if (count > 0)
+        {
+            std::memcpy(dst, data_.data() + pos_, count);
+        }
+        pos_ += count;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// SERIALIZATION
+//---------------------------------------------------------------------------//
+template<class Ar>
+void serialize(Ar& ar, ImportPhysicsVector& v)
+{
+    ar.integer(v.vector_type);
+    ar.reals(v.x);
+    ar.reals(v.y);
+}
+
+template<class Ar>
+void serialize(Ar& ar, ImportPhysics2DVector& v)
+{
+    ar.reals(v.x);
+    ar.reals(v.y);
+    ar.reals(v.value);
+}
+
+template<class Ar>
+void serialize(Ar& ar, ImportLivermorePE& v)
+{
+    serialize(ar, v.xs_lo);
+    serialize(ar, v.xs_hi);
+    ar.real(v.thresh_lo);
+    ar.real(v.thresh_hi);
+    ar.size(v.shells);
+    for (auto& shell : v.shells)
+    {
+        ar.real(shell.binding_energy);
+        ar.reals(shell.param_lo);
+        ar.reals(shell.param_hi);
+        ar.reals(shell.xs);
+        ar.reals(shell.energy);
+    }
+}
+
+template<class Ar>
+void serialize(Ar& ar, std::vector<ImportAtomicTransition>& transitions)
+{
+    ar.size(transitions);
+    for (auto& t : transitions)
+    {
+        ar.integer(t.initial_shell);
+        ar.integer(t.auger_shell);
+        ar.real(t.probability);
+        ar.real(t.energy);
+    }
+}
+
+template<class Ar>
+void serialize(Ar& ar, ImportAtomicRelaxation& v)
+{
+    ar.size(v.shells);
+    for (auto& shell : v.shells)
+    {
+        ar.integer(shell.designator);
+        serialize(ar, shell.fluor);
+        serialize(ar, shell.auger);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// READER TRAITS
+//---------------------------------------------------------------------------//
+//! Label and data source for each reader
+std::pair<char const*, std::string> get_source(LivermorePEReader const& r)
+{
+    return {"livermore-pe", r.path()};
+}
+
+std::pair<char const*, std::string> get_source(SeltzerBergerReader const& r)
+{
+    return {"seltzer-berger", r.path()};
+}
+
+std::pair<char const*, std::string>
+get_source(AtomicRelaxationReader const& r)
+{
+    return {"atomic-relaxation", r.fluor_path() + ':' + r.auger_path()};
+}
+
+//! Files read by each reader for a single element
+std::vector<std::string>
+get_source_files(LivermorePEReader const& r, AtomicNumber z)
+{
+    std::string const z_str = std::to_string(z.unchecked_get()) + ".dat";
+    std::vector<std::string> result;
+    for (char const* prefix :
+         {"/pe-cs-", "/pe-le-cs-", "/pe-low-", "/pe-high-", "/pe-ss-cs-"})
+    {
+        result.push_back(r.path() + prefix + z_str);
+    }
+    return result;
+}
+
+std::vector<std::string>
+get_source_files(SeltzerBergerReader const& r, AtomicNumber z)
+{
+    return {r.path() + "/br" + std::to_string(z.unchecked_get())};
+}
+
+std::vector<std::string>
+get_source_files(AtomicRelaxationReader const& r, AtomicNumber z)
+{
+    std::string const z_str = std::to_string(z.unchecked_get()) + ".dat";
+    return {r.fluor_path() + "/fl-tr-pr-" + z_str,
+            r.auger_path() + "/au-tr-pr-" + z_str};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Hash the contents of the source files for an element.
+ *
+ * Reading the raw bytes is much cheaper than parsing the ASCII data, and it
+ * invalidates the cache whenever any of the files change, even if the data
+ * directory is the same. A missing file hashes differently from an empty one.
+ */
+std::uint64_t hash_source_files(std::vector<std::string> const& filenames)
+{
+    std::vector<std::size_t> hashes;
+    std::string contents;
+    for (auto const& filename : filenames)
+    {
+        std::ifstream infile(filename, std::ios::in | std::ios::binary);
+        if (!infile)
+        {
+            hashes.push_back(~std::size_t{0});
+            continue;
+        }
+        contents.assign(std::istreambuf_iterator<char>{infile},
+                        std::istreambuf_iterator<char>{});
+        hashes.push_back(
+            hash_as_bytes(Span<char const>{contents.data(), contents.size()}));
+    }
+    return hash_as_bytes(Span<std::size_t const>{hashes.data(), hashes.size()});
+}
+
+//---------------------------------------------------------------------------//
+// FILE I/O
+//---------------------------------------------------------------------------//
+/*!
+ * Load cached data if the file exists and matches the expected source.
+ */
+template<class T>
+std::optional<T> load_cached(std::string const& filename,
+                             AtomicNumber atomic_number,
+                             std::uint64_t source_hash)
+{
+    std::ifstream infile(filename, std::ios::in | std::ios::binary);
+    if (!infile)
+    {
+        return std::nullopt;
+    }
+
+    Header header;
+    infile.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!infile
+        || std::memcmp(header.magic, format_magic, sizeof(format_magic)) != 0
+        || header.version != format_version
+        || header.atomic_number
+               != static_cast<std::uint32_t>(atomic_number.unchecked_get())
+        || header.source_hash != source_hash)
+    {
+        CELER_LOG(debug) << "Ignoring stale element data cache '" << filename
+                         << "'";
+        return std::nullopt;
+    }
+
+    std::vector<char> payload(header.payload_size);
+    infile.read(payload.data(), payload.size());
+    if (!infile)
+    {
+        CELER_LOG(warning) << "Ignoring truncated element data cache '"
+                           << filename << "'";
+        return std::nullopt;
+    }
+
+    T result;
+    try
+    {
+        BinaryReader ar{make_span(payload)};
+        serialize(ar, result);
+        CELER_VALIDATE(ar.finished(), << "unexpected trailing data");
+    }
+    catch (RuntimeError const& e)
+    {
+        CELER_LOG(warning) << "Ignoring corrupt element data cache '"
+                           << filename << "': " << e.details().what;
+        return std::nullopt;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Save data to the cache.
+ *
+ * The data is written to a temporary file and moved into place so that
+ * concurrent jobs never read a partially written file. Failure to write is
+ * not an error.
+ */
+template<class T>
+void save_cached(std::string const& filename,
+                 AtomicNumber atomic_number,
+                 std::uint64_t source_hash,
+                 T data)
+{
+    BinaryWriter ar;
+    serialize(ar, data);
+    auto const& payload = ar.data();
+
+    Header header;
+    std::memcpy(header.magic, format_magic, sizeof(format_magic));
+    header.version = format_version;
+    header.atomic_number = atomic_number.unchecked_get();
+    header.source_hash = source_hash;
+    header.payload_size = payload.size();
+
+    std::string temp_filename
+        = filename + ".tmp" + std::to_string(std::random_device{}());
+    {
+        std::ofstream outfile(temp_filename,
+                              std::ios::out | std::ios::binary);
+        outfile.write(reinterpret_cast<char const*>(&header), sizeof(header));
+        outfile.write(payload.data(), payload.size());
+        if (!outfile)
+        {
+            CELER_LOG(warning) << "Failed to write element data cache '"
+                               << temp_filename << "'";
+            std::remove(temp_filename.c_str());
+            return;
+        }
+    }
+    if (std::rename(temp_filename.c_str(), filename.c_str()) != 0)
+    {
+        CELER_LOG(warning) << "Failed to move element data cache to '"
+                           << filename << "'";
+        std::remove(temp_filename.c_str());
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with a reader, using the environment for the cache directory.
+ */
+template<class Reader>
+CachedElementReader<Reader>::CachedElementReader(Reader read)
+    : CachedElementReader(std::move(read), element_cache_directory())
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with a reader and cache directory.
+ *
+ * An empty directory disables caching.
+ */
+template<class Reader>
+CachedElementReader<Reader>::CachedElementReader(Reader read,
+                                                 std::string directory)
+    : read_(std::move(read)), directory_(std::move(directory))
+{
+    if (!directory_.empty() && directory_.back() == '/')
+    {
+        directory_.pop_back();
+    }
+
+    auto&& [label, source] = get_source(read_);
+    label_ = label;
+    if (!directory_.empty())
+    {
+        CELER_LOG(debug) << "Caching " << label_ << " data from '" << source
+                         << "' in '" << directory_ << "'";
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read the data for the given element.
+ */
+template<class Reader>
+auto CachedElementReader<Reader>::operator()(AtomicNumber atomic_number) const
+    -> result_type
+{
+    return this->read(atomic_number, nullptr);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read the data for multiple elements in parallel.
+ */
+template<class Reader>
+auto CachedElementReader<Reader>::operator()(
+    VecAtomicNumber const& atomic_numbers) const -> MapResult
+{
+    Stopwatch get_time;
+    std::vector<result_type> data(atomic_numbers.size());
+    size_type num_cached = 0;
+
+    MultiExceptionHandler capture_exception;
+#if CELERITAS_USE_OPENMP
+#    pragma omp parallel for schedule(dynamic) reduction(+ : num_cached)
+#endif
+    for (size_type i = 0; i < atomic_numbers.size(); ++i)
+    {
+        bool cached = false;
+        CELER_TRY_HANDLE(data[i] = this->read(atomic_numbers[i], &cached),
+                         capture_exception);
+        num_cached += cached;
+    }
+    log_and_rethrow(std::move(capture_exception));
+
+    {
+        auto msg = CELER_LOG(info);
+        msg << "Loaded " << label_ << " data for " << atomic_numbers.size()
+            << " elements in " << get_time() << " s";
+        if (!directory_.empty())
+        {
+            msg << " (" << num_cached << " from cache)";
+        }
+    }
+
+    MapResult result;
+    for (auto i : range(atomic_numbers.size()))
+    {
+        result.emplace(atomic_numbers[i].unchecked_get(), std::move(data[i]));
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the cache filename for an element.
+ */
+template<class Reader>
+std::string
+CachedElementReader<Reader>::filename(AtomicNumber atomic_number) const
+{
+    return directory_ + '/' + label_ + '-'
+           + std::to_string(atomic_number.unchecked_get()) + ".bin";
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read the data for an element, loading from or saving to the cache.
+ */
+template<class Reader>
+auto CachedElementReader<Reader>::read(AtomicNumber atomic_number,
+                                       bool* cached) const -> result_type
+{
+    CELER_EXPECT(atomic_number);
+
+    if (directory_.empty())
+    {
+        return read_(atomic_number);
+    }
+
+    std::string filename = this->filename(atomic_number);
+    std::uint64_t const source_hash
+        = hash_source_files(get_source_files(read_, atomic_number));
+    if (auto result
+        = load_cached<result_type>(filename, atomic_number, source_hash))
+    {
+        if (cached)
+        {
+            *cached = true;
+        }
+        return std::move(*result);
+    }
+
+    auto result = read_(atomic_number);
+    save_cached(filename, atomic_number, source_hash, result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Get the default element data cache directory from the environment.
+ *
+ * Caching is disabled if \c CELER_ELEMENT_CACHE is unset.
+ */
+std::string const& element_cache_directory()
+{
+    return celeritas::getenv("CELER_ELEMENT_CACHE");
+}
+
+//---------------------------------------------------------------------------//
+// EXPLICIT INSTANTIATION
+//---------------------------------------------------------------------------//
+
+template class CachedElementReader<LivermorePEReader>;
+template class CachedElementReader<SeltzerBergerReader>;
+template class CachedElementReader<AtomicRelaxationReader>;
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
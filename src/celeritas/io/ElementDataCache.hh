@@ -0,0 +1,90 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/ElementDataCache.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "celeritas/phys/AtomicNumber.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Read per-element data through a binary cache.
+ *
+ * The G4EMLOW readers parse several ASCII files for each element, which
+ * dominates the setup time of problems with many elements. This wrapper
+ * stores each parsed element as a compact binary file
+ * \c <directory>/<label>-<Z>.bin and reads it back on later jobs.
+ *
+ * Each file has a 32-byte header (magic string, format version, atomic
+ * number, hash of the contents of the element's source files, and payload
+ * size) followed by the payload, in which every field is 8-byte aligned so
+ * that the payload is loaded with a single read. A file with a mismatched
+ * header is ignored and rewritten, so changing any of the source files
+ * (e.g., a new G4EMLOW version installed in the same place) or the format
+ * invalidates the cache. Files are written to a temporary name and moved
+ * into place so that concurrent jobs can share a cache directory.
+ *
+ * If the cache directory is empty, the data is read directly from the
+ * underlying reader. The default directory is given by the \c
+ * CELER_ELEMENT_CACHE environment variable; it must already exist.
+ *
+ * The reader can be called for a single element, or for a list of elements
+ * which are read in parallel using OpenMP: the latter logs the time spent
+ * loading and the number of elements found in the cache.
+ *
+ * This class is instantiated for \c LivermorePEReader, \c
+ * SeltzerBergerReader, and \c AtomicRelaxationReader.
+ */
+template<class Reader>
+class CachedElementReader
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using result_type = typename Reader::result_type;
+    using VecAtomicNumber = std::vector<AtomicNumber>;
+    using MapResult = std::map<int, result_type>;
+    //!@}
+
+  public:
+    // Construct with a reader, using the environment for the cache directory
+    explicit CachedElementReader(Reader read);
+
+    // Construct with a reader and cache directory
+    CachedElementReader(Reader read, std::string directory);
+
+    // Read the data for the given element
+    result_type operator()(AtomicNumber atomic_number) const;
+
+    // Read the data for multiple elements in parallel
+    MapResult operator()(VecAtomicNumber const& atomic_numbers) const;
+
+    //! Directory for cached data (empty if disabled)
+    std::string const& directory() const { return directory_; }
+
+  private:
+    Reader read_;
+    std::string directory_;
+    char const* label_{nullptr};
+
+    std::string filename(AtomicNumber atomic_number) const;
+    result_type read(AtomicNumber atomic_number, bool* cached) const;
+};
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+// Get the default element data cache directory from the environment
+std::string const& element_cache_directory();
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -7,13 +7,37 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <limits>
 #include <string>
 
 namespace celeritas
 {
+//---------------------------------------------------------------------------//
+/*!
+ * Store the step and track limits applied to tracks in a region.
+ *
+ * These correspond to the attributes of a Geant4 \c G4UserLimits instance.
+ * Unlimited values are infinite (maximums) or zero (minimums).
+ */
+struct ImportUserLimits
+{
+#ifndef SWIG
+    static inline constexpr double inf
+        = std::numeric_limits<double>::infinity();
+#endif
+
+    double max_step{inf};  //!< Maximum step length [len]
+    double max_track_length{inf};  //!< Maximum total track length [len]
+    double max_time{inf};  //!< Maximum global time [time]
+    double min_kinetic_energy{0};  //!< Minimum kinetic energy [MeV]
+    double min_range{0};  //!< Minimum remaining range [len]
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Store region description and attributes.
+ *
+ * The \c limits are only meaningful if \c user_limits is set.
  */
 struct ImportRegion
 {
@@ -21,6 +45,7 @@ struct ImportRegion
     bool field_manager{false};
     bool production_cuts{false};
     bool user_limits{false};
+    ImportUserLimits limits;
 };
 
 //---------------------------------------------------------------------------//
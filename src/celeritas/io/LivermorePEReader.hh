@@ -37,6 +37,9 @@ class LivermorePEReader
     // Read the data for the given element
     result_type operator()(AtomicNumber atomic_number) const;
 
+    //! Directory containing the Livermore photoelectric data
+    std::string const& path() const { return path_; }
+
   private:
     // Directory containing the Livermore photoelectric data
     std::string path_;
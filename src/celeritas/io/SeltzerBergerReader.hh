@@ -44,6 +44,9 @@ class SeltzerBergerReader
     // Read data from ascii for the given element
     result_type operator()(AtomicNumber atomic_number) const;
 
+    //! Directory containing the Seltzer-Berger data
+    std::string const& path() const { return path_; }
+
   private:
     std::string path_;
 };
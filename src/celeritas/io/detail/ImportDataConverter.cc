@@ -64,6 +64,11 @@ void ImportDataConverter::operator()(ImportData* data)
         (*this)(&m);
     }
 
+    for (auto& r : data->regions)
+    {
+        (*this)(&r);
+    }
+
     (*this)(&data->em_params);
 
     data->units = units::NativeTraits::label();
@@ -227,6 +232,18 @@ void ImportDataConverter::operator()(ImportProcess* data)
     }
 }
 
+//---------------------------------------------------------------------------//
+void ImportDataConverter::operator()(ImportRegion* data)
+{
+    CELER_EXPECT(data);
+
+    auto& limits = data->limits;
+    limits.max_step *= len_;
+    limits.max_track_length *= len_;
+    limits.max_time *= time_;
+    limits.min_range *= len_;
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace detail
 }  // namespace celeritas
@@ -23,6 +23,7 @@ struct ImportOpticalModel;
 struct ImportParticle;
 struct ImportPhysicsTable;
 struct ImportProcess;
+struct ImportRegion;
 struct ImportGeoMaterial;
 
 namespace detail
@@ -52,6 +53,7 @@ class ImportDataConverter
     void operator()(ImportParticle* data);
     void operator()(ImportPhysicsTable* data);
     void operator()(ImportProcess* data);
+    void operator()(ImportRegion* data);
     //!@}
 
   private:
@@ -186,6 +186,7 @@ CELER_FUNCTION TrackInitializer CerenkovGenerator::operator()(Generator& rng)
           / (native_value_from(dist_.points[StepPoint::pre].speed)
              + u * real_type(0.5) * native_value_from(delta_speed_));
     photon.time = dist_.time + delta_time;
+    photon.weight = dist_.weight;
     photon.position = dist_.points[StepPoint::pre].pos;
     axpy(u, delta_pos_, &photon.position);
     return photon;
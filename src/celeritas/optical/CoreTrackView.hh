@@ -104,7 +104,7 @@ CELER_FUNCTION CoreTrackView&
 CoreTrackView::operator=(TrackInitializer const& init)
 {
     // Initialiize the sim state
-    this->sim() = SimTrackView::Initializer{init.time};
+    this->sim() = SimTrackView::Initializer{init.time, init.weight};
 
     // Initialize the geometry state
     auto geo = this->geometry();
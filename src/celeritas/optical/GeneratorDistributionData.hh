@@ -44,6 +44,7 @@ struct GeneratorStepData
 struct GeneratorDistributionData
 {
     size_type num_photons{};  //!< Sampled number of photons to generate
+    real_type weight{1};  //!< Physical photons per generated photon
     real_type time{};  //!< Pre-step time
     real_type step_length{};
     units::ElementaryCharge charge;
@@ -53,7 +54,7 @@ struct GeneratorDistributionData
     //! Check whether the data are assigned
     explicit CELER_FUNCTION operator bool() const
     {
-        return num_photons > 0 && step_length > 0 && material;
+        return num_photons > 0 && weight > 0 && step_length > 0 && material;
     }
 };
 
@@ -8,6 +8,7 @@
 #include "OpticalCollector.hh"
 
 #include "corecel/data/AuxParamsRegistry.hh"
+#include "corecel/io/OutputRegistry.hh"  // IWYU pragma: keep
 #include "corecel/sys/ActionRegistry.hh"
 #include "celeritas/global/CoreParams.hh"
 #include "celeritas/track/TrackInitParams.hh"
@@ -17,6 +18,7 @@
 #include "MaterialParams.hh"
 #include "OffloadData.hh"
 #include "ScintillationParams.hh"
+#include "VisibilityLibrary.hh"
 
 #include "detail/CerenkovGeneratorAction.hh"
 #include "detail/CerenkovOffloadAction.hh"
@@ -25,6 +27,7 @@
 #include "detail/OpticalLaunchAction.hh"
 #include "detail/ScintGeneratorAction.hh"
 #include "detail/ScintOffloadAction.hh"
+#include "detail/VisibilityLookupAction.hh"
 
 namespace celeritas
 {
@@ -62,7 +65,8 @@ OpticalCollector::OpticalCollector(CoreParams const& core, Input&& inp)
             actions.next_id(),
             offload_params_->aux_id(),
             inp.material,
-            inp.cerenkov);
+            inp.cerenkov,
+            inp.bunch_size);
         actions.insert(cerenkov_action_);
     }
 
@@ -70,10 +74,26 @@ OpticalCollector::OpticalCollector(CoreParams const& core, Input&& inp)
     {
         // Action to generate scintillation optical distributions
         scint_action_ = std::make_shared<detail::ScintOffloadAction>(
-            actions.next_id(), offload_params_->aux_id(), inp.scintillation);
+            actions.next_id(),
+            offload_params_->aux_id(),
+            inp.scintillation,
+            inp.bunch_size);
         actions.insert(scint_action_);
     }
 
+    if (inp.visibility)
+    {
+        // Tally detected photons in place of the optical tracking loop
+        visibility_action_ = std::make_shared<detail::VisibilityLookupAction>(
+            actions.next_id(),
+            offload_params_->aux_id(),
+            std::move(inp.visibility),
+            core.max_streams());
+        actions.insert(visibility_action_);
+        core.output_reg()->insert(visibility_action_);
+        return;
+    }
+
     if (setup.cerenkov)
     {
         // Action to generate Cerenkov primaries
@@ -137,6 +157,7 @@ AuxId OpticalCollector::offload_aux_id() const
  */
 AuxId OpticalCollector::optical_aux_id() const
 {
+    CELER_EXPECT(launch_action_);
     return launch_action_->aux_id();
 }
 
@@ -25,6 +25,7 @@ namespace optical
 class CerenkovParams;
 class MaterialParams;
 class ScintillationParams;
+class VisibilityLibrary;
 }  // namespace optical
 
 namespace detail
@@ -36,6 +37,7 @@ class OpticalLaunchAction;
 class OffloadParams;
 class ScintOffloadAction;
 class ScintGeneratorAction;
+class VisibilityLookupAction;
 }  // namespace detail
 
 //---------------------------------------------------------------------------//
@@ -51,6 +53,15 @@ class ScintGeneratorAction;
  *
  * The photon stepping loop will then generate optical primaries.
  *
+ * If a visibility library is provided, the generator and launch actions are
+ * replaced by a single action that converts the distributions directly into
+ * the expected number of photons detected by each sensor. The sensor tallies
+ * for each run are written to the main output.
+ *
+ * A bunch size greater than one combines the photons of each distribution
+ * into weighted "macro-photons" that share a sampled wavelength, reducing the
+ * number of optical tracks at the cost of per-photon fluctuations.
+ *
  * The "collector" (TODO: rename?) will "own" the optical state data and
  * optical params since it's the only thing that launches the optical stepping
  * loop.
@@ -66,6 +77,8 @@ class OpticalCollector
     using SPConstMaterial = std::shared_ptr<optical::MaterialParams const>;
     using SPConstScintillation
         = std::shared_ptr<optical::ScintillationParams const>;
+    using SPConstVisibility
+        = std::shared_ptr<optical::VisibilityLibrary const>;
     //!@}
 
     struct Input
@@ -75,6 +88,9 @@ class OpticalCollector
         SPConstCerenkov cerenkov;
         SPConstScintillation scintillation;
 
+        //! Optional lookup library replacing the optical tracking loop
+        SPConstVisibility visibility;
+
         //! Number of steps that have created optical particles
         size_type buffer_capacity{};
 
@@ -84,12 +100,15 @@ class OpticalCollector
         //! Threshold number of initializers for launching optical loop
         size_type auto_flush{};
 
+        //! Maximum number of physical photons per generated optical track
+        size_type bunch_size{1};
+
         //! True if all input is assigned and valid
         explicit operator bool() const
         {
             return material && (scintillation || cerenkov)
-                   && buffer_capacity > 0 && primary_capacity > 0
-                   && auto_flush > 0;
+                   && buffer_capacity > 0 && bunch_size > 0
+                   && (visibility || (primary_capacity > 0 && auto_flush > 0));
         }
     };
 
@@ -114,6 +133,8 @@ class OpticalCollector
         = std::shared_ptr<detail::CerenkovGeneratorAction>;
     using SPScintGenAction = std::shared_ptr<detail::ScintGeneratorAction>;
     using SPLaunchAction = std::shared_ptr<detail::OpticalLaunchAction>;
+    using SPVisibilityAction
+        = std::shared_ptr<detail::VisibilityLookupAction>;
 
     //// DATA ////
 
@@ -125,6 +146,7 @@ class OpticalCollector
     SPCerenkovGenAction cerenkov_gen_action_;
     SPScintGenAction scint_gen_action_;
     SPLaunchAction launch_action_;
+    SPVisibilityAction visibility_action_;
 
     // TODO: tracking loop launch action
 };
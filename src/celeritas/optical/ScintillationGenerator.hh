@@ -194,6 +194,7 @@ CELER_FUNCTION TrackInitializer ScintillationGenerator::operator()(Generator& rn
         } while (RejectionSampler(target)(rng));
         photon.time += scint_time;
     }
+    photon.weight = dist_.weight;
     return photon;
 }
 
@@ -36,6 +36,7 @@ struct SimStateData
     //// DATA ////
 
     Items<real_type> time;  //!< Time elapsed in lab frame since start of event
+    Items<real_type> weight;  //!< Number of physical photons represented
     Items<real_type> step_length;
     Items<TrackStatus> status;
     Items<ActionId> post_step_action;
@@ -45,8 +46,8 @@ struct SimStateData
     //! Check whether the interface is assigned
     explicit CELER_FUNCTION operator bool() const
     {
-        return !time.empty() && !step_length.empty() && !status.empty()
-               && !post_step_action.empty();
+        return !time.empty() && !weight.empty() && !step_length.empty()
+               && !status.empty() && !post_step_action.empty();
     }
 
     //! State size
@@ -58,6 +59,7 @@ struct SimStateData
     {
         CELER_EXPECT(other);
         time = other.time;
+        weight = other.weight;
         step_length = other.step_length;
         status = other.status;
         post_step_action = other.post_step_action;
@@ -75,6 +77,7 @@ inline void resize(SimStateData<Ownership::value, M>* data, size_type size)
     CELER_EXPECT(size > 0);
 
     resize(&data->time, size);
+    resize(&data->weight, size);
     resize(&data->step_length, size);
 
     resize(&data->status, size);
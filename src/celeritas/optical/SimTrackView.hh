@@ -28,6 +28,7 @@ class SimTrackView
     struct Initializer
     {
         real_type time{};
+        real_type weight{1};
     };
 
   public:
@@ -44,6 +45,9 @@ class SimTrackView
     // Add the time change over the step
     inline CELER_FUNCTION void add_time(real_type delta);
 
+    // Update the statistical weight
+    inline CELER_FUNCTION void weight(real_type w);
+
     // Reset step limiter
     inline CELER_FUNCTION void reset_step_limit();
 
@@ -64,6 +68,9 @@ class SimTrackView
     // Time elapsed in the lab frame since the start of the event
     inline CELER_FUNCTION real_type time() const;
 
+    // Number of physical photons represented by this track
+    inline CELER_FUNCTION real_type weight() const;
+
     // Whether the track is alive or inactive or dying
     inline CELER_FUNCTION TrackStatus status() const;
 
@@ -99,6 +106,7 @@ SimTrackView::SimTrackView(NativeRef<SimStateData> const& states,
 CELER_FUNCTION SimTrackView& SimTrackView::operator=(Initializer const& init)
 {
     states_.time[track_slot_] = init.time;
+    states_.weight[track_slot_] = init.weight;
     states_.step_length[track_slot_] = {};
     states_.status[track_slot_] = TrackStatus::initializing;
     states_.post_step_action[track_slot_] = {};
@@ -125,6 +133,19 @@ CELER_FUNCTION void SimTrackView::add_time(real_type delta)
     states_.time[track_slot_] += delta;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Update the statistical weight.
+ *
+ * The weight of a bunched photon is the number of physical photons it
+ * represents.
+ */
+CELER_FUNCTION void SimTrackView::weight(real_type w)
+{
+    CELER_EXPECT(w >= 0);
+    states_.weight[track_slot_] = w;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Reset step limiter at the beginning of a step.
@@ -208,6 +229,15 @@ CELER_FORCEINLINE_FUNCTION real_type SimTrackView::time() const
     return states_.time[track_slot_];
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Number of physical photons represented by this track.
+ */
+CELER_FORCEINLINE_FUNCTION real_type SimTrackView::weight() const
+{
+    return states_.weight[track_slot_];
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Whether the track is inactive, alive, or being killed.
@@ -27,6 +27,7 @@ struct TrackInitializer
     Real3 direction{0, 0, 0};
     Real3 polarization{0, 0, 0};
     real_type time{};
+    real_type weight{1};
     VolumeId volume{};
 };
 
@@ -0,0 +1,48 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/optical/VisibilityData.cc
+//---------------------------------------------------------------------------//
+#include "VisibilityData.hh"
+
+#include "corecel/Assert.hh"
+#include "corecel/data/CollectionAlgorithms.hh"
+#include "corecel/data/CollectionBuilder.hh"
+
+namespace celeritas
+{
+namespace optical
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Resize based on the number of sensors.
+ */
+template<MemSpace M>
+void resize(VisibilityStateData<Ownership::value, M>* state,
+            HostCRef<VisibilityTallyParamsData> const& params,
+            StreamId,
+            size_type num_track_slots)
+{
+    CELER_EXPECT(params);
+    resize(&state->num_detected, params.num_sensors);
+    fill(real_type(0), &state->num_detected);
+    state->num_track_slots = num_track_slots;
+    CELER_ENSURE(*state);
+}
+
+//---------------------------------------------------------------------------//
+
+template void resize(VisibilityStateData<Ownership::value, MemSpace::host>*,
+                     HostCRef<VisibilityTallyParamsData> const&,
+                     StreamId,
+                     size_type);
+template void resize(VisibilityStateData<Ownership::value, MemSpace::device>*,
+                     HostCRef<VisibilityTallyParamsData> const&,
+                     StreamId,
+                     size_type);
+
+//---------------------------------------------------------------------------//
+}  // namespace optical
+}  // namespace celeritas
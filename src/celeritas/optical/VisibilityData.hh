@@ -0,0 +1,170 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/optical/VisibilityData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Array.hh"
+#include "corecel/data/Collection.hh"
+#include "corecel/grid/UniformGridData.hh"
+#include "geocel/Types.hh"
+#include "celeritas/Types.hh"
+
+namespace celeritas
+{
+namespace optical
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Precomputed optical photon visibility on a voxel grid.
+ *
+ * The visibility is the fraction of photons emitted isotropically in a voxel
+ * that are detected by each sensor. Values are stored in single precision,
+ * indexed by [voxel][sensor], where the voxel index is row-major in (x, y, z).
+ */
+template<Ownership W, MemSpace M>
+struct VisibilityParamsData
+{
+    template<class T>
+    using Items = Collection<T, W, M>;
+
+    //// DATA ////
+
+    //! Voxel edges along each axis
+    Array<UniformGridData, 3> grid;
+
+    //! Number of photon sensors
+    DetectorId::size_type num_sensors{0};
+
+    //! Fraction of photons detected [voxel][sensor]
+    Items<float> visibility;
+
+    //// METHODS ////
+
+    //! Number of voxels along an axis
+    CELER_FUNCTION size_type num_voxels(Axis ax) const
+    {
+        return grid[to_int(ax)].size - 1;
+    }
+
+    //! Total number of voxels
+    CELER_FUNCTION size_type num_voxels() const
+    {
+        return this->num_voxels(Axis::x) * this->num_voxels(Axis::y)
+               * this->num_voxels(Axis::z);
+    }
+
+    //! True if assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return grid[0] && grid[1] && grid[2] && num_sensors > 0
+               && visibility.size() == this->num_voxels() * num_sensors;
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    VisibilityParamsData& operator=(VisibilityParamsData<W2, M2> const& other)
+    {
+        CELER_EXPECT(other);
+        grid = other.grid;
+        num_sensors = other.num_sensors;
+        visibility = other.visibility;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Shape of the detected photon tallies.
+ *
+ * This is separate from the visibility table so that the per-stream tally
+ * storage does not keep another copy of the library.
+ */
+template<Ownership W, MemSpace M>
+struct VisibilityTallyParamsData
+{
+    //// DATA ////
+
+    //! Number of photon sensors
+    DetectorId::size_type num_sensors{0};
+
+    //// METHODS ////
+
+    //! True if assigned
+    explicit CELER_FUNCTION operator bool() const { return num_sensors > 0; }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    VisibilityTallyParamsData&
+    operator=(VisibilityTallyParamsData<W2, M2> const& other)
+    {
+        CELER_EXPECT(other);
+        num_sensors = other.num_sensors;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Expected number of detected photons for each sensor.
+ *
+ * Like the simple calorimeter, this is specific to a single stream and
+ * integrated over all steps on that stream until it is reset at the beginning
+ * of the next run.
+ */
+template<Ownership W, MemSpace M>
+struct VisibilityStateData
+{
+    //// TYPES ////
+
+    template<class T>
+    using SensorItems = Collection<T, W, M, DetectorId>;
+
+    //// DATA ////
+
+    //! Mean number of detected photons, indexed by sensor
+    SensorItems<real_type> num_detected;
+
+    //! Number of track slots (unused during calculation)
+    size_type num_track_slots{};
+
+    //// METHODS ////
+
+    //! Number of states
+    CELER_FUNCTION size_type size() const { return num_track_slots; }
+
+    //! True if constructed
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !num_detected.empty() && num_track_slots > 0;
+    }
+
+    //! Assign from another set of states
+    template<Ownership W2, MemSpace M2>
+    VisibilityStateData& operator=(VisibilityStateData<W2, M2>& other)
+    {
+        CELER_EXPECT(other);
+        num_detected = other.num_detected;
+        num_track_slots = other.num_track_slots;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+// Resize based on the number of sensors
+template<MemSpace M>
+void resize(VisibilityStateData<Ownership::value, M>* state,
+            HostCRef<VisibilityTallyParamsData> const& params,
+            StreamId,
+            size_type num_track_slots);
+
+//---------------------------------------------------------------------------//
+}  // namespace optical
+}  // namespace celeritas
@@ -0,0 +1,193 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/optical/VisibilityLibrary.cc
+//---------------------------------------------------------------------------//
+#include "VisibilityLibrary.hh"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "corecel/grid/UniformGrid.hh"
+#include "corecel/io/Logger.hh"
+
+namespace celeritas
+{
+namespace optical
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Binary file header: see class documentation
+struct FileHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t num_sensors;
+    std::uint32_t num_voxels[3];
+    std::uint32_t padding;
+    double lower[3];
+    double upper[3];
+};
+
+static_assert(sizeof(FileHeader) == 80, "unexpected header padding");
+
+constexpr char file_magic[] = "CELERVIS";
+constexpr std::uint32_t file_version = 1;
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tabulate by evaluating the detection efficiency at each voxel center.
+ *
+ * The calculator is typically a wrapper that runs the optical tracking loop
+ * on a batch of isotropic photons emitted from the given point and returns the
+ * fraction of them detected by each sensor.
+ */
+auto VisibilityLibrary::build(Grid const& grid,
+                              DetectorId::size_type num_sensors,
+                              CalcVisibility const& calc_visibility) -> Input
+{
+    CELER_EXPECT(grid[0] && grid[1] && grid[2]);
+    CELER_EXPECT(num_sensors > 0);
+    CELER_EXPECT(calc_visibility);
+
+    Input result;
+    result.grid = grid;
+    result.num_sensors = num_sensors;
+
+    Array<UniformGrid, 3> const edges{
+        UniformGrid{grid[0]}, UniformGrid{grid[1]}, UniformGrid{grid[2]}};
+    for (auto i : range(edges[0].size() - 1))
+    {
+        for (auto j : range(edges[1].size() - 1))
+        {
+            for (auto k : range(edges[2].size() - 1))
+            {
+                Real3 center{(edges[0][i] + edges[0][i + 1]) / 2,
+                             (edges[1][j] + edges[1][j + 1]) / 2,
+                             (edges[2][k] + edges[2][k + 1]) / 2};
+                auto vis = calc_visibility(center);
+                CELER_VALIDATE(vis.size() == num_sensors,
+                               << "visibility calculator returned "
+                               << vis.size() << " sensors (expected "
+                               << num_sensors << ")");
+                result.visibility.insert(
+                    result.visibility.end(), vis.begin(), vis.end());
+            }
+        }
+    }
+
+    CELER_ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from a library file.
+ */
+std::shared_ptr<VisibilityLibrary>
+VisibilityLibrary::from_file(std::string const& filename)
+{
+    std::ifstream infile(filename, std::ios::in | std::ios::binary);
+    CELER_VALIDATE(infile,
+                   << "failed to open visibility library '" << filename
+                   << "'");
+
+    FileHeader header;
+    infile.read(reinterpret_cast<char*>(&header), sizeof(header));
+    CELER_VALIDATE(infile
+                       && std::memcmp(header.magic, file_magic, 8) == 0
+                       && header.version == file_version,
+                   << "'" << filename
+                   << "' is not a compatible visibility library");
+
+    Input input;
+    input.num_sensors = header.num_sensors;
+    std::size_t size = input.num_sensors;
+    for (auto ax : range(3))
+    {
+        CELER_VALIDATE(header.num_voxels[ax] > 0
+                           && header.lower[ax] < header.upper[ax],
+                       << "invalid voxel grid in visibility library '"
+                       << filename << "'");
+        input.grid[ax] = UniformGridData::from_bounds(
+            header.lower[ax], header.upper[ax], header.num_voxels[ax] + 1);
+        size *= header.num_voxels[ax];
+    }
+
+    input.visibility.resize(size);
+    infile.read(reinterpret_cast<char*>(input.visibility.data()),
+                size * sizeof(float));
+    CELER_VALIDATE(infile,
+                   << "visibility library '" << filename
+                   << "' is truncated");
+
+    CELER_LOG(debug) << "Loaded " << size << " visibility values from '"
+                     << filename << "'";
+    return std::make_shared<VisibilityLibrary>(input);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from tabulated visibility.
+ */
+VisibilityLibrary::VisibilityLibrary(Input const& input)
+{
+    CELER_VALIDATE(input, << "invalid visibility library input");
+
+    HostVal<VisibilityParamsData> host_data;
+    host_data.grid = input.grid;
+    host_data.num_sensors = input.num_sensors;
+    make_builder(&host_data.visibility)
+        .insert_back(input.visibility.begin(), input.visibility.end());
+
+    data_ = CollectionMirror<VisibilityParamsData>{std::move(host_data)};
+    CELER_ENSURE(data_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write the library to a file.
+ */
+void VisibilityLibrary::write(std::string const& filename) const
+{
+    auto const& data = this->host_ref();
+
+    FileHeader header{};
+    std::memcpy(header.magic, file_magic, 8);
+    header.version = file_version;
+    header.num_sensors = data.num_sensors;
+    for (auto ax : range(3))
+    {
+        header.num_voxels[ax] = data.grid[ax].size - 1;
+        header.lower[ax] = data.grid[ax].front;
+        header.upper[ax] = data.grid[ax].back;
+    }
+
+    std::ofstream outfile(filename,
+                          std::ios::out | std::ios::binary | std::ios::trunc);
+    CELER_VALIDATE(outfile,
+                   << "failed to open visibility library '" << filename
+                   << "' for writing");
+    outfile.write(reinterpret_cast<char const*>(&header), sizeof(header));
+    auto values = data.visibility[AllItems<float>{}];
+    outfile.write(reinterpret_cast<char const*>(values.data()),
+                  values.size() * sizeof(float));
+    CELER_VALIDATE(outfile,
+                   << "failed to write visibility library '" << filename
+                   << "'");
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace optical
+}  // namespace celeritas
@@ -0,0 +1,115 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/optical/VisibilityLibrary.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "corecel/data/CollectionMirror.hh"
+#include "corecel/data/ParamsDataInterface.hh"
+
+#include "VisibilityData.hh"
+
+namespace celeritas
+{
+namespace optical
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Voxelized optical photon visibility for fast detector simulation.
+ *
+ * A visibility library replaces the optical tracking loop for detectors where
+ * only the number of photons reaching each sensor is of interest: each
+ * Cerenkov or scintillation distribution is converted directly into a mean
+ * number of detected photons using the visibility of the voxel containing the
+ * midpoint of the generating step.
+ *
+ * The library is stored in a compact binary file whose tabulated data can be
+ * memory-mapped directly: an 80-byte header
+ * \code
+   char     magic[8];      // "CELERVIS"
+   uint32_t version;       // 1
+   uint32_t num_sensors;
+   uint32_t num_voxels[3];
+   uint32_t padding;
+   double   lower[3];      // Lower corner [native length]
+   double   upper[3];      // Upper corner [native length]
+ * \endcode
+ * is followed by the \c float visibility array indexed by [voxel][sensor],
+ * all in native byte order.
+ */
+class VisibilityLibrary final : public ParamsDataInterface<VisibilityParamsData>
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using Grid = Array<UniformGridData, 3>;
+    using VecFloat = std::vector<float>;
+    using VecReal = std::vector<real_type>;
+    //! Calculate the fraction of photons detected by each sensor from a point
+    using CalcVisibility = std::function<VecReal(Real3 const&)>;
+    //!@}
+
+    //! Library construction input
+    struct Input
+    {
+        Grid grid;  //!< Voxel edges along each axis
+        DetectorId::size_type num_sensors{0};
+        VecFloat visibility;  //!< [voxel][sensor]
+
+        //! True if the input is consistent
+        explicit operator bool() const
+        {
+            return grid[0] && grid[1] && grid[2] && num_sensors > 0
+                   && visibility.size()
+                          == static_cast<std::size_t>(grid[0].size - 1)
+                                 * (grid[1].size - 1) * (grid[2].size - 1)
+                                 * num_sensors;
+        }
+    };
+
+  public:
+    // Tabulate by evaluating the detection efficiency at each voxel center
+    static Input build(Grid const& grid,
+                       DetectorId::size_type num_sensors,
+                       CalcVisibility const& calc_visibility);
+
+    // Construct from a library file
+    static std::shared_ptr<VisibilityLibrary>
+    from_file(std::string const& filename);
+
+    // Construct from tabulated visibility
+    explicit VisibilityLibrary(Input const& input);
+
+    // Write the library to a file
+    void write(std::string const& filename) const;
+
+    //! Number of sensors
+    DetectorId::size_type num_sensors() const
+    {
+        return this->host_ref().num_sensors;
+    }
+
+    //! Number of voxels
+    size_type num_voxels() const { return this->host_ref().num_voxels(); }
+
+    //! Access data on the host
+    HostRef const& host_ref() const final { return data_.host_ref(); }
+
+    //! Access data on the device
+    DeviceRef const& device_ref() const final { return data_.device_ref(); }
+
+  private:
+    CollectionMirror<VisibilityParamsData> data_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace optical
+}  // namespace celeritas
@@ -34,15 +34,18 @@ namespace detail
 CerenkovOffloadAction::CerenkovOffloadAction(ActionId id,
                                              AuxId data_id,
                                              SPConstMaterial material,
-                                             SPConstCerenkov cerenkov)
+                                             SPConstCerenkov cerenkov,
+                                             size_type bunch_size)
     : id_(id)
     , data_id_{data_id}
     , material_(std::move(material))
     , cerenkov_(std::move(cerenkov))
+    , bunch_size_(bunch_size)
 {
     CELER_EXPECT(id_);
     CELER_EXPECT(data_id_);
     CELER_EXPECT(cerenkov_ && material_);
+    CELER_EXPECT(bunch_size_ > 0);
 }
 
 //---------------------------------------------------------------------------//
@@ -121,7 +124,8 @@ void CerenkovOffloadAction::pre_generate(CoreParams const& core_params,
                           detail::CerenkovOffloadExecutor{material_->host_ref(),
                                                           cerenkov_->host_ref(),
                                                           state.store.ref(),
-                                                          state.buffer_size}};
+                                                          state.buffer_size,
+                                                          bunch_size_}};
     launch_action(*this, core_params, core_state, execute);
 }
 
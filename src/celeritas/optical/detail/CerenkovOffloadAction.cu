@@ -39,7 +39,8 @@ void CerenkovOffloadAction::pre_generate(CoreParams const& core_params,
         detail::CerenkovOffloadExecutor{material_->device_ref(),
                                         cerenkov_->device_ref(),
                                         state.store.ref(),
-                                        state.buffer_size}};
+                                        state.buffer_size,
+                                        bunch_size_}};
     static ActionLauncher<decltype(execute)> const launch_kernel(*this);
     launch_kernel(core_state, execute);
 }
@@ -47,7 +47,8 @@ class CerenkovOffloadAction final : public CoreStepActionInterface
     CerenkovOffloadAction(ActionId id,
                           AuxId data_id,
                           SPConstMaterial material,
-                          SPConstCerenkov cerenkov);
+                          SPConstCerenkov cerenkov,
+                          size_type bunch_size);
 
     // Launch kernel with host data
     void step(CoreParams const&, CoreStateHost&) const final;
@@ -74,6 +75,7 @@ class CerenkovOffloadAction final : public CoreStepActionInterface
     AuxId data_id_;
     SPConstMaterial material_;
     SPConstCerenkov cerenkov_;
+    size_type bunch_size_;
 
     //// HELPER FUNCTIONS ////
 
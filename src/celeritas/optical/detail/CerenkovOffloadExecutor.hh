@@ -13,6 +13,8 @@
 #include "celeritas/optical/CerenkovOffload.hh"
 #include "celeritas/optical/OffloadData.hh"
 
+#include "OpticalUtils.hh"
+
 namespace celeritas
 {
 namespace detail
@@ -32,6 +34,7 @@ struct CerenkovOffloadExecutor
     NativeCRef<celeritas::optical::CerenkovData> const cerenkov;
     NativeRef<OffloadStateData> const state;
     OffloadBufferSize size;
+    size_type bunch_size;
 };
 
 //---------------------------------------------------------------------------//
@@ -77,6 +80,7 @@ CerenkovOffloadExecutor::operator()(CoreTrackView const& track)
 
         CerenkovOffload generate(particle, sim, opt_mat, pos, cerenkov, step);
         cerenkov_dist = generate(rng);
+        bunch_photons(bunch_size, &cerenkov_dist);
     }
 }
 
@@ -14,6 +14,8 @@
 #include "celeritas/Constants.hh"
 #include "celeritas/Quantities.hh"
 
+#include "../GeneratorDistributionData.hh"
+
 namespace celeritas
 {
 namespace optical
@@ -71,6 +73,31 @@ inline CELER_FUNCTION size_type find_distribution_index(Span<size_type> offsets,
     return iter - offsets.begin();
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Combine the photons of a distribution into weighted "macro-photons".
+ *
+ * Each generated track represents up to \c bunch_size physical photons with
+ * the same sampled wavelength. All tracks from the distribution have equal
+ * weight, and the total weight is the sampled number of physical photons.
+ */
+inline CELER_FUNCTION void
+bunch_photons(size_type bunch_size,
+              celeritas::optical::GeneratorDistributionData* dist)
+{
+    CELER_EXPECT(bunch_size > 0);
+    CELER_EXPECT(dist);
+
+    if (bunch_size == 1 || dist->num_photons <= 1)
+    {
+        return;
+    }
+
+    size_type num_tracks = ceil_div(dist->num_photons, bunch_size);
+    dist->weight *= static_cast<real_type>(dist->num_photons) / num_tracks;
+    dist->num_photons = num_tracks;
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace detail
 }  // namespace celeritas
@@ -32,12 +32,17 @@ namespace detail
  */
 ScintOffloadAction::ScintOffloadAction(ActionId id,
                                        AuxId data_id,
-                                       SPConstScintillation scintillation)
-    : id_(id), data_id_{data_id}, scintillation_(std::move(scintillation))
+                                       SPConstScintillation scintillation,
+                                       size_type bunch_size)
+    : id_(id)
+    , data_id_{data_id}
+    , scintillation_(std::move(scintillation))
+    , bunch_size_(bunch_size)
 {
     CELER_EXPECT(id_);
     CELER_EXPECT(data_id_);
     CELER_EXPECT(scintillation_);
+    CELER_EXPECT(bunch_size_ > 0);
 }
 
 //---------------------------------------------------------------------------//
@@ -114,7 +119,10 @@ void ScintOffloadAction::pre_generate(CoreParams const& core_params,
         core_params.ptr<MemSpace::native>(),
         core_state.ptr(),
         detail::ScintOffloadExecutor{
-            scintillation_->host_ref(), state.store.ref(), state.buffer_size}};
+            scintillation_->host_ref(),
+            state.store.ref(),
+            state.buffer_size,
+            bunch_size_}};
     launch_action(*this, core_params, core_state, execute);
 }
 
@@ -38,7 +38,8 @@ void ScintOffloadAction::pre_generate(CoreParams const& core_params,
         core_state.ptr(),
         detail::ScintOffloadExecutor{scintillation_->device_ref(),
                                      state.store.ref(),
-                                     state.buffer_size}};
+                                     state.buffer_size,
+                                     bunch_size_}};
     static ActionLauncher<decltype(execute)> const launch_kernel(*this);
     launch_kernel(core_state, execute);
 }
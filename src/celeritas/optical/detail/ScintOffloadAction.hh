@@ -43,7 +43,8 @@ class ScintOffloadAction final : public CoreStepActionInterface
     // Construct with action ID, optical properties, and storage
     ScintOffloadAction(ActionId id,
                        AuxId data_id,
-                       SPConstScintillation scintillation);
+                       SPConstScintillation scintillation,
+                       size_type bunch_size);
 
     // Launch kernel with host data
     void step(CoreParams const&, CoreStateHost&) const final;
@@ -69,6 +70,7 @@ class ScintOffloadAction final : public CoreStepActionInterface
     ActionId id_;
     AuxId data_id_;
     SPConstScintillation scintillation_;
+    size_type bunch_size_;
 
     //// HELPER FUNCTIONS ////
 
@@ -13,6 +13,8 @@
 #include "celeritas/optical/OffloadData.hh"
 #include "celeritas/optical/ScintillationOffload.hh"
 
+#include "OpticalUtils.hh"
+
 namespace celeritas
 {
 namespace detail
@@ -35,6 +37,7 @@ struct ScintOffloadExecutor
     NativeCRef<celeritas::optical::ScintillationData> const scintillation;
     NativeRef<OffloadStateData> const state;
     OffloadBufferSize size;
+    size_type bunch_size;
 };
 
 //---------------------------------------------------------------------------//
@@ -76,6 +79,7 @@ CELER_FUNCTION void ScintOffloadExecutor::operator()(CoreTrackView const& track)
     ScintillationOffload generate(
         particle, sim, pos, edep, scintillation, step);
     scintillation_dist = generate(rng);
+    bunch_photons(bunch_size, &scintillation_dist);
 }
 
 //---------------------------------------------------------------------------//
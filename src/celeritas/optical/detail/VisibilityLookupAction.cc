@@ -0,0 +1,204 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/optical/detail/VisibilityLookupAction.cc
+//---------------------------------------------------------------------------//
+#include "VisibilityLookupAction.hh"
+
+#include <utility>
+#include <nlohmann/json.hpp>
+
+#include "corecel/Assert.hh"
+#include "corecel/Config.hh"
+#include "corecel/data/AuxStateVec.hh"
+#include "corecel/data/CollectionAlgorithms.hh"
+#include "corecel/io/JsonPimpl.hh"
+#include "corecel/sys/MultiExceptionHandler.hh"
+#include "corecel/sys/ThreadId.hh"
+#include "celeritas/global/CoreState.hh"
+#include "celeritas/optical/VisibilityLibrary.hh"
+
+#include "OffloadParams.hh"
+#include "VisibilityLookupExecutor.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with IDs, visibility library, and number of streams.
+ */
+VisibilityLookupAction::VisibilityLookupAction(ActionId id,
+                                               AuxId offload_id,
+                                               SPConstVisibility visibility,
+                                               size_type num_streams)
+    : action_id_{id}
+    , offload_id_{offload_id}
+    , visibility_{std::move(visibility)}
+{
+    CELER_EXPECT(action_id_);
+    CELER_EXPECT(offload_id_);
+    CELER_EXPECT(visibility_);
+    CELER_EXPECT(num_streams > 0);
+
+    HostVal<celeritas::optical::VisibilityTallyParamsData> host_params;
+    host_params.num_sensors = visibility_->num_sensors();
+    store_ = {std::move(host_params), num_streams};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Descriptive name of the action.
+ */
+std::string_view VisibilityLookupAction::description() const
+{
+    return "tally detected optical photons using a visibility library";
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Reset the host tallies for this stream.
+ */
+void VisibilityLookupAction::begin_run(CoreParams const&, CoreStateHost& state)
+{
+    this->begin_run_impl(state);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Reset the device tallies for this stream.
+ */
+void VisibilityLookupAction::begin_run(CoreParams const&,
+                                       CoreStateDevice& state)
+{
+    this->begin_run_impl(state);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Execute the action with host data.
+ */
+void VisibilityLookupAction::step(CoreParams const& params,
+                                  CoreStateHost& state) const
+{
+    this->step_impl(params, state);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Execute the action with device data.
+ */
+void VisibilityLookupAction::step(CoreParams const& params,
+                                  CoreStateDevice& state) const
+{
+    this->step_impl(params, state);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write output to the given JSON object.
+ */
+void VisibilityLookupAction::output(JsonPimpl* j) const
+{
+    using json = nlohmann::json;
+
+    auto obj = json::object();
+    obj["num_detected"] = this->calc_num_detected();
+    obj["_index"] = {"sensor"};
+
+    j->obj = std::move(obj);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the expected number of detected photons summed over streams.
+ */
+auto VisibilityLookupAction::calc_num_detected() const -> VecReal
+{
+    VecReal result(visibility_->num_sensors(), 0);
+    accumulate_over_streams(
+        store_, [](auto& state) { return state.num_detected; }, &result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Reset the tallies for a stream if they have been allocated.
+ */
+template<MemSpace M>
+void VisibilityLookupAction::begin_run_impl(CoreState<M>& core_state)
+{
+    if (auto* state = store_.state<M>(core_state.stream_id()))
+    {
+        fill(real_type(0), &state->num_detected);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tally and clear the buffered optical distributions.
+ */
+template<MemSpace M>
+void VisibilityLookupAction::step_impl(CoreParams const&,
+                                       CoreState<M>& core_state) const
+{
+    using DistId = ItemId<celeritas::optical::GeneratorDistributionData>;
+    using DistRange = ItemRange<celeritas::optical::GeneratorDistributionData>;
+
+    auto& offload_state
+        = get<OpticalOffloadState<M>>(core_state.aux(), offload_id_);
+    auto& state = store_.state<M>(core_state.stream_id(), core_state.size());
+    auto& offload = offload_state.store.ref();
+    auto& buffer_size = offload_state.buffer_size;
+
+    if (buffer_size.cerenkov > 0)
+    {
+        visibility_lookup(visibility_->ref<M>(),
+                          state,
+                          offload.cerenkov[DistRange{
+                              DistId{0}, DistId{buffer_size.cerenkov}}],
+                          core_state.stream_id());
+    }
+    if (buffer_size.scintillation > 0)
+    {
+        visibility_lookup(visibility_->ref<M>(),
+                          state,
+                          offload.scintillation[DistRange{
+                              DistId{0}, DistId{buffer_size.scintillation}}],
+                          core_state.stream_id());
+    }
+
+    // All buffered photons have been consumed
+    buffer_size = {};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Accumulate detected photons from distributions on host.
+ */
+void visibility_lookup(
+    HostCRef<celeritas::optical::VisibilityParamsData> const& params,
+    HostRef<celeritas::optical::VisibilityStateData>& state,
+    Span<celeritas::optical::GeneratorDistributionData const> distributions,
+    StreamId)
+{
+    CELER_EXPECT(params && state);
+
+    MultiExceptionHandler capture_exception;
+    VisibilityLookupExecutor execute{params, state, distributions};
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#    pragma omp parallel for
+#endif
+    for (ThreadId::size_type i = 0; i < distributions.size(); ++i)
+    {
+        CELER_TRY_HANDLE(execute(ThreadId{i}), capture_exception);
+    }
+    log_and_rethrow(std::move(capture_exception));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
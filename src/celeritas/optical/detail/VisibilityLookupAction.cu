@@ -0,0 +1,39 @@
+//---------------------------------*-CUDA-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/optical/detail/VisibilityLookupAction.cu
+//---------------------------------------------------------------------------//
+#include "VisibilityLookupAction.hh"
+
+#include "corecel/Assert.hh"
+#include "corecel/sys/KernelLauncher.device.hh"
+
+#include "VisibilityLookupExecutor.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Accumulate detected photons from distributions on device.
+ */
+void visibility_lookup(
+    DeviceCRef<celeritas::optical::VisibilityParamsData> const& params,
+    DeviceRef<celeritas::optical::VisibilityStateData>& state,
+    Span<celeritas::optical::GeneratorDistributionData const> distributions,
+    StreamId stream)
+{
+    CELER_EXPECT(params && state);
+
+    VisibilityLookupExecutor execute_thread{params, state, distributions};
+    static KernelLauncher<decltype(execute_thread)> const launch_kernel(
+        "optical-visibility-lookup");
+    launch_kernel(distributions.size(), stream, execute_thread);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,155 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/optical/detail/VisibilityLookupAction.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "corecel/Macros.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/data/AuxInterface.hh"
+#include "corecel/data/StreamStore.hh"
+#include "corecel/io/OutputInterface.hh"
+#include "celeritas/global/ActionInterface.hh"
+#include "celeritas/optical/GeneratorDistributionData.hh"
+#include "celeritas/optical/VisibilityData.hh"
+
+namespace celeritas
+{
+namespace optical
+{
+class VisibilityLibrary;
+}  // namespace optical
+
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Replace the optical tracking loop with a visibility library lookup.
+ *
+ * At the end of each step, all buffered Cerenkov and scintillation
+ * distributions are converted to the expected number of photons detected by
+ * each sensor and the buffers are cleared. The tallies are accumulated per
+ * stream, reset at the beginning of each run, and summed over streams in the
+ * "optical-visibility-lookup" result output.
+ */
+class VisibilityLookupAction final : public CoreStepActionInterface,
+                                     public CoreBeginRunActionInterface,
+                                     public OutputInterface
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SPConstVisibility
+        = std::shared_ptr<celeritas::optical::VisibilityLibrary const>;
+    using VecReal = std::vector<real_type>;
+    using CoreStepActionInterface::CoreStateDevice;
+    using CoreStepActionInterface::CoreStateHost;
+    //!@}
+
+  public:
+    // Construct with IDs, visibility library, and number of streams
+    VisibilityLookupAction(ActionId id,
+                           AuxId offload_id,
+                           SPConstVisibility visibility,
+                           size_type num_streams);
+
+    //!@{
+    //! \name Action/output metadata interface
+    //! Short name for the action
+    std::string_view label() const final
+    {
+        return "optical-visibility-lookup";
+    }
+    // Name of the action (for user output)
+    std::string_view description() const final;
+    //!@}
+
+    //!@{
+    //! \name Begin run interface
+    // Reset the host tallies for this stream
+    void begin_run(CoreParams const&, CoreStateHost&) final;
+    // Reset the device tallies for this stream
+    void begin_run(CoreParams const&, CoreStateDevice&) final;
+    //!@}
+
+    //!@{
+    //! \name Action interface
+    //! ID of the action
+    ActionId action_id() const final { return action_id_; }
+    //! Dependency ordering of the action
+    StepActionOrder order() const final { return StepActionOrder::user_post; }
+    // Launch kernel with host data
+    void step(CoreParams const&, CoreStateHost&) const final;
+    // Launch kernel with device data
+    void step(CoreParams const&, CoreStateDevice&) const final;
+    //!@}
+
+    //!@{
+    //! \name Output interface
+    //! Category of data to write
+    Category category() const final { return Category::result; }
+    // Write output to the given JSON object
+    void output(JsonPimpl*) const final;
+    //!@}
+
+    // Get the expected number of detected photons summed over streams
+    VecReal calc_num_detected() const;
+
+  private:
+    //// TYPES ////
+
+    using StoreT
+        = StreamStore<celeritas::optical::VisibilityTallyParamsData,
+                      celeritas::optical::VisibilityStateData>;
+
+    //// DATA ////
+
+    ActionId action_id_;
+    AuxId offload_id_;
+    SPConstVisibility visibility_;
+    mutable StoreT store_;
+
+    //// HELPER FUNCTIONS ////
+
+    template<MemSpace M>
+    void begin_run_impl(CoreState<M>&);
+
+    template<MemSpace M>
+    void step_impl(CoreParams const&, CoreState<M>&) const;
+};
+
+//---------------------------------------------------------------------------//
+// Accumulate detected photons from distributions on host
+void visibility_lookup(
+    HostCRef<celeritas::optical::VisibilityParamsData> const& params,
+    HostRef<celeritas::optical::VisibilityStateData>& state,
+    Span<celeritas::optical::GeneratorDistributionData const> distributions,
+    StreamId stream);
+
+// Accumulate detected photons from distributions on device
+void visibility_lookup(
+    DeviceCRef<celeritas::optical::VisibilityParamsData> const& params,
+    DeviceRef<celeritas::optical::VisibilityStateData>& state,
+    Span<celeritas::optical::GeneratorDistributionData const> distributions,
+    StreamId stream);
+
+#if !CELER_USE_DEVICE
+inline void visibility_lookup(
+    DeviceCRef<celeritas::optical::VisibilityParamsData> const&,
+    DeviceRef<celeritas::optical::VisibilityStateData>&,
+    Span<celeritas::optical::GeneratorDistributionData const>,
+    StreamId)
+{
+    CELER_NOT_CONFIGURED("CUDA OR HIP");
+}
+#endif
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
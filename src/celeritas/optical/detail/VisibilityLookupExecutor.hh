@@ -0,0 +1,102 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/optical/detail/VisibilityLookupExecutor.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/grid/UniformGrid.hh"
+#include "corecel/math/Atomics.hh"
+#include "corecel/sys/ThreadId.hh"
+#include "celeritas/optical/GeneratorDistributionData.hh"
+#include "celeritas/optical/VisibilityData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+// LAUNCHER
+//---------------------------------------------------------------------------//
+/*!
+ * Convert buffered optical distributions to expected sensor counts.
+ *
+ * Each thread handles one distribution: the photons are assumed to be emitted
+ * at the midpoint of the generating step, and distributions outside the voxel
+ * grid are not detected.
+ */
+struct VisibilityLookupExecutor
+{
+    //// TYPES ////
+
+    using SpanConstDistribution
+        = Span<celeritas::optical::GeneratorDistributionData const>;
+
+    //// DATA ////
+
+    NativeCRef<celeritas::optical::VisibilityParamsData> const params;
+    NativeRef<celeritas::optical::VisibilityStateData> state;
+    SpanConstDistribution distributions;
+
+    //// FUNCTIONS ////
+
+    // Accumulate detected photons from a single distribution
+    inline CELER_FUNCTION void operator()(ThreadId tid);
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Accumulate detected photons from a single distribution.
+ */
+CELER_FUNCTION void VisibilityLookupExecutor::operator()(ThreadId tid)
+{
+    CELER_EXPECT(params && state);
+    CELER_EXPECT(tid < distributions.size());
+
+    auto const& dist = distributions[tid.unchecked_get()];
+    if (!dist)
+    {
+        return;
+    }
+
+    // Find the voxel containing the step midpoint
+    size_type voxel = 0;
+    for (auto ax : range(3))
+    {
+        UniformGrid grid{params.grid[ax]};
+        real_type pos = (dist.points[StepPoint::pre].pos[ax]
+                         + dist.points[StepPoint::post].pos[ax])
+                        / 2;
+        if (!(pos >= grid.front() && pos < grid.back()))
+        {
+            // Outside the tabulated region
+            return;
+        }
+        voxel = voxel * (grid.size() - 1) + grid.find(pos);
+    }
+
+    // Tally the expected number of detected photons in each sensor
+    auto const num_sensors = params.num_sensors;
+    for (auto sensor : range(num_sensors))
+    {
+        float vis = params.visibility[ItemId<float>(voxel * num_sensors
+                                                    + sensor)];
+        if (vis > 0)
+        {
+            atomic_add(&state.num_detected[DetectorId{sensor}],
+                       dist.num_photons * dist.weight * vis);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
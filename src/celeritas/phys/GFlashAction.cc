@@ -0,0 +1,261 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/GFlashAction.cc
+//---------------------------------------------------------------------------//
+#include "GFlashAction.hh"
+
+#include <algorithm>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/data/AuxParamsRegistry.hh"
+#include "corecel/data/AuxStateVec.hh"
+#include "corecel/data/CollectionAlgorithms.hh"
+#include "corecel/data/StackAllocator.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/sys/ActionRegistry.hh"
+#include "celeritas/global/ActionLauncher.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
+#include "celeritas/global/TrackExecutor.hh"
+#include "celeritas/user/StepCollector.hh"
+
+#include "detail/GFlashExecutor.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Construct a state
+template<MemSpace M>
+auto make_state(GFlashParams const& params,
+                StepCollector const* collector,
+                StreamId stream,
+                size_type size)
+{
+    auto result = std::make_unique<GFlashState<M>>();
+    result->store = {params.host_ref(), stream, size};
+    if (collector)
+    {
+        // Each spot is converted to a step
+        result->steps = {collector->host_ref(),
+                         stream,
+                         params.host_ref().scalars.spot_capacity};
+    }
+
+    CELER_ENSURE(*result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct and add to core params.
+ */
+std::shared_ptr<GFlashAction>
+GFlashAction::make_and_insert(CoreParams const& core,
+                              GFlashParams::Input const& input,
+                              SPConstCollector collector)
+{
+    ActionRegistry& actions = *core.action_reg();
+    AuxParamsRegistry& aux = *core.aux_reg();
+    auto params = std::make_shared<GFlashParams>(
+        *core.geomaterial(), *core.material(), *core.particle(), input);
+    auto result = std::make_shared<GFlashAction>(actions.next_id(),
+                                                 aux.next_id(),
+                                                 std::move(params),
+                                                 std::move(collector));
+    actions.insert(result);
+    aux.insert(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with IDs, shower parameters, and optional hit collection.
+ */
+GFlashAction::GFlashAction(ActionId action_id,
+                           AuxId aux_id,
+                           SPConstParams params,
+                           SPConstCollector collector)
+    : action_id_{action_id}
+    , aux_id_{aux_id}
+    , params_{std::move(params)}
+    , collector_{std::move(collector)}
+{
+    CELER_EXPECT(action_id_);
+    CELER_EXPECT(aux_id_);
+    CELER_EXPECT(params_);
+
+    if (!collector_)
+    {
+        CELER_LOG(warning) << "No step collector was provided for GFlash "
+                              "showers: energy deposited by parameterized "
+                              "showers will not be scored";
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Description of the action.
+ */
+std::string_view GFlashAction::description() const
+{
+    return "parameterize electromagnetic showers";
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Build state data for a stream.
+ */
+auto GFlashAction::create_state(MemSpace m,
+                                StreamId sid,
+                                size_type size) const -> UPState
+{
+    if (m == MemSpace::host)
+    {
+        return make_state<MemSpace::host>(
+            *params_, collector_.get(), sid, size);
+    }
+    else if (m == MemSpace::device)
+    {
+        return make_state<MemSpace::device>(
+            *params_, collector_.get(), sid, size);
+    }
+    CELER_ASSERT_UNREACHABLE();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Execute the action with host data.
+ */
+void GFlashAction::step(CoreParams const& params, CoreStateHost& state) const
+{
+    auto& spots = get<GFlashState<MemSpace::host>>(state.aux(), aux_id_);
+    fill(size_type(0), &spots.store.ref().spots.size);
+
+    auto execute = make_active_track_executor(
+        params.ptr<MemSpace::native>(),
+        state.ptr(),
+        detail::GFlashExecutor{params_->ref<MemSpace::native>(),
+                               spots.store.ref(),
+                               this->action_id()});
+    launch_action(*this, params, state, execute);
+
+    if (collector_)
+    {
+        StackAllocator<GFlashSpot> allocated(spots.store.ref().spots);
+        this->process_spots(allocated.get(), state);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Pass the spots from the current step to the step interfaces.
+ *
+ * Each spot is written as a zero-length step in the host step state: the
+ * slots beyond the number of spots are cleared so that they are ignored by
+ * the step interfaces.
+ */
+template<MemSpace M>
+void GFlashAction::process_spots(Span<GFlashSpot const> spots,
+                                 CoreState<M>& state) const
+{
+    CELER_EXPECT(collector_);
+
+    auto& aux = get<GFlashState<M>>(state.aux(), aux_id_);
+    auto const& step_params = collector_->host_ref();
+    auto& steps = aux.steps.ref();
+    size_type const num_spots = spots.size();
+    CELER_ASSERT(num_spots <= steps.size());
+
+    if (num_spots == 0 && aux.num_steps == 0)
+    {
+        // No spots at this step or the last
+        return;
+    }
+
+    auto const& selection = step_params.selection;
+    auto& data = steps.data;
+    for (auto i : range(num_spots))
+    {
+        GFlashSpot const& spot = spots[i];
+        TrackSlotId tid{i};
+
+#define GF_SET_IF_SELECTED(ATTR, VALUE) \
+    do                                  \
+    {                                   \
+        if (selection.ATTR)             \
+        {                               \
+            data.ATTR[tid] = VALUE;     \
+        }                               \
+    } while (0)
+
+        data.track_id[tid] = spot.track;
+        if (!step_params.detector.empty())
+        {
+            data.detector[tid] = spot.volume ? step_params.detector[spot.volume]
+                                             : DetectorId{};
+        }
+        for (auto sp : range(StepPoint::size_))
+        {
+            GF_SET_IF_SELECTED(points[sp].time, spot.time);
+            GF_SET_IF_SELECTED(points[sp].pos, spot.pos);
+            GF_SET_IF_SELECTED(points[sp].dir, spot.dir);
+            GF_SET_IF_SELECTED(points[sp].volume_id, spot.volume);
+        }
+        GF_SET_IF_SELECTED(points[StepPoint::pre].energy, spot.energy);
+        GF_SET_IF_SELECTED(points[StepPoint::post].energy, zero_quantity());
+        GF_SET_IF_SELECTED(event_id, spot.event);
+        GF_SET_IF_SELECTED(parent_id, spot.parent);
+        GF_SET_IF_SELECTED(track_step_count, spot.num_steps);
+        GF_SET_IF_SELECTED(action_id, this->action_id());
+        GF_SET_IF_SELECTED(step_length, real_type{0});
+        GF_SET_IF_SELECTED(particle, spot.particle);
+        GF_SET_IF_SELECTED(energy_deposition, spot.energy);
+#undef GF_SET_IF_SELECTED
+    }
+
+    // Clear the remaining steps from the previous iteration
+    for (auto i : range(num_spots, std::max(num_spots, aux.num_steps)))
+    {
+        TrackSlotId tid{i};
+        data.track_id[tid] = {};
+        if (!step_params.detector.empty())
+        {
+            data.detector[tid] = {};
+        }
+    }
+    aux.num_steps = num_spots;
+
+    StepInterface::HostStepState host_steps{steps, state.stream_id()};
+    for (auto const& callback : collector_->callbacks())
+    {
+        callback->process_steps(host_steps);
+    }
+}
+
+//---------------------------------------------------------------------------//
+template void
+GFlashAction::process_spots<MemSpace::host>(Span<GFlashSpot const>,
+                                            CoreState<MemSpace::host>&) const;
+template void GFlashAction::process_spots<MemSpace::device>(
+    Span<GFlashSpot const>, CoreState<MemSpace::device>&) const;
+
+//---------------------------------------------------------------------------//
+#if !CELER_USE_DEVICE
+void GFlashAction::step(CoreParams const&, CoreStateDevice&) const
+{
+    CELER_NOT_CONFIGURED("CUDA OR HIP");
+}
+#endif
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,61 @@
+//---------------------------------*-CUDA-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/GFlashAction.cu
+//---------------------------------------------------------------------------//
+#include "GFlashAction.hh"
+
+#include <vector>
+
+#include "corecel/data/AuxStateVec.hh"
+#include "corecel/data/CollectionAlgorithms.hh"
+#include "corecel/data/Copier.hh"
+#include "celeritas/global/ActionLauncher.device.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
+#include "celeritas/global/TrackExecutor.hh"
+
+#include "detail/GFlashExecutor.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Execute the action with device data.
+ */
+void GFlashAction::step(CoreParams const& params, CoreStateDevice& state) const
+{
+    auto& spots = get<GFlashState<MemSpace::device>>(state.aux(), aux_id_);
+    fill(size_type(0), &spots.store.ref().spots.size);
+
+    auto execute = make_active_track_executor(
+        params.ptr<MemSpace::native>(),
+        state.ptr(),
+        detail::GFlashExecutor{params_->ref<MemSpace::native>(),
+                               spots.store.ref(),
+                               this->action_id()});
+    static ActionLauncher<decltype(execute)> const launch_kernel(*this);
+    launch_kernel(*this, params, state, execute);
+
+    if (collector_)
+    {
+        // Copy the allocated spots to host
+        auto const& spot_data = spots.store.ref().spots;
+        size_type num_spots{0};
+        copy_to_host(spot_data.size, Span<size_type>{&num_spots, 1});
+        std::vector<GFlashSpot> host_spots(num_spots);
+        if (num_spots > 0)
+        {
+            Copier<GFlashSpot, MemSpace::host> copy{make_span(host_spots)};
+            copy(MemSpace::device,
+                 spot_data.storage[ItemRange<GFlashSpot>{
+                     ItemId<GFlashSpot>{0}, ItemId<GFlashSpot>{num_spots}}]);
+        }
+        this->process_spots(make_span(host_spots), state);
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,129 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/GFlashAction.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+
+#include "corecel/data/AuxInterface.hh"
+#include "corecel/data/CollectionStateStore.hh"
+#include "corecel/cont/Span.hh"
+#include "celeritas/global/ActionInterface.hh"
+#include "celeritas/user/StepData.hh"
+
+#include "GFlashData.hh"
+#include "GFlashParams.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+class StepCollector;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Replace electromagnetic showers in selected volumes with parameterized
+ * energy deposition.
+ *
+ * This action runs after the physics pre-step action. Eligible electrons,
+ * positrons, and photons (see \c GFlashParams) are killed, and their energy
+ * plus any annihilation energy is distributed among energy spots that are
+ * stored in a per-stream stack as auxiliary state data.
+ *
+ * If a step collector is provided, the spots are passed to its step
+ * interfaces on host after each step as zero-length steps whose pre- and
+ * post-step points are at the spot, so that sensitive detectors and
+ * calorimeters (e.g. \c SimpleCalo) score the deposition in the volume
+ * containing each spot. The spots use the collector's detector mapping, so
+ * spots outside sensitive volumes are ignored. With a device state, the spots
+ * are copied to host before being processed. Without a collector the
+ * deposited energy is discarded, and a warning is emitted at construction.
+ */
+class GFlashAction final : public CoreStepActionInterface,
+                           public AuxParamsInterface
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SPConstParams = std::shared_ptr<GFlashParams const>;
+    using SPConstCollector = std::shared_ptr<StepCollector const>;
+    //!@}
+
+  public:
+    // Construct and add to core params
+    static std::shared_ptr<GFlashAction>
+    make_and_insert(CoreParams const& core,
+                    GFlashParams::Input const& input,
+                    SPConstCollector collector = {});
+
+    // Construct with IDs, shower parameters, and optional hit collection
+    GFlashAction(ActionId action_id,
+                 AuxId aux_id,
+                 SPConstParams params,
+                 SPConstCollector collector);
+
+    //!@{
+    //! \name Metadata interface
+    //! Label for the auxiliary data and action
+    std::string_view label() const final { return "gflash"; }
+    // Description of the action
+    std::string_view description() const final;
+    //!@}
+
+    //!@{
+    //! \name Step action interface
+    //! ID of the action
+    ActionId action_id() const final { return action_id_; }
+    //! Dependency ordering of the action
+    StepActionOrder order() const final { return StepActionOrder::pre; }
+    // Execute the action with host data
+    void step(CoreParams const& params, CoreStateHost& state) const final;
+    // Execute the action with device data
+    void step(CoreParams const& params, CoreStateDevice& state) const final;
+    //!@}
+
+    //!@{
+    //! \name Aux params interface
+    //! Index of this class instance in its registry
+    AuxId aux_id() const final { return aux_id_; }
+    // Build state data for a stream
+    UPState create_state(MemSpace m, StreamId id, size_type size) const final;
+    //!@}
+
+    //! Access shower parameters
+    SPConstParams const& params() const { return params_; }
+
+  private:
+    ActionId action_id_;
+    AuxId aux_id_;
+    SPConstParams params_;
+    SPConstCollector collector_;
+
+    template<MemSpace M>
+    void process_spots(Span<GFlashSpot const> spots,
+                       CoreState<M>& state) const;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Energy spots deposited on a stream.
+ */
+template<MemSpace M>
+struct GFlashState : public AuxStateInterface
+{
+    CollectionStateStore<GFlashStateData, M> store;
+
+    //! Spots converted to steps for the step collector (optional)
+    CollectionStateStore<StepStateData, MemSpace::host> steps;
+    //! Number of steps filled at the last step iteration
+    size_type num_steps{0};
+
+    //! True if states have been allocated
+    explicit operator bool() const { return static_cast<bool>(store); }
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
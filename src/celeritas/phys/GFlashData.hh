@@ -0,0 +1,241 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/GFlashData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Array.hh"
+#include "corecel/data/Collection.hh"
+#include "corecel/data/StackAllocatorData.hh"
+#include "geocel/Types.hh"
+#include "celeritas/Quantities.hh"
+#include "celeritas/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Coefficients of the homogeneous-media GFlash shower parameterization.
+ *
+ * The longitudinal profile is a gamma distribution in depth \f$ t \f$ (in
+ * radiation lengths) with shape \f$ \alpha \f$ and depth of maximum \f$ T \f$:
+ * \f[
+   T = \ln y + t_1, \quad \alpha = a_1 + (a_2 + a_3 / Z) \ln y
+ * \f]
+ * where \f$ y = E / E_c \f$. The radial profile (in Moliere radii) at scaled
+ * depth \f$ \tau = t / T \f$ is a mixture of a core and a tail component
+ * \f$ f(r) = 2 r R^2 / (r^2 + R^2)^2 \f$ with
+ * \f[
+   R_C = z_1 + z_2 \tau, \quad
+   R_T = k_1 (e^{k_3 (\tau - k_2)} + e^{k_4 (\tau - k_2)}), \quad
+   p = p_1 \exp\left[\frac{p_2 - \tau}{p_3}
+                     - \exp\left(\frac{p_2 - \tau}{p_3}\right)\right]
+ * \f]
+ * Each radial coefficient pair \f$ (c_0, c_1) \f$ is linear in either
+ * \f$ \ln E \f$ (energy in GeV) or \f$ Z \f$.
+ *
+ * Defaults are from Grindhammer and Peters, "The parameterized simulation of
+ * electromagnetic showers in homogeneous and sampling calorimeters" (1993).
+ */
+struct GFlashCoefficients
+{
+    using Linear = Array<real_type, 2>;
+
+    //!@{
+    //! \name Longitudinal profile
+    real_type t1{-0.858};
+    real_type a1{0.21};
+    real_type a2{0.492};
+    real_type a3{2.38};
+    //!@}
+
+    //!@{
+    //! \name Radial profile
+    Linear z1{0.0251, 0.00319};  //!< Linear in ln E
+    Linear z2{0.1162, -0.000381};  //!< Linear in Z
+    Linear k1{0.659, -0.00309};  //!< Linear in Z
+    real_type k2{0.645};
+    real_type k3{-2.59};
+    Linear k4{0.3585, 0.0421};  //!< Linear in ln E
+    Linear p1{2.632, -0.00094};  //!< Linear in Z
+    Linear p2{0.401, 0.00187};  //!< Linear in Z
+    Linear p3{1.313, -0.0686};  //!< Linear in ln E
+    //!@}
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Material properties used by the shower parameterization.
+ */
+struct GFlashMaterial
+{
+    real_type zeff{};  //!< Effective atomic number
+    real_type radiation_length{};  //!< [len]
+    real_type moliere_radius{};  //!< [len]
+    units::MevEnergy critical_energy;
+
+    //! True if assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return zeff > 0 && radiation_length > 0 && moliere_radius > 0
+               && critical_energy > zero_quantity();
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Scalar parameters for parameterized showers.
+ */
+struct GFlashScalars
+{
+    ParticleId electron;
+    ParticleId positron;  //!< Optional
+    ParticleId gamma;
+
+    //! Minimum energy for a particle to be parameterized
+    units::MevEnergy min_energy;
+    //! Number of energy spots per shower
+    size_type num_spots{};
+    //! Maximum radial extent of a spot [Moliere radii]
+    real_type max_radius{};
+    //! Number of spots that can be stored per stream per step
+    size_type spot_capacity{};
+
+    GFlashCoefficients coeffs;
+
+    //! True if assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return electron && gamma && min_energy > zero_quantity()
+               && num_spots > 0 && max_radius > 0 && spot_capacity > 0;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Shared data for parameterized electromagnetic showers.
+ */
+template<Ownership W, MemSpace M>
+struct GFlashParamsData
+{
+    template<class T>
+    using MaterialItems = Collection<T, W, M, MaterialId>;
+    template<class T>
+    using VolumeItems = Collection<T, W, M, VolumeId>;
+
+    //// DATA ////
+
+    //! Material used for the parameterization (null if not parameterized)
+    VolumeItems<MaterialId> volume_material;
+
+    //! Shower properties of each material
+    MaterialItems<GFlashMaterial> materials;
+
+    GFlashScalars scalars;
+
+    //// METHODS ////
+
+    //! True if assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !volume_material.empty() && !materials.empty() && scalars;
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    GFlashParamsData& operator=(GFlashParamsData<W2, M2> const& other)
+    {
+        CELER_EXPECT(other);
+        volume_material = other.volume_material;
+        materials = other.materials;
+        scalars = other.scalars;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Energy deposited at a point by a parameterized shower.
+ *
+ * The track attributes of the parameterized particle are stored with each
+ * spot so that the spots can be processed as zero-length steps by sensitive
+ * detectors.
+ */
+struct GFlashSpot
+{
+    Real3 pos{0, 0, 0};
+    Real3 dir{0, 0, 0};  //!< Direction of the shower axis
+    units::MevEnergy energy;
+    VolumeId volume;  //!< Volume containing the spot (null if outside)
+    real_type time{};  //!< Time at the start of the shower [time]
+    EventId event;
+    TrackId track;
+    TrackId parent;
+    ParticleId particle;
+    size_type num_steps{};
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Energy spots deposited on a stream during the current step.
+ *
+ * The stack is cleared at the start of every step.
+ */
+template<Ownership W, MemSpace M>
+struct GFlashStateData
+{
+    //// DATA ////
+
+    StackAllocatorData<GFlashSpot, W, M> spots;
+
+    //! Number of track slots (unused during calculation)
+    size_type num_track_slots{};
+
+    //// METHODS ////
+
+    //! Number of states
+    CELER_FUNCTION size_type size() const { return num_track_slots; }
+
+    //! True if constructed
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return static_cast<bool>(spots) && num_track_slots > 0;
+    }
+
+    //! Assign from another set of states
+    template<Ownership W2, MemSpace M2>
+    GFlashStateData& operator=(GFlashStateData<W2, M2>& other)
+    {
+        CELER_EXPECT(other);
+        spots = other.spots;
+        num_track_slots = other.num_track_slots;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Resize the spot storage.
+ */
+template<MemSpace M>
+inline void resize(GFlashStateData<Ownership::value, M>* state,
+                   HostCRef<GFlashParamsData> const& params,
+                   StreamId,
+                   size_type num_track_slots)
+{
+    CELER_EXPECT(params);
+    CELER_EXPECT(num_track_slots > 0);
+
+    resize(&state->spots, params.scalars.spot_capacity);
+    state->num_track_slots = num_track_slots;
+
+    CELER_ENSURE(*state);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
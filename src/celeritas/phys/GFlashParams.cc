@@ -0,0 +1,178 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/GFlashParams.cc
+//---------------------------------------------------------------------------//
+#include "GFlashParams.hh"
+
+#include <cmath>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "corecel/math/Algorithms.hh"
+#include "celeritas/geo/GeoMaterialParams.hh"
+#include "celeritas/mat/MaterialParams.hh"
+#include "celeritas/mat/MaterialView.hh"
+
+#include "PDGNumber.hh"
+#include "ParticleParams.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate shower properties for a material.
+ */
+GFlashMaterial
+GFlashParams::calc_material(MaterialParams const& materials, MaterialId id)
+{
+    CELER_EXPECT(id < materials.size());
+
+    MaterialView mat(materials.host_ref(), id);
+    GFlashMaterial result;
+    result.zeff = mat.zeff();
+    CELER_VALIDATE(result.zeff > 0,
+                   << "cannot parameterize showers in material '"
+                   << materials.id_to_label(id)
+                   << "' with no atomic number");
+    result.radiation_length = mat.radiation_length();
+    result.critical_energy = Energy{610 / (result.zeff + real_type(1.24))};
+    result.moliere_radius = real_type(21.2) * result.radiation_length
+                            / value_as<Energy>(result.critical_energy);
+
+    CELER_ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Fit longitudinal coefficients to average shower profiles.
+ *
+ * The gamma distribution parameters of each profile are calculated from the
+ * mean and variance of its depth. The offset \f$ t_1 \f$ of the depth of
+ * maximum is the mean residual, and \f$ a_1 \f$ and \f$ a_2 \f$ are a linear
+ * least-squares fit of the shape parameter to \f$ \ln y \f$ with \f$ a_3 \f$
+ * held fixed. With profiles at a single energy, only \f$ a_1 \f$ is updated.
+ * The radial coefficients are returned unchanged.
+ */
+GFlashCoefficients
+GFlashParams::fit_longitudinal(VecProfile const& profiles,
+                               GFlashCoefficients coeffs)
+{
+    CELER_VALIDATE(!profiles.empty(), << "no shower profiles to fit");
+
+    real_type sum_t1{0};
+    real_type sum_x{0};
+    real_type sum_xx{0};
+    real_type sum_y{0};
+    real_type sum_xy{0};
+    for (LongitudinalProfile const& p : profiles)
+    {
+        CELER_VALIDATE(p.material && p.bin_width > 0 && !p.edep.empty()
+                           && p.energy > p.material.critical_energy,
+                       << "invalid shower profile at "
+                       << value_as<Energy>(p.energy) << " MeV");
+
+        // Calculate the moments of the depth distribution
+        real_type norm{0};
+        real_type mean{0};
+        real_type mean_sq{0};
+        for (auto i : range(p.edep.size()))
+        {
+            real_type t = (i + real_type(0.5)) * p.bin_width;
+            norm += p.edep[i];
+            mean += p.edep[i] * t;
+            mean_sq += p.edep[i] * t * t;
+        }
+        CELER_VALIDATE(norm > 0, << "shower profile has no energy deposition");
+        mean /= norm;
+        real_type var = mean_sq / norm - ipow<2>(mean);
+        CELER_VALIDATE(var > 0, << "shower profile has zero width");
+
+        real_type alpha = ipow<2>(mean) / var;
+        real_type depth_max = (alpha - 1) * var / mean;
+        real_type log_y
+            = std::log(value_as<Energy>(p.energy)
+                       / value_as<Energy>(p.material.critical_energy));
+
+        sum_t1 += depth_max - log_y;
+        real_type y = alpha - coeffs.a3 * log_y / p.material.zeff;
+        sum_x += log_y;
+        sum_xx += ipow<2>(log_y);
+        sum_y += y;
+        sum_xy += log_y * y;
+    }
+
+    real_type const n = profiles.size();
+    coeffs.t1 = sum_t1 / n;
+    real_type denom = n * sum_xx - ipow<2>(sum_x);
+    if (denom > real_type(1e-8) * n * sum_xx)
+    {
+        coeffs.a2 = (n * sum_xy - sum_x * sum_y) / denom;
+    }
+    coeffs.a1 = (sum_y - coeffs.a2 * sum_x) / n;
+    return coeffs;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from geometry materials.
+ */
+GFlashParams::GFlashParams(GeoMaterialParams const& geo_mat,
+                           MaterialParams const& materials,
+                           ParticleParams const& particles,
+                           Input const& input)
+{
+    CELER_VALIDATE(input, << "invalid parameterized shower input");
+
+    HostVal<GFlashParamsData> host_data;
+
+    // Find the EM particles
+    auto& scalars = host_data.scalars;
+    scalars.electron = particles.find(pdg::electron());
+    scalars.positron = particles.find(pdg::positron());
+    scalars.gamma = particles.find(pdg::gamma());
+    CELER_VALIDATE(scalars.electron && scalars.gamma,
+                   << "missing electron or gamma (required for "
+                      "parameterized showers)");
+    scalars.min_energy = input.min_energy;
+    scalars.num_spots = input.num_spots;
+    scalars.max_radius = input.max_radius;
+    scalars.spot_capacity = input.spot_capacity;
+    scalars.coeffs = input.coeffs;
+
+    // Assign the parameterization material to each selected volume
+    auto const& volume_to_mat = geo_mat.host_ref().materials;
+    std::vector<MaterialId> volume_material(volume_to_mat.size());
+    std::vector<GFlashMaterial> shower_mats(materials.size());
+    for (auto i : range(input.volumes.size()))
+    {
+        VolumeId vid = input.volumes[i];
+        CELER_VALIDATE(vid < volume_to_mat.size(),
+                       << "invalid volume ID for parameterized showers");
+        MaterialId mid = input.materials.empty() ? volume_to_mat[vid]
+                                                 : input.materials[i];
+        CELER_VALIDATE(mid < materials.size(),
+                       << "volume " << vid.get()
+                       << " has no material for parameterized showers");
+        volume_material[vid.get()] = mid;
+        if (!shower_mats[mid.get()])
+        {
+            shower_mats[mid.get()] = calc_material(materials, mid);
+        }
+    }
+    make_builder(&host_data.volume_material)
+        .insert_back(volume_material.begin(), volume_material.end());
+    make_builder(&host_data.materials)
+        .insert_back(shower_mats.begin(), shower_mats.end());
+
+    data_ = CollectionMirror<GFlashParamsData>{std::move(host_data)};
+    CELER_ENSURE(data_);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
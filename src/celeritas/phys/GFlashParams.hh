@@ -0,0 +1,120 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/GFlashParams.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+
+#include "corecel/data/CollectionMirror.hh"
+#include "corecel/data/ParamsDataInterface.hh"
+#include "celeritas/Quantities.hh"
+
+#include "GFlashData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+class GeoMaterialParams;
+class MaterialParams;
+class ParticleParams;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Parameterized electromagnetic showers in calorimeter volumes.
+ *
+ * Electrons, positrons, and photons above a threshold energy that start a
+ * step in one of the selected volumes are not transported: their energy is
+ * instead distributed among a fixed number of "spots" sampled from the
+ * average GFlash shower profile of the volume's material (or of a
+ * user-provided effective material for sampling calorimeters).
+ *
+ * The material-dependent shower properties use the effective atomic number
+ * \f$ Z \f$ and the radiation length \f$ X_0 \f$ of the material, with the
+ * critical energy \f$ E_c = 610\,\mathrm{MeV} / (Z + 1.24) \f$ and Moliere
+ * radius \f$ R_M = 21.2\,\mathrm{MeV}\, X_0 / E_c \f$.
+ *
+ * The longitudinal coefficients can be fit to average shower profiles
+ * tallied from a full simulation (see \c GFlashProfileTally) using \c
+ * fit_longitudinal .
+ */
+class GFlashParams final : public ParamsDataInterface<GFlashParamsData>
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using Energy = units::MevEnergy;
+    using VecVolume = std::vector<VolumeId>;
+    using VecMaterial = std::vector<MaterialId>;
+    using VecReal = std::vector<real_type>;
+    //!@}
+
+    struct Input
+    {
+        //! Volumes in which showers are parameterized
+        VecVolume volumes;
+        //! Optional effective material for each volume (default: volume's)
+        VecMaterial materials;
+
+        //! Minimum energy for a particle to be parameterized
+        Energy min_energy{1000};
+        //! Number of energy spots per shower
+        size_type num_spots{100};
+        //! Maximum radial extent of a spot [Moliere radii]
+        real_type max_radius{5};
+        //! Number of spots that can be stored per stream per step
+        size_type spot_capacity{65536};
+
+        GFlashCoefficients coeffs;
+
+        //! True if the input is valid
+        explicit operator bool() const
+        {
+            return !volumes.empty()
+                   && (materials.empty() || materials.size() == volumes.size())
+                   && min_energy > zero_quantity() && num_spots > 0
+                   && max_radius > 0 && spot_capacity >= num_spots;
+        }
+    };
+
+    //! Average longitudinal shower profile from a full simulation
+    struct LongitudinalProfile
+    {
+        Energy energy;  //!< Incident energy
+        GFlashMaterial material;  //!< Shower material
+        real_type bin_width{};  //!< Depth bin width [radiation lengths]
+        VecReal edep;  //!< Deposited energy in each depth bin
+    };
+
+    using VecProfile = std::vector<LongitudinalProfile>;
+
+  public:
+    // Calculate shower properties for a material
+    static GFlashMaterial
+    calc_material(MaterialParams const& materials, MaterialId id);
+
+    // Fit longitudinal coefficients to average shower profiles
+    static GFlashCoefficients
+    fit_longitudinal(VecProfile const& profiles, GFlashCoefficients coeffs);
+
+    // Construct from geometry materials
+    GFlashParams(GeoMaterialParams const& geo_mat,
+                 MaterialParams const& materials,
+                 ParticleParams const& particles,
+                 Input const& input);
+
+    //! Access data on the host
+    HostRef const& host_ref() const final { return data_.host_ref(); }
+
+    //! Access data on the device
+    DeviceRef const& device_ref() const final { return data_.device_ref(); }
+
+  private:
+    CollectionMirror<GFlashParamsData> data_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
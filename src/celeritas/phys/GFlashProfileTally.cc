@@ -0,0 +1,141 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/GFlashProfileTally.cc
+//---------------------------------------------------------------------------//
+#include "GFlashProfileTally.hh"
+
+#include <cmath>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/math/ArraySoftUnit.hh"
+#include "corecel/math/ArrayUtils.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with input and number of streams.
+ */
+GFlashProfileTally::GFlashProfileTally(Input const& input,
+                                       size_type num_streams)
+    : input_{input}
+    , inv_bin_length_{1
+                      / (input.bin_width * input.material.radiation_length)}
+    , edep_(num_streams, std::vector<real_type>(input.num_bins, 0))
+    , steps_(num_streams)
+{
+    CELER_VALIDATE(input_, << "invalid shower profile tally input");
+    CELER_VALIDATE(is_soft_unit_vector(input_.axis),
+                   << "shower profile axis is not a unit vector");
+    CELER_EXPECT(num_streams > 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Map tallied volumes to a single detector.
+ */
+auto GFlashProfileTally::filters() const -> Filters
+{
+    Filters result;
+    for (VolumeId vid : input_.volumes)
+    {
+        result.detectors[vid] = DetectorId{0};
+    }
+    result.nonzero_energy_deposition = true;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Save pre- and post-step positions and energy deposition.
+ */
+auto GFlashProfileTally::selection() const -> StepSelection
+{
+    StepSelection result;
+    result.energy_deposition = true;
+    result.points[StepPoint::pre].pos = true;
+    result.points[StepPoint::post].pos = true;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Process CPU-generated hits.
+ */
+void GFlashProfileTally::process_steps(HostStepState state)
+{
+    CELER_EXPECT(state.stream_id < steps_.size());
+    copy_steps(&steps_[state.stream_id.get()], state.steps);
+    this->accumulate(state.stream_id);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Process device-generated hits.
+ */
+void GFlashProfileTally::process_steps(DeviceStepState state)
+{
+    CELER_EXPECT(state.stream_id < steps_.size());
+    copy_steps(&steps_[state.stream_id.get()], state.steps);
+    this->accumulate(state.stream_id);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the profile accumulated over all streams.
+ */
+auto GFlashProfileTally::profile() const -> LongitudinalProfile
+{
+    LongitudinalProfile result;
+    result.energy = input_.energy;
+    result.material = input_.material;
+    result.bin_width = input_.bin_width;
+    result.edep.assign(input_.num_bins, 0);
+    for (auto const& stream_edep : edep_)
+    {
+        for (auto i : range(stream_edep.size()))
+        {
+            result.edep[i] += stream_edep[i];
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Bin the copied steps by depth.
+ */
+void GFlashProfileTally::accumulate(StreamId stream)
+{
+    DetectorStepOutput const& steps = steps_[stream.get()];
+    auto& edep = edep_[stream.get()];
+    auto const& pre_pos = steps.points[StepPoint::pre].pos;
+    auto const& post_pos = steps.points[StepPoint::post].pos;
+    CELER_ASSERT(pre_pos.size() == steps.size()
+                 && post_pos.size() == steps.size()
+                 && steps.energy_deposition.size() == steps.size());
+
+    for (auto i : range(steps.size()))
+    {
+        Real3 mid;
+        for (auto ax : range(3))
+        {
+            mid[ax] = (pre_pos[i][ax] + post_pos[i][ax]) / 2
+                      - input_.origin[ax];
+        }
+        real_type bin = std::floor(dot_product(mid, input_.axis)
+                                   * inv_bin_length_);
+        if (bin >= 0 && bin < edep.size())
+        {
+            edep[static_cast<size_type>(bin)]
+                += steps.energy_deposition[i].value();
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,98 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/GFlashProfileTally.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+
+#include "corecel/Types.hh"
+#include "geocel/Types.hh"
+#include "celeritas/user/DetectorSteps.hh"
+#include "celeritas/user/StepInterface.hh"
+
+#include "GFlashParams.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Tally the average longitudinal shower profile from a full simulation.
+ *
+ * The energy deposited in the selected volumes is binned by the depth (in
+ * radiation lengths of the shower material) of the step midpoint along the
+ * shower axis. Deposition before the origin or beyond the last bin is
+ * ignored. The resulting profiles, from runs of showers at several incident
+ * energies, are the input to \c GFlashParams::fit_longitudinal .
+ *
+ * Since the volumes are mapped to a detector, this cannot be used in the
+ * same step collector as another interface that scores the same volumes.
+ */
+class GFlashProfileTally final : public StepInterface
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using Energy = units::MevEnergy;
+    using VecVolume = std::vector<VolumeId>;
+    using LongitudinalProfile = GFlashParams::LongitudinalProfile;
+    //!@}
+
+    struct Input
+    {
+        //! Volumes in which to tally deposition
+        VecVolume volumes;
+        //! Starting point of the showers
+        Real3 origin{0, 0, 0};
+        //! Direction of the showers (unit vector)
+        Real3 axis{0, 0, 1};
+        //! Incident energy of the showers
+        Energy energy;
+        //! Properties of the shower material
+        GFlashMaterial material;
+        //! Depth bin width [radiation lengths]
+        real_type bin_width{0.25};
+        //! Number of depth bins
+        size_type num_bins{100};
+
+        //! True if the input is valid
+        explicit operator bool() const
+        {
+            return !volumes.empty() && energy > zero_quantity() && material
+                   && bin_width > 0 && num_bins > 0;
+        }
+    };
+
+  public:
+    // Construct with input and number of streams
+    GFlashProfileTally(Input const& input, size_type num_streams);
+
+    //!@{
+    //! \name Step interface
+    // Map tallied volumes to a single detector
+    Filters filters() const final;
+    // Save pre- and post-step positions and energy deposition
+    StepSelection selection() const final;
+    // Process CPU-generated hits
+    void process_steps(HostStepState) final;
+    // Process device-generated hits
+    void process_steps(DeviceStepState) final;
+    //!@}
+
+    // Get the profile accumulated over all streams
+    LongitudinalProfile profile() const;
+
+  private:
+    Input input_;
+    real_type inv_bin_length_{};
+    std::vector<std::vector<real_type>> edep_;
+    std::vector<DetectorStepOutput> steps_;
+
+    void accumulate(StreamId stream);
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,165 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/GFlashShowerSampler.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cmath>
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/math/Algorithms.hh"
+#include "celeritas/Quantities.hh"
+#include "celeritas/random/distribution/BernoulliDistribution.hh"
+#include "celeritas/random/distribution/GammaDistribution.hh"
+#include "celeritas/random/distribution/UniformRealDistribution.hh"
+
+#include "GFlashData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Sample energy spot positions from the average GFlash shower profile.
+ *
+ * Each sample returns the depth along the shower axis and the radial distance
+ * from it, both in native units. The depth is sampled from the longitudinal
+ * gamma distribution; the radius is then sampled from the core or tail
+ * component of the radial profile at that depth, truncated at a maximum
+ * number of Moliere radii. Shower-to-shower fluctuations of the profile
+ * parameters are not sampled.
+ *
+ * The parameterization is only meaningful if the depth of the shower maximum
+ * is positive and the longitudinal shape parameter exceeds unity, i.e. for
+ * energies well above the critical energy of the material: the sampler is
+ * "false" otherwise.
+ */
+class GFlashShowerSampler
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using Energy = units::MevEnergy;
+    //!@}
+
+    //! Spot position relative to the shower start [len]
+    struct result_type
+    {
+        real_type depth{};
+        real_type radius{};
+    };
+
+  public:
+    // Construct from coefficients, material, and incident energy
+    inline CELER_FUNCTION GFlashShowerSampler(GFlashCoefficients const& coeffs,
+                                              GFlashMaterial const& material,
+                                              real_type max_radius,
+                                              Energy energy);
+
+    //! Whether the parameterization is valid
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return depth_max_ > 0 && alpha_ > 1;
+    }
+
+    // Sample a spot position
+    template<class Engine>
+    inline CELER_FUNCTION result_type operator()(Engine& rng) const;
+
+    //// ACCESSORS ////
+
+    //! Depth of the shower maximum [radiation lengths]
+    CELER_FUNCTION real_type depth_max() const { return depth_max_; }
+
+    //! Longitudinal shape parameter
+    CELER_FUNCTION real_type alpha() const { return alpha_; }
+
+  private:
+    GFlashCoefficients const& coeffs_;
+    GFlashMaterial const& material_;
+    real_type max_radius_;
+    real_type log_energy_;  //!< ln(E / GeV)
+    real_type depth_max_;
+    real_type alpha_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from coefficients, material, and incident energy.
+ */
+CELER_FUNCTION
+GFlashShowerSampler::GFlashShowerSampler(GFlashCoefficients const& coeffs,
+                                         GFlashMaterial const& material,
+                                         real_type max_radius,
+                                         Energy energy)
+    : coeffs_(coeffs)
+    , material_(material)
+    , max_radius_(max_radius)
+    , log_energy_(std::log(value_as<Energy>(energy) / 1000))
+{
+    CELER_EXPECT(material_);
+    CELER_EXPECT(max_radius_ > 0);
+    CELER_EXPECT(energy > zero_quantity());
+
+    real_type log_y = std::log(value_as<Energy>(energy)
+                               / value_as<Energy>(material_.critical_energy));
+    depth_max_ = log_y + coeffs_.t1;
+    alpha_ = coeffs_.a1 + (coeffs_.a2 + coeffs_.a3 / material_.zeff) * log_y;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample a spot position.
+ */
+template<class Engine>
+CELER_FUNCTION auto GFlashShowerSampler::operator()(Engine& rng) const
+    -> result_type
+{
+    CELER_EXPECT(*this);
+
+    real_type const z = material_.zeff;
+    auto linear = [](GFlashCoefficients::Linear const& c, real_type x) {
+        return c[0] + c[1] * x;
+    };
+
+    // Sample the depth in radiation lengths
+    real_type t = GammaDistribution<real_type>(
+        alpha_, depth_max_ / (alpha_ - 1))(rng);
+    real_type tau = t / depth_max_;
+
+    // Calculate the core and tail radii and the core probability
+    real_type r_core = linear(coeffs_.z1, log_energy_)
+                       + linear(coeffs_.z2, z) * tau;
+    real_type r_tail = linear(coeffs_.k1, z)
+                       * (std::exp(coeffs_.k3 * (tau - coeffs_.k2))
+                          + std::exp(linear(coeffs_.k4, log_energy_)
+                                     * (tau - coeffs_.k2)));
+    real_type p_core = [&] {
+        real_type x = (linear(coeffs_.p2, z) - tau)
+                      / linear(coeffs_.p3, log_energy_);
+        return clamp(linear(coeffs_.p1, z) * std::exp(x - std::exp(x)),
+                     real_type{0},
+                     real_type{1});
+    }();
+    real_type r_char = BernoulliDistribution(p_core)(rng) ? r_core : r_tail;
+
+    // Invert the radial CDF r^2 / (r^2 + R^2), truncated at the maximum
+    real_type r_max_sq = ipow<2>(max_radius_);
+    real_type u = UniformRealDistribution<real_type>(
+        0, r_max_sq / (r_max_sq + ipow<2>(r_char)))(rng);
+    real_type r = r_char * std::sqrt(u / (1 - u));
+
+    result_type result;
+    result.depth = t * material_.radiation_length;
+    result.radius = r * material_.moliere_radius;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
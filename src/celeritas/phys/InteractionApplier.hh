@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "corecel/Config.hh"
+
 #include "corecel/Macros.hh"
 #include "corecel/cont/Span.hh"
 #include "corecel/sys/KernelTraits.hh"
@@ -105,9 +107,23 @@ template<class F>
 CELER_FUNCTION void
 InteractionApplierBaseImpl<F>::operator()(celeritas::CoreTrackView const& track)
 {
+#if CELERITAS_SAMPLING_COUNTERS
+    track.make_physics_step_view().sampling_counters() = {};
+#endif
+
     Interaction result = this->sample_interaction(track);
 
     auto sim = track.make_sim_view();
+#if CELERITAS_SAMPLING_COUNTERS
+    {
+        // Save the random number usage of the interaction
+        auto step = track.make_physics_step_view();
+        step.interaction_sampling()
+            = {sim.post_step_action(),
+               step.sampling_counters(),
+               result.action == Interaction::Action::failed};
+    }
+#endif
     if (CELER_UNLIKELY(result.action == Interaction::Action::failed))
     {
         auto phys = track.make_physics_view();
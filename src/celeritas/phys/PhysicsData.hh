@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "corecel/Config.hh"
+
 #include "corecel/cont/Array.hh"
 #include "corecel/data/Collection.hh"
 #include "corecel/data/CollectionBuilder.hh"
@@ -19,6 +21,7 @@
 #include "celeritas/grid/ValueGridType.hh"
 #include "celeritas/grid/XsGridData.hh"
 #include "celeritas/neutron/data/NeutronElasticData.hh"
+#include "celeritas/random/CountingRngEngine.hh"
 
 #include "Interaction.hh"
 #include "Secondary.hh"
@@ -331,6 +334,7 @@ struct PhysicsParamsData
 
     // Backend storage
     Items<real_type> reals;
+    Items<table_real_type> table_reals;  //!< Tabulated grid values
     Items<ParticleModelId> pmodel_ids;
     Items<ValueGrid> value_grids;
     Items<ValueGridId> value_grid_ids;
@@ -364,6 +368,7 @@ struct PhysicsParamsData
         CELER_EXPECT(other);
 
         reals = other.reals;
+        table_reals = other.table_reals;
         pmodel_ids = other.pmodel_ids;
         value_grids = other.value_grids;
         value_grid_ids = other.value_grid_ids;
@@ -413,6 +418,26 @@ struct PhysicsTrackState
     ElementComponentId element;  //!< Element sampled for interaction
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Random number usage of a single sampling call in a step.
+ *
+ * This is written by the MSC and interaction appliers and cleared by the
+ * sampling diagnostic when \c CELERITAS_SAMPLING_COUNTERS is enabled.
+ */
+struct SamplingRecord
+{
+    ActionId action;  //!< Action that sampled
+    SamplingCounters counters;  //!< Random number usage
+    bool failed{false};  //!< Whether the interaction failed
+
+    //! Whether sampling occurred
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return static_cast<bool>(action);
+    }
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Initialize a physics track state.
@@ -453,6 +478,11 @@ struct PhysicsStateData
     AtomicRelaxStateData<W, M> relaxation;  //!< Scratch data
     StackAllocatorData<Secondary, W, M> secondaries;  //!< Secondary stack
 
+    // Sampling diagnostics [track], only with CELERITAS_SAMPLING_COUNTERS
+    StateItems<SamplingCounters> sampling_counters;
+    StateItems<SamplingRecord> msc_sampling;
+    StateItems<SamplingRecord> interaction_sampling;
+
     //// METHODS ////
 
     //! True if assigned
@@ -477,6 +507,10 @@ struct PhysicsStateData
         relaxation = other.relaxation;
         secondaries = other.secondaries;
 
+        sampling_counters = other.sampling_counters;
+        msc_sampling = other.msc_sampling;
+        interaction_sampling = other.interaction_sampling;
+
         return *this;
     }
 };
@@ -500,6 +534,12 @@ inline void resize(PhysicsStateData<Ownership::value, M>* state,
     resize(
         &state->secondaries,
         static_cast<size_type>(size * params.scalars.secondary_stack_factor));
+    if constexpr (CELERITAS_SAMPLING_COUNTERS)
+    {
+        resize(&state->sampling_counters, size);
+        resize(&state->msc_sampling, size);
+        resize(&state->interaction_sampling, size);
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -11,6 +11,7 @@
 #include <cmath>
 #include <map>
 #include <set>
+#include <string>
 #include <string_view>
 #include <tuple>
 #include <type_traits>
@@ -146,8 +147,13 @@ PhysicsParams::PhysicsParams(Input inp)
     HostValue host_data;
     this->build_options(inp.options, &host_data);
     this->build_ids(*inp.particles, &host_data);
-    this->build_xs(inp.options, *inp.materials, &host_data);
-    this->build_model_xs(*inp.materials, &host_data);
+    this->build_xs(inp.options,
+                   *inp.particles,
+                   *inp.materials,
+                   &host_data,
+                   &table_deviation_);
+    this->build_model_xs(
+        *inp.particles, *inp.materials, &host_data, &table_deviation_);
 
     // Add step limiter if being used (TODO: remove this hack from physics)
     if (inp.options.fixed_step_limiter > 0)
@@ -441,23 +447,34 @@ void PhysicsParams::build_ids(ParticleParams const& particles,
 //---------------------------------------------------------------------------//
 /*!
  * Construct cross section data.
+ *
+ * The maximum relative deviation of the stored values (due to the table
+ * storage precision) is accumulated over all materials for each
+ * particle, process, and grid type, e.g. \c "e-/eIoni/energy_loss".
  */
 void PhysicsParams::build_xs(Options const& opts,
+                             ParticleParams const& particles,
                              MaterialParams const& mats,
-                             HostValue* data) const
+                             HostValue* data,
+                             TableDeviation* deviation) const
 {
     CELER_EXPECT(*data);
+    CELER_EXPECT(deviation);
 
     using UPGridBuilder = Process::UPConstGridBuilder;
     using Energy = Applicability::Energy;
 
-    ValueGridInserter insert_grid(&data->reals, &data->value_grids);
     auto value_tables = make_builder(&data->value_tables);
     auto integral_xs = make_builder(&data->integral_xs);
     auto value_grid_ids = make_builder(&data->value_grid_ids);
-    auto build_grid
-        = [insert_grid](UPGridBuilder const& builder) -> ValueGridId {
-        return builder ? builder->build(insert_grid) : ValueGridId{};
+    auto build_grid = [data, deviation](UPGridBuilder const& builder,
+                                        std::string const& table) {
+        if (!builder)
+        {
+            return ValueGridId{};
+        }
+        return builder->build(ValueGridInserter{
+            &data->table_reals, &data->value_grids, &(*deviation)[table]});
     };
 
     Applicability applic;
@@ -496,6 +513,15 @@ void PhysicsParams::build_xs(Options const& opts,
 
             Process const& proc = *this->process(processes[pp_idx]);
 
+            // Name of each table for this particle and process
+            ValueGridArray<std::string> table_names;
+            for (auto vgt : range(ValueGridType::size_))
+            {
+                table_names[vgt] = particles.id_to_label(particle_id) + '/'
+                                   + std::string{proc.label()} + '/'
+                                   + to_cstring(vgt);
+            }
+
             // Grid IDs for each grid type, each material
             ValueGridArray<std::vector<ValueGridId>> temp_grid_ids;
             for (auto& vec : temp_grid_ids)
@@ -531,7 +557,7 @@ void PhysicsParams::build_xs(Options const& opts,
                 for (auto vgt : range(ValueGridType::size_))
                 {
                     temp_grid_ids[vgt][mat_id.get()]
-                        = build_grid(builders[vgt]);
+                        = build_grid(builders[vgt], table_names[vgt]);
                 }
 
                 if (processes[pp_idx] == data->hardwired.positron_annihilation)
@@ -552,7 +578,7 @@ void PhysicsParams::build_xs(Options const& opts,
                     auto const& grid_data = data->value_grids[grid_id];
                     auto data_ref = make_const_ref(*data);
                     UniformGrid const loge_grid(grid_data.log_energy);
-                    XsCalculator const calc_xs(grid_data, data_ref.reals);
+                    XsCalculator const calc_xs(grid_data, data_ref.table_reals);
 
                     // Check if the particle can have a discrete interaction at
                     // rest
@@ -634,18 +660,25 @@ void PhysicsParams::build_xs(Options const& opts,
 //---------------------------------------------------------------------------//
 /*!
  * Construct model cross section CDFs.
+ *
+ * The maximum relative deviation of the stored microscopic cross sections and
+ * of the normalized CDF is accumulated for each particle and model, e.g.
+ * \c "e-/eBremSB/micro_xs".
  */
-void PhysicsParams::build_model_xs(MaterialParams const& mats,
-                                   HostValue* data) const
+void PhysicsParams::build_model_xs(ParticleParams const& particles,
+                                   MaterialParams const& mats,
+                                   HostValue* data,
+                                   TableDeviation* deviation) const
 {
     CELER_EXPECT(*data);
-
-    ValueGridInserter insert_grid(&data->reals, &data->value_grids);
+    CELER_EXPECT(deviation);
 
     // Micro xs grid IDs for each model and applicable particle, each material,
     // and each element in the material
     std::vector<std::vector<std::vector<ValueGridId>>> temp_grid_ids(
         data->model_ids.size());
+    // Deviation of the CDF table for each model and applicable particle
+    std::vector<double*> table_dev(data->model_ids.size(), nullptr);
     size_type pm_idx{0};
 
     for (auto model_idx : range(this->num_models()))
@@ -689,6 +722,17 @@ void PhysicsParams::build_model_xs(MaterialParams const& mats,
                     auto& grid_ids = temp_grid_ids[pm_idx][mat_id.get()];
                     grid_ids.resize(material.num_elements());
 
+                    if (!table_dev[pm_idx])
+                    {
+                        std::string table
+                            = particles.id_to_label(applic.particle) + '/'
+                              + std::string{model.label()} + "/micro_xs";
+                        table_dev[pm_idx] = &(*deviation)[table];
+                    }
+                    ValueGridInserter insert_grid(&data->table_reals,
+                                                  &data->value_grids,
+                                                  table_dev[pm_idx]);
+
                     for (auto elcomp_idx : range(material.num_elements()))
                     {
                         CELER_ASSERT(builders[elcomp_idx]);
@@ -707,8 +751,9 @@ void PhysicsParams::build_model_xs(MaterialParams const& mats,
     auto value_grid_ids = make_builder(&data->value_grid_ids);
 
     // Construct model cross section CDF tables
-    for (auto& model_table : temp_grid_ids)
+    for (auto pm_idx : range(temp_grid_ids.size()))
     {
+        auto& model_table = temp_grid_ids[pm_idx];
         std::vector<ValueTableId> temp_table_ids(model_table.size());
         for (auto mat_idx : range<MaterialId::size_type>(model_table.size()))
         {
@@ -720,10 +765,11 @@ void PhysicsParams::build_model_xs(MaterialParams const& mats,
             }
 
             // Get the xs value for the given element and bin
-            auto get_value = [&](size_type elcomp, size_type bin) -> real_type& {
+            auto get_value = [&](size_type elcomp,
+                                 size_type bin) -> table_real_type& {
                 XsGridData& grid = data->value_grids[grid_ids[elcomp]];
                 CELER_ASSERT(bin < grid.value.size());
-                return data->reals[grid.value[bin]];
+                return data->table_reals[grid.value[bin]];
             };
 
             // Get the number of grid points: the energy grids are the
@@ -732,23 +778,34 @@ void PhysicsParams::build_model_xs(MaterialParams const& mats,
 
             // Calculate the cross section CDF
             auto const&& elements = mats.get(MaterialId{mat_idx}).elements();
+            std::vector<real_type> cdf(elements.size());
             for (auto bin_idx : range(num_bins))
             {
                 real_type cum_xs{0};
                 for (auto elcomp_idx : range(elements.size()))
                 {
-                    real_type& xs = get_value(elcomp_idx, bin_idx);
-                    cum_xs += xs * elements[elcomp_idx].fraction;
-                    xs = cum_xs;
+                    cum_xs += get_value(elcomp_idx, bin_idx)
+                              * elements[elcomp_idx].fraction;
+                    cdf[elcomp_idx] = cum_xs;
                 }
 
-                // Normalize
+                // Normalize and store at the table precision
                 if (cum_xs > 0)
                 {
                     for (auto elcomp_idx : range(elements.size()))
                     {
-                        real_type& xs = get_value(elcomp_idx, bin_idx);
-                        xs /= cum_xs;
+                        cdf[elcomp_idx] /= cum_xs;
+                    }
+                }
+                for (auto elcomp_idx : range(elements.size()))
+                {
+                    table_real_type& xs = get_value(elcomp_idx, bin_idx);
+                    xs = cdf[elcomp_idx];
+                    if (cdf[elcomp_idx] != 0)
+                    {
+                        *table_dev[pm_idx] = std::max(
+                            *table_dev[pm_idx],
+                            std::fabs(double(xs) / cdf[elcomp_idx] - 1));
                     }
                 }
             }
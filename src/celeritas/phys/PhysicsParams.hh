@@ -21,6 +21,7 @@
 #include "celeritas/Types.hh"
 #include "celeritas/Units.hh"
 #include "celeritas/global/ActionInterface.hh"
+#include "celeritas/grid/ValueGridInserter.hh"
 
 #include "Model.hh"
 #include "PhysicsData.hh"
@@ -187,6 +188,9 @@ class PhysicsParams final : public ParamsDataInterface<PhysicsParamsData>
     // Get the processes that apply to a particular particle
     SpanConstProcessId processes(ParticleId) const;
 
+    //! Maximum relative error of each stored table (see \c table_real_type)
+    TableDeviation const& table_deviation() const { return table_deviation_; }
+
     //! Access physics properties on the host
     HostRef const& host_ref() const final { return data_.host_ref(); }
 
@@ -211,6 +215,7 @@ class PhysicsParams final : public ParamsDataInterface<PhysicsParamsData>
     VecProcess processes_;
     VecModel models_;
     SPConstRelaxation relaxation_;
+    TableDeviation table_deviation_{};
 
     // Host/device storage and reference
     CollectionMirror<PhysicsParamsData> data_;
@@ -220,9 +225,14 @@ class PhysicsParams final : public ParamsDataInterface<PhysicsParamsData>
     void build_options(Options const& opts, HostValue* data) const;
     void build_ids(ParticleParams const& particles, HostValue* data) const;
     void build_xs(Options const& opts,
+                  ParticleParams const& particles,
                   MaterialParams const& mats,
-                  HostValue* data) const;
-    void build_model_xs(MaterialParams const& mats, HostValue* data) const;
+                  HostValue* data,
+                  TableDeviation* deviation) const;
+    void build_model_xs(ParticleParams const& particles,
+                        MaterialParams const& mats,
+                        HostValue* data,
+                        TableDeviation* deviation) const;
 };
 
 //---------------------------------------------------------------------------//
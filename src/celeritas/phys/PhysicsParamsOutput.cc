@@ -96,6 +96,7 @@ void PhysicsParamsOutput::output(JsonPimpl* j) const
         auto sizes = json::object();
 #define PPO_SAVE_SIZE(NAME) sizes[#NAME] = data.NAME.size()
         PPO_SAVE_SIZE(reals);
+        PPO_SAVE_SIZE(table_reals);
         PPO_SAVE_SIZE(model_ids);
         PPO_SAVE_SIZE(value_grids);
         PPO_SAVE_SIZE(value_grid_ids);
@@ -108,6 +109,17 @@ void PhysicsParamsOutput::output(JsonPimpl* j) const
         obj["sizes"] = std::move(sizes);
     }
 
+    if constexpr (!std::is_same_v<table_real_type, real_type>)
+    {
+        // Save loss of precision from reduced-precision table storage
+        auto deviation = json::object();
+        for (auto const& [table, dev] : physics_->table_deviation())
+        {
+            deviation[table] = dev;
+        }
+        obj["table_deviation"] = std::move(deviation);
+    }
+
     j->obj = std::move(obj);
 }
 
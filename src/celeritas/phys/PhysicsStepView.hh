@@ -72,6 +72,9 @@ class PhysicsStepView
     // Set secondaries during an interaction
     inline CELER_FUNCTION void secondaries(Span<Secondary>);
 
+    // Reset the sampling counters and records
+    inline CELER_FUNCTION void reset_sampling();
+
     // Total (process-integrated) macroscopic xs [len^-1]
     CELER_FORCEINLINE_FUNCTION real_type macro_xs() const;
 
@@ -84,6 +87,15 @@ class PhysicsStepView
     // Retrieve MSC step data
     inline CELER_FUNCTION MscStep const& msc_step() const;
 
+    // Mutable access to random number usage counters
+    inline CELER_FUNCTION SamplingCounters& sampling_counters();
+
+    // Mutable access to the MSC sampling record
+    inline CELER_FUNCTION SamplingRecord& msc_sampling();
+
+    // Mutable access to the discrete interaction sampling record
+    inline CELER_FUNCTION SamplingRecord& interaction_sampling();
+
     // Access local energy deposition
     inline CELER_FUNCTION Energy energy_deposition() const;
 
@@ -199,6 +211,17 @@ CELER_FUNCTION void PhysicsStepView::secondaries(Span<Secondary> sec)
     this->state().secondaries = sec;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Reset the sampling counters and records at the start of a step.
+ */
+CELER_FUNCTION void PhysicsStepView::reset_sampling()
+{
+    this->sampling_counters() = {};
+    this->msc_sampling() = {};
+    this->interaction_sampling() = {};
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Calculated process-integrated macroscopic XS.
@@ -241,6 +264,35 @@ CELER_FUNCTION MscStep const& PhysicsStepView::msc_step() const
     return states_.msc_step[track_slot_];
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Mutable access to random number usage counters.
+ *
+ * This is only allocated when \c CELERITAS_SAMPLING_COUNTERS is enabled.
+ */
+CELER_FUNCTION SamplingCounters& PhysicsStepView::sampling_counters()
+{
+    return states_.sampling_counters[track_slot_];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Mutable access to the MSC sampling record.
+ */
+CELER_FUNCTION SamplingRecord& PhysicsStepView::msc_sampling()
+{
+    return states_.msc_sampling[track_slot_];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Mutable access to the discrete interaction sampling record.
+ */
+CELER_FUNCTION SamplingRecord& PhysicsStepView::interaction_sampling()
+{
+    return states_.interaction_sampling[track_slot_];
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Access accumulated energy deposition.
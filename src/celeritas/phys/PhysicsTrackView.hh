@@ -557,7 +557,7 @@ PhysicsTrackView::make_element_selector(ValueTableId table_id,
     return TabulatedElementSelector{table,
                                     params_.value_grids,
                                     params_.value_grid_ids,
-                                    params_.reals,
+                                    params_.table_reals,
                                     energy};
 }
 
@@ -669,7 +669,7 @@ template<class T>
 CELER_FUNCTION T PhysicsTrackView::make_calculator(ValueGridId id) const
 {
     CELER_EXPECT(id < params_.value_grids.size());
-    return T{params_.value_grids[id], params_.reals};
+    return T{params_.value_grids[id], params_.table_reals};
 }
 
 //---------------------------------------------------------------------------//
@@ -23,6 +23,7 @@
 #include "celeritas/em/process/MuIonizationProcess.hh"
 #include "celeritas/em/process/PhotoelectricProcess.hh"
 #include "celeritas/em/process/RayleighProcess.hh"
+#include "celeritas/io/ElementDataCache.hh"
 #include "celeritas/io/ImportData.hh"
 #include "celeritas/io/ImportedElementalMapLoader.hh"
 #include "celeritas/io/LivermorePEReader.hh"
@@ -180,7 +181,7 @@ auto ProcessBuilder::build_ebrems() -> SPProcess
 
     if (!read_sb_)
     {
-        read_sb_ = SeltzerBergerReader{};
+        read_sb_ = CachedElementReader{SeltzerBergerReader{}};
     }
 
     return std::make_shared<BremsstrahlungProcess>(
@@ -204,7 +205,7 @@ auto ProcessBuilder::build_photoelectric() -> SPProcess
 {
     if (!read_livermore_)
     {
-        read_livermore_ = LivermorePEReader{};
+        read_livermore_ = CachedElementReader{LivermorePEReader{}};
     }
 
     return std::make_shared<PhotoelectricProcess>(
@@ -0,0 +1,91 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/WoodcockData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/data/Collection.hh"
+#include "geocel/Types.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/grid/XsGridData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+//! Opaque index of a delta-tracking region
+using WoodcockRegionId = OpaqueId<struct WoodcockRegion_>;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Shared data for Woodcock (delta) tracking of neutral particles.
+ *
+ * Each volume is either part of a single delta-tracking region or is
+ * transported conventionally. Each region stores a majorant macroscopic
+ * cross section grid for every particle type; a grid is empty (false) if the
+ * particle type is not delta-tracked.
+ */
+template<Ownership W, MemSpace M>
+struct WoodcockParamsData
+{
+    template<class T>
+    using Items = Collection<T, W, M>;
+    template<class T>
+    using VolumeItems = Collection<T, W, M, VolumeId>;
+    template<class T>
+    using RegionItems = Collection<T, W, M, WoodcockRegionId>;
+
+    //// DATA ////
+
+    //! Delta-tracking region for each volume (null if not tagged)
+    VolumeItems<WoodcockRegionId> volume_region;
+
+    //! Whether each region is declared convex (nonzero)
+    RegionItems<char> convex;
+
+    //! Majorant cross section grid, indexed by [region][particle]
+    Items<XsGridData> majorant_xs;
+
+    //! Number of particle types per region
+    size_type num_particles{0};
+
+    //! Backend storage
+    Items<table_real_type> reals;
+
+    //// METHODS ////
+
+    //! True if assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !volume_region.empty() && num_particles > 0
+               && majorant_xs.size() == convex.size() * num_particles
+               && !majorant_xs.empty() && !reals.empty();
+    }
+
+    //! Get the majorant grid for a region and particle
+    CELER_FUNCTION XsGridData const&
+    majorant(WoodcockRegionId region, ParticleId particle) const
+    {
+        CELER_EXPECT(region && particle < num_particles);
+        using IdT = ItemId<XsGridData>;
+        return majorant_xs[IdT{region.get() * num_particles + particle.get()}];
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    WoodcockParamsData& operator=(WoodcockParamsData<W2, M2> const& other)
+    {
+        CELER_EXPECT(other);
+        volume_region = other.volume_region;
+        convex = other.convex;
+        majorant_xs = other.majorant_xs;
+        num_particles = other.num_particles;
+        reals = other.reals;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
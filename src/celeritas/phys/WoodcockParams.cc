@@ -0,0 +1,224 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/WoodcockParams.cc
+//---------------------------------------------------------------------------//
+#include "WoodcockParams.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <set>
+#include <string>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "corecel/grid/UniformGridData.hh"
+#include "corecel/math/NumericLimits.hh"
+#include "celeritas/geo/GeoMaterialParams.hh"
+#include "celeritas/mat/MaterialParams.hh"
+#include "celeritas/mat/MaterialView.hh"
+
+#include "ParticleParams.hh"
+#include "PhysicsParams.hh"
+#include "PhysicsTrackView.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the total macroscopic cross section on the host.
+ *
+ * The physics track view only accesses the shared params data when
+ * calculating cross sections, so an empty state is sufficient.
+ */
+class TotalXsCalculator
+{
+  public:
+    using Energy = units::MevEnergy;
+
+    TotalXsCalculator(MaterialParams const& materials,
+                      PhysicsParams const& physics)
+        : materials_(materials.host_ref()), physics_(physics.host_ref())
+    {
+    }
+
+    real_type operator()(ParticleId pid, MaterialId mid, Energy energy) const
+    {
+        PhysicsTrackView phys(physics_, states_, pid, mid, TrackSlotId{0});
+        MaterialView mat(materials_, mid);
+        real_type result = 0;
+        for (auto ppid :
+             range(ParticleProcessId{phys.num_particle_processes()}))
+        {
+            result += phys.calc_xs(ppid, mat, energy);
+        }
+        return result;
+    }
+
+  private:
+    HostCRef<MaterialParamsData> const& materials_;
+    HostCRef<PhysicsParamsData> const& physics_;
+    HostRef<PhysicsStateData> states_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a majorant to the table precision without underestimating it.
+ *
+ * The relative change is accumulated into the table deviation.
+ */
+table_real_type round_up_to_table(real_type value, double& deviation)
+{
+    auto result = static_cast<table_real_type>(value);
+    if (result < value)
+    {
+        result = std::nextafter(result, numeric_limits<table_real_type>::max());
+    }
+    if (value != 0)
+    {
+        deviation = std::max(deviation, std::fabs(double(result) / value - 1));
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from materials and physics.
+ */
+WoodcockParams::WoodcockParams(GeoMaterialParams const& geo_mat,
+                               MaterialParams const& materials,
+                               ParticleParams const& particles,
+                               PhysicsParams const& physics,
+                               Input const& input)
+{
+    CELER_VALIDATE(input, << "invalid Woodcock tracking input");
+
+    auto const& volume_to_mat = geo_mat.host_ref().materials;
+    HostVal<WoodcockParamsData> host_data;
+    host_data.num_particles = particles.size();
+
+    // Mark delta-tracked particles
+    std::vector<bool> is_tracked(particles.size(), false);
+    for (ParticleId pid : input.particles)
+    {
+        CELER_VALIDATE(pid < particles.size(),
+                       << "invalid particle ID for Woodcock tracking");
+        CELER_VALIDATE(particles.get(pid).charge() == zero_quantity(),
+                       << "cannot apply Woodcock tracking to charged "
+                          "particle '"
+                       << particles.id_to_label(pid) << "'");
+        is_tracked[pid.get()] = true;
+    }
+
+    // Assign volumes to regions and find the materials in each region
+    std::vector<WoodcockRegionId> volume_region(volume_to_mat.size());
+    std::vector<std::set<MaterialId>> region_mats(input.regions.size());
+    for (auto r : range(WoodcockRegionId(input.regions.size())))
+    {
+        for (VolumeId vid : input.regions[r.get()])
+        {
+            CELER_VALIDATE(vid < volume_to_mat.size(),
+                           << "invalid volume ID for Woodcock region "
+                           << r.get());
+            CELER_VALIDATE(!volume_region[vid.get()],
+                           << "volume " << vid.get()
+                           << " is assigned to multiple Woodcock regions");
+            MaterialId mid = volume_to_mat[vid];
+            CELER_VALIDATE(mid,
+                           << "volume " << vid.get()
+                           << " in Woodcock region " << r.get()
+                           << " has no material");
+            volume_region[vid.get()] = r;
+            region_mats[r.get()].insert(mid);
+        }
+        CELER_VALIDATE(!region_mats[r.get()].empty(),
+                       << "Woodcock region " << r.get() << " is empty");
+    }
+    make_builder(&host_data.volume_region)
+        .insert_back(volume_region.begin(), volume_region.end());
+    {
+        auto convex = make_builder(&host_data.convex);
+        for (auto r : range(input.regions.size()))
+        {
+            convex.push_back(!input.convex.empty() && input.convex[r]);
+        }
+    }
+
+    // Construct the log-energy grid shared by all majorants
+    real_type const log_min = std::log(value_as<Energy>(input.min_energy));
+    real_type const log_max = std::log(value_as<Energy>(input.max_energy));
+    size_type const num_points
+        = 1
+          + static_cast<size_type>(std::ceil(
+              input.points_per_decade * (log_max - log_min) / std::log(10.0)));
+    auto const loge_grid
+        = UniformGridData::from_bounds(log_min, log_max, num_points);
+
+    // Tabulate the majorant for each region and particle
+    TotalXsCalculator calc_xs(materials, physics);
+    auto majorant_xs = make_builder(&host_data.majorant_xs);
+    auto reals = make_builder(&host_data.reals);
+    std::vector<table_real_type> values(num_points);
+    for (auto r : range(region_mats.size()))
+    {
+        auto const& mats = region_mats[r];
+        for (auto pid : range(ParticleId(particles.size())))
+        {
+            if (!is_tracked[pid.get()])
+            {
+                majorant_xs.push_back({});
+                continue;
+            }
+            double& dev = table_deviation_["region" + std::to_string(r) + '/'
+                                           + particles.id_to_label(pid)];
+
+            for (auto i : range(num_points))
+            {
+                // Sample the cross section over both adjacent intervals so
+                // that interpolation within either one is conservative
+                size_type const lo = (i > 0 ? i - 1 : i);
+                size_type const hi = std::min(i + 1, num_points - 1);
+                size_type const num_samples = input.num_subsamples * (hi - lo);
+                real_type max_xs = 0;
+                for (auto j : range(num_samples + 1))
+                {
+                    real_type loge = loge_grid.front
+                                     + loge_grid.delta
+                                           * (lo
+                                              + real_type(j)
+                                                    / input.num_subsamples);
+                    Energy energy{std::exp(std::min(loge, log_max))};
+                    for (MaterialId mid : mats)
+                    {
+                        max_xs = std::max(max_xs, calc_xs(pid, mid, energy));
+                    }
+                }
+                values[i] = round_up_to_table(input.scale * max_xs, dev);
+            }
+
+            XsGridData grid;
+            grid.log_energy = loge_grid;
+            grid.value = reals.insert_back(values.begin(), values.end());
+            CELER_ASSERT(grid);
+            majorant_xs.push_back(grid);
+        }
+    }
+
+    log_table_deviation("Woodcock majorant", table_deviation_);
+
+    num_regions_ = input.regions.size();
+    data_ = CollectionMirror<WoodcockParamsData>{std::move(host_data)};
+    CELER_ENSURE(data_);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
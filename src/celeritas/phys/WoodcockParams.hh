@@ -0,0 +1,115 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/WoodcockParams.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+
+#include "corecel/data/CollectionMirror.hh"
+#include "corecel/data/ParamsDataInterface.hh"
+#include "celeritas/Quantities.hh"
+#include "celeritas/grid/ValueGridInserter.hh"
+
+#include "WoodcockData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+class GeoMaterialParams;
+class MaterialParams;
+class ParticleParams;
+class PhysicsParams;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Majorant cross sections for Woodcock (delta) tracking of neutral particles.
+ *
+ * Each region is a set of volumes inside which the given neutral particles
+ * sample their distance to collision from a region-wide majorant cross
+ * section rather than the cross section of the current material. The
+ * majorant is tabulated on a uniform log-energy grid: each grid point stores
+ * the (scaled) maximum total macroscopic cross section over all materials in
+ * the region and over the two adjacent energy intervals, so that linear
+ * interpolation between grid points never underestimates the true cross
+ * section at the sampled energies. If the tables are stored at reduced
+ * precision (\c CELERITAS_TABLE_REAL_TYPE), the values are rounded up.
+ *
+ * A valid majorant requires that the straight flight to a tentative collision
+ * only traverses materials in the region. For a general region, the flight is
+ * therefore navigated to check that it never leaves the region. This check is
+ * skipped for regions declared convex (e.g. a full calorimeter module rather
+ * than the set of its absorber plates), for which delta tracking does not
+ * need to cross internal boundaries at all. Declaring a non-convex region
+ * convex can bias the results.
+ */
+class WoodcockParams final : public ParamsDataInterface<WoodcockParamsData>
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using Energy = units::MevEnergy;
+    using VecVolume = std::vector<VolumeId>;
+    //!@}
+
+    struct Input
+    {
+        //! Neutral particle types to delta-track
+        std::vector<ParticleId> particles;
+        //! Volumes that make up each region
+        std::vector<VecVolume> regions;
+        //! Whether each region is convex (empty if none are)
+        std::vector<bool> convex;
+
+        //! Energy range of the majorant grid
+        Energy min_energy{1e-4};
+        Energy max_energy{1e8};
+        //! Number of majorant grid points per decade of energy
+        size_type points_per_decade{8};
+        //! Number of cross section evaluations per grid interval
+        size_type num_subsamples{8};
+        //! Safety factor to multiply the tabulated majorant by
+        real_type scale{1.05};
+
+        //! True if the input is valid
+        explicit operator bool() const
+        {
+            return !particles.empty() && !regions.empty()
+                   && (convex.empty() || convex.size() == regions.size())
+                   && min_energy > zero_quantity() && max_energy > min_energy
+                   && points_per_decade > 0 && num_subsamples > 0
+                   && scale >= 1;
+        }
+    };
+
+  public:
+    // Construct from materials and physics
+    WoodcockParams(GeoMaterialParams const& geo_mat,
+                   MaterialParams const& materials,
+                   ParticleParams const& particles,
+                   PhysicsParams const& physics,
+                   Input const& input);
+
+    //! Number of regions
+    WoodcockRegionId::size_type num_regions() const { return num_regions_; }
+
+    //! Maximum relative error of each stored majorant table
+    TableDeviation const& table_deviation() const { return table_deviation_; }
+
+    //! Access data on the host
+    HostRef const& host_ref() const final { return data_.host_ref(); }
+
+    //! Access data on the device
+    DeviceRef const& device_ref() const final { return data_.device_ref(); }
+
+  private:
+    WoodcockRegionId::size_type num_regions_{};
+    TableDeviation table_deviation_;
+    CollectionMirror<WoodcockParamsData> data_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
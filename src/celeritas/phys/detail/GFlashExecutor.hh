@@ -0,0 +1,153 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/detail/GFlashExecutor.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/data/StackAllocator.hh"
+#include "corecel/math/ArrayOperators.hh"
+#include "corecel/math/ArrayUtils.hh"
+#include "celeritas/Constants.hh"
+#include "celeritas/global/CoreTrackView.hh"
+#include "celeritas/random/distribution/UniformRealDistribution.hh"
+
+#include "../GFlashData.hh"
+#include "../GFlashShowerSampler.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Replace an electromagnetic shower with parameterized energy spots.
+ *
+ * This is applied after the physics pre-step so that the step's energy
+ * deposition has been reset. Eligible tracks distribute their full energy
+ * (plus the annihilation energy for positrons) among the spots and are
+ * killed; the along-step and post-step actions are set to this action so that
+ * the track is neither transported nor interacts. The geometry state of the
+ * killed track is used to locate the volume of each spot and is then restored
+ * to the shower origin.
+ *
+ * If the stream's spot stack is full, the track is left unchanged and the
+ * physics failure action is used with a zero step limit so that the shower is
+ * parameterized again on the next step (as with a failed secondary allocation
+ * in an interaction).
+ */
+struct GFlashExecutor
+{
+    //// DATA ////
+
+    NativeCRef<GFlashParamsData> params;
+    NativeRef<GFlashStateData> state;
+    ActionId action;
+
+    //// FUNCTIONS ////
+
+    inline CELER_FUNCTION void operator()(celeritas::CoreTrackView& track);
+};
+
+//---------------------------------------------------------------------------//
+CELER_FUNCTION void GFlashExecutor::operator()(celeritas::CoreTrackView& track)
+{
+    using Energy = units::MevEnergy;
+
+    auto particle = track.make_particle_view();
+    {
+        auto const& scalars = params.scalars;
+        ParticleId pid = particle.particle_id();
+        if ((pid != scalars.electron && pid != scalars.positron
+             && pid != scalars.gamma)
+            || particle.energy() < scalars.min_energy)
+        {
+            return;
+        }
+    }
+
+    auto geo = track.make_geo_view();
+    if (geo.is_outside())
+    {
+        return;
+    }
+    MaterialId mat_id = params.volume_material[geo.volume_id()];
+    if (!mat_id)
+    {
+        // Not a parameterized volume
+        return;
+    }
+
+    GFlashShowerSampler sample_spot(params.scalars.coeffs,
+                                    params.materials[mat_id],
+                                    params.scalars.max_radius,
+                                    particle.energy());
+    if (!sample_spot)
+    {
+        // Energy is too low for this material
+        return;
+    }
+
+    auto sim = track.make_sim_view();
+    size_type const num_spots = params.scalars.num_spots;
+    StackAllocator<GFlashSpot> allocate(state.spots);
+    GFlashSpot* spots = allocate(num_spots);
+    if (CELER_UNLIKELY(!spots))
+    {
+        // Out of spot storage: try again at the next step
+        auto phys = track.make_physics_view();
+        sim.step_limit({0, phys.scalars().failure_action()});
+        return;
+    }
+
+    real_type deposited = value_as<Energy>(particle.energy());
+    if (particle.is_antiparticle())
+    {
+        // Energy conservation for annihilating positrons
+        deposited += 2 * value_as<units::MevMass>(particle.mass());
+    }
+
+    Real3 const pos = geo.pos();
+    Real3 const dir = geo.dir();
+    {
+        auto rng = track.make_rng_engine();
+        UniformRealDistribution<real_type> sample_phi(0, 2 * constants::pi);
+        Energy const spot_energy{deposited / num_spots};
+        for (size_type i = 0; i < num_spots; ++i)
+        {
+            auto s = sample_spot(rng);
+            Real3 radial = rotate(from_spherical(real_type{0}, sample_phi(rng)),
+                                  dir);
+            GFlashSpot& spot = spots[i];
+            spot.pos = pos + s.depth * dir + s.radius * radial;
+            spot.dir = dir;
+            spot.energy = spot_energy;
+            spot.time = sim.time();
+            spot.event = sim.event_id();
+            spot.track = sim.track_id();
+            spot.parent = sim.parent_id();
+            spot.particle = particle.particle_id();
+            spot.num_steps = sim.num_steps();
+
+            // Find the volume containing the spot
+            geo = GeoTrackInitializer{spot.pos, dir};
+            spot.volume = (geo.failed() || geo.is_outside()) ? VolumeId{}
+                                                             : geo.volume_id();
+        }
+    }
+    geo = GeoTrackInitializer{pos, dir};
+
+    // Kill the track: its energy is deposited by the spots
+    particle.subtract_energy(particle.energy());
+    sim.status(TrackStatus::killed);
+    sim.along_step_action(action);
+    sim.reset_step_limit(StepLimit{0, action});
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
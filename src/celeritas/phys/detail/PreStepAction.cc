@@ -7,13 +7,21 @@
 //---------------------------------------------------------------------------//
 #include "PreStepAction.hh"
 
+#include <cmath>
 #include <utility>
+#include <vector>
+
+#include "corecel/Config.hh"
 
 #include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
 #include "celeritas/global/ActionLauncher.hh"
 #include "celeritas/global/CoreParams.hh"
 #include "celeritas/global/CoreState.hh"
+#include "celeritas/global/CoreTrackView.hh"
 #include "celeritas/global/TrackExecutor.hh"
+#include "celeritas/random/XorwowRngBatch.hh"
 
 #include "PreStepExecutor.hh"  // IWYU pragma: associated
 
@@ -21,6 +29,51 @@ namespace celeritas
 {
 namespace detail
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the number of mean free paths for all tracks that need one.
+ *
+ * This selects the tracks that \c PreStepExecutor would sample and draws
+ * their uniform deviates together with the SIMD batch generator. The result
+ * is indexed by track slot, and each value and final RNG state is identical
+ * to sampling one track at a time.
+ */
+[[maybe_unused]] std::vector<real_type>
+sample_num_mfp(CoreParams const& params, CoreState<MemSpace::host>& state)
+{
+    auto const& params_ref = params.ref<MemSpace::host>();
+    auto const& state_ref = state.ref();
+
+    std::vector<TrackSlotId> slots;
+    for (auto slot : range(TrackSlotId{state.size()}))
+    {
+        CoreTrackView track(params_ref, state_ref, slot);
+        auto status = track.make_sim_view().status();
+        if ((status == TrackStatus::initializing
+             || status == TrackStatus::alive)
+            && !track.make_physics_view().has_interaction_mfp())
+        {
+            slots.push_back(slot);
+        }
+    }
+
+    std::vector<real_type> xi(slots.size());
+    fill_canonical_batch(state_ref.rng, make_span(slots), make_span(xi));
+
+    // Transform as in ExponentialDistribution
+    std::vector<real_type> result(state.size());
+    for (auto i : range(slots.size()))
+    {
+        result[slots[i].get()] = -std::log(xi[i]);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct with an action ID.
@@ -33,11 +86,22 @@ PreStepAction::PreStepAction(ActionId aid)
 //---------------------------------------------------------------------------//
 /*!
  * Launch the pre-step action on host.
+ *
+ * With the XORWOW generator the mean free paths are sampled in bulk before
+ * the launch. This is disabled when sampling counters are enabled, since
+ * the bulk draws are not tallied.
  */
 void PreStepAction::step(CoreParams const& params, CoreStateHost& state) const
 {
+    PreStepExecutor execute_track;
+#if (CELERITAS_CORE_RNG == CELERITAS_CORE_RNG_XORWOW) \
+    && !CELERITAS_SAMPLING_COUNTERS
+    auto num_mfp = sample_num_mfp(params, state);
+    execute_track.num_mfp = make_span(num_mfp);
+#endif
+
     TrackExecutor execute{
-        params.ptr<MemSpace::native>(), state.ptr(), PreStepExecutor{}};
+        params.ptr<MemSpace::native>(), state.ptr(), execute_track};
     return launch_action(*this, params, state, execute);
 }
 
@@ -10,6 +10,7 @@
 #include "corecel/Config.hh"
 
 #include "corecel/Macros.hh"
+#include "corecel/cont/Span.hh"
 #include "corecel/math/Quantity.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/global/CoreTrackView.hh"
@@ -32,11 +33,18 @@ namespace detail
  * - Reset track properties (todo: move to track initialization?)
  * - Sample the mean free path and calculate the physics step limits.
  *
+ * On host, the number of mean free paths to the next interaction can be
+ * sampled for all tracks in bulk before launching (see \c PreStepAction ). The
+ * values are then passed in indexed by track slot.
+ *
  * \note This executor applies to *all* tracks, including inactive ones. It
  *   \em must be run on all thread IDs to properly initialize secondaries.
  */
 struct PreStepExecutor
 {
+    //! Optional presampled number of mean free paths [track slot]
+    Span<real_type const> num_mfp;
+
     inline CELER_FUNCTION void
     operator()(celeritas::CoreTrackView const& track);
 };
@@ -74,6 +82,9 @@ PreStepExecutor::operator()(celeritas::CoreTrackView const& track)
         step.reset_energy_deposition();
         step.secondaries({});
         step.element({});
+#if CELERITAS_SAMPLING_COUNTERS
+        step.reset_sampling();
+#endif
     }
 
     if (CELER_UNLIKELY(sim.status() == TrackStatus::errored))
@@ -89,10 +100,18 @@ PreStepExecutor::operator()(celeritas::CoreTrackView const& track)
     auto phys = track.make_physics_view();
     if (!phys.has_interaction_mfp())
     {
-        // Sample mean free path
-        auto rng = track.make_rng_engine();
-        ExponentialDistribution<real_type> sample_exponential;
-        phys.interaction_mfp(sample_exponential(rng));
+        if (!num_mfp.empty())
+        {
+            // Mean free path was sampled before launching
+            phys.interaction_mfp(num_mfp[track.track_slot_id().get()]);
+        }
+        else
+        {
+            // Sample mean free path
+            auto rng = track.make_rng_engine();
+            ExponentialDistribution<real_type> sample_exponential;
+            phys.interaction_mfp(sample_exponential(rng));
+        }
     }
 
     // Calculate physics step limits and total macro xs
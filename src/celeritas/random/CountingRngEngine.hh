@@ -0,0 +1,129 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/random/CountingRngEngine.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+
+#include "distribution/GenerateCanonical.hh"
+#include "detail/GenerateCanonical32.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Random number usage accumulated by a track.
+ */
+struct SamplingCounters
+{
+    size_type draws{0};  //!< Number of 32-bit random numbers drawn
+    size_type iterations{0};  //!< Number of sampling loop iterations
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Wrap a track's RNG engine to count its use by samplers.
+ *
+ * This is used by \c CoreTrackView when Celeritas is configured with
+ * \c CELERITAS_SAMPLING_COUNTERS . Each call to the engine increments the
+ * track's draw counter, and sampling loops that call \c count_iteration
+ * increment its iteration counter. The wrapped engine produces the same
+ * sequence of random numbers as the original.
+ */
+template<class Engine>
+class CountingRngEngine
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using result_type = typename Engine::result_type;
+    //!@}
+
+  public:
+    //! Construct with the engine and the track's counters
+    CELER_FUNCTION
+    CountingRngEngine(Engine const& engine, SamplingCounters* counters)
+        : engine_{engine}, counters_{counters}
+    {
+        CELER_EXPECT(counters_);
+    }
+
+    //! Sample a random number and increment the draw counter
+    CELER_FORCEINLINE_FUNCTION result_type operator()()
+    {
+        ++counters_->draws;
+        return engine_();
+    }
+
+    //! Increment the sampling loop counter
+    CELER_FORCEINLINE_FUNCTION void count_iteration()
+    {
+        ++counters_->iterations;
+    }
+
+    //!@{
+    //! Forwarded functions
+    static CELER_CONSTEXPR_FUNCTION result_type min() { return Engine::min(); }
+    static CELER_CONSTEXPR_FUNCTION result_type max() { return Engine::max(); }
+    //!@}
+
+  private:
+    Engine engine_;
+    SamplingCounters* counters_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Specialization of GenerateCanonical for CountingRngEngine.
+ *
+ * This uses the same 32-bit algorithm as the core engines so that the counted
+ * sequence is unchanged.
+ */
+template<class Engine, class RealType>
+class GenerateCanonical<CountingRngEngine<Engine>, RealType>
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using real_type = RealType;
+    using result_type = RealType;
+    //!@}
+
+  public:
+    //! Sample a random number on [0, 1)
+    CELER_FORCEINLINE_FUNCTION result_type
+    operator()(CountingRngEngine<Engine>& rng)
+    {
+        return detail::GenerateCanonical32<RealType>()(rng);
+    }
+};
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Mark an iteration of a sampling loop.
+ *
+ * Rejection loops call this at the start of each iteration. It compiles to
+ * nothing unless the engine counts its use.
+ */
+template<class Engine>
+CELER_FORCEINLINE_FUNCTION void count_iteration(Engine&)
+{
+}
+
+//! Increment the iteration counter of a counting engine
+template<class Engine>
+CELER_FORCEINLINE_FUNCTION void count_iteration(CountingRngEngine<Engine>& rng)
+{
+    rng.count_iteration();
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
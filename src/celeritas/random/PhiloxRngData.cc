@@ -0,0 +1,75 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/random/PhiloxRngData.cc
+//---------------------------------------------------------------------------//
+#include "PhiloxRngData.hh"
+
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/data/Collection.hh"
+#include "corecel/data/CollectionBuilder.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Resize and seed the RNG states.
+ *
+ * Since the generator is counter-based, no random initialization is needed:
+ * each track slot starts at the beginning of a distinct subsequence
+ * determined by the stream and slot index.
+ */
+template<MemSpace M>
+void resize(PhiloxRngStateData<Ownership::value, M>* state,
+            HostCRef<PhiloxRngParamsData> const& params,
+            StreamId stream,
+            size_type size)
+{
+    CELER_EXPECT(size > 0);
+    CELER_EXPECT(params);
+
+    // Create initial counters in host memory
+    HostVal<PhiloxRngStateData> host_state;
+    resize(&host_state.state, size);
+    for (auto i : range(size))
+    {
+        host_state.state[TrackSlotId{i}].counter
+            = {0u,
+               0u,
+               static_cast<PhiloxUInt>(i),
+               static_cast<PhiloxUInt>(stream.unchecked_get())};
+    }
+
+    // Move or copy to input
+    if (M == MemSpace::host)
+    {
+        state->state = std::move(host_state.state);
+    }
+    else
+    {
+        *state = host_state;
+    }
+
+    CELER_ENSURE(*state);
+    CELER_ENSURE(state->size() == size);
+}
+
+//---------------------------------------------------------------------------//
+// Explicit instantiations
+template void resize(HostVal<PhiloxRngStateData>*,
+                     HostCRef<PhiloxRngParamsData> const&,
+                     StreamId,
+                     size_type);
+
+template void resize(PhiloxRngStateData<Ownership::value, MemSpace::device>*,
+                     HostCRef<PhiloxRngParamsData> const&,
+                     StreamId,
+                     size_type);
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
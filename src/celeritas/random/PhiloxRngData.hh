@@ -0,0 +1,130 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/random/PhiloxRngData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstdint>
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Array.hh"
+#include "corecel/data/Collection.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+//! 32-bit unsigned integer type for Philox
+using PhiloxUInt = std::uint32_t;
+//! Seed type used to generate the key for the RNG
+using PhiloxSeed = Array<PhiloxUInt, 1>;
+//! Philox4x32 key
+using PhiloxKey = Array<PhiloxUInt, 2>;
+//! Philox4x32 counter and output block
+using PhiloxBlock = Array<PhiloxUInt, 4>;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Persistent data for the Philox4x32 generator.
+ *
+ * The key is shared by all track slots: the per-track state is only the
+ * counter.
+ */
+template<Ownership W, MemSpace M>
+struct PhiloxRngParamsData
+{
+    //// DATA ////
+
+    PhiloxSeed seed;
+    PhiloxKey key;
+
+    //// METHODS ////
+
+    //! Whether the data is assigned
+    explicit CELER_FUNCTION operator bool() const { return true; }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    PhiloxRngParamsData& operator=(PhiloxRngParamsData<W2, M2> const& other)
+    {
+        CELER_EXPECT(other);
+        seed = other.seed;
+        key = other.key;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Initialize an RNG.
+ *
+ * The seed is unused since the key is stored in the params data; it is kept
+ * for interface compatibility with the other engines.
+ */
+struct PhiloxRngInitializer
+{
+    Array<unsigned int, 1> seed{0};
+    ull_int subsequence{0};
+    ull_int offset{0};
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Individual RNG state.
+ *
+ * The lower two words are the index of the next 32-bit value in the sequence,
+ * and the upper two words are the subsequence.
+ */
+struct PhiloxState
+{
+    PhiloxBlock counter;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Philox generator states for all threads.
+ */
+template<Ownership W, MemSpace M>
+struct PhiloxRngStateData
+{
+    //// TYPES ////
+
+    template<class T>
+    using StateItems = StateCollection<T, W, M>;
+
+    //// DATA ////
+
+    StateItems<PhiloxState> state;  //!< Track state [track]
+
+    //// METHODS ////
+
+    //! True if assigned
+    explicit CELER_FUNCTION operator bool() const { return !state.empty(); }
+
+    //! State size
+    CELER_FUNCTION size_type size() const { return state.size(); }
+
+    //! Assign from another set of states
+    template<Ownership W2, MemSpace M2>
+    PhiloxRngStateData& operator=(PhiloxRngStateData<W2, M2>& other)
+    {
+        CELER_EXPECT(other);
+        state = other.state;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// Resize and seed the RNG states
+template<MemSpace M>
+void resize(PhiloxRngStateData<Ownership::value, M>* state,
+            HostCRef<PhiloxRngParamsData> const& params,
+            StreamId stream,
+            size_type size);
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
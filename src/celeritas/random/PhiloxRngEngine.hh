@@ -0,0 +1,407 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/random/PhiloxRngEngine.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstdint>
+
+#include "corecel/Assert.hh"
+#include "corecel/OpaqueId.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Array.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/math/Algorithms.hh"
+#include "corecel/sys/ThreadId.hh"
+
+#include "PhiloxRngData.hh"
+#include "distribution/GenerateCanonical.hh"
+
+#include "detail/GenerateCanonical32.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Generate random data using the Philox4x32-10 counter-based algorithm.
+ *
+ * Philox is a keyed bijection of a 128-bit counter: each counter value
+ * produces an independent block of four 32-bit words, so the generator needs
+ * no state other than the counter, and jumping ahead is a simple addition.
+ * The key is derived from the seed and shared by all track slots; each
+ * slot's counter is made of a 64-bit subsequence (upper words) and the
+ * 64-bit index of the next 32-bit value in that subsequence (lower words).
+ * Because a track's random stream depends only on its subsequence, seeding
+ * the subsequence from the event and track IDs makes the results independent
+ * of the track slot, thread count, and sort order.
+ *
+ * The engine caches the most recently generated block so that consecutive
+ * draws within a single kernel only evaluate the bijection once per four
+ * values. The block function itself is branchless and operates on
+ * independent counters, so it can be evaluated for many counters at once:
+ * \c generate_blocks applies each round to a whole batch of counters, which
+ * lets the compiler vectorize across blocks, and \c generate and \c fill use
+ * it to produce several blocks of consecutive values per call.
+ *
+ * \code
+    PhiloxRngEngine rng(params, state, tid);
+    Array<real_type, 8> xi;
+    rng.fill(make_span(xi));
+   \endcode
+ *
+ * See Salmon, Moraes, Dror, and Shaw, "Parallel random numbers: as easy as 1,
+ * 2, 3". SC '11. https://doi.org/10.1145/2063384.2063405.
+ */
+class PhiloxRngEngine
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using uint_t = PhiloxUInt;
+    using result_type = uint_t;
+    using Initializer_t = PhiloxRngInitializer;
+    using ParamsRef = NativeCRef<PhiloxRngParamsData>;
+    using StateRef = NativeRef<PhiloxRngStateData>;
+    //!@}
+
+  public:
+    //! Lowest value potentially generated
+    static CELER_CONSTEXPR_FUNCTION result_type min() { return 0u; }
+    //! Highest value potentially generated
+    static CELER_CONSTEXPR_FUNCTION result_type max() { return 0xffffffffu; }
+
+    // Construct from state and persistent data
+    inline CELER_FUNCTION PhiloxRngEngine(ParamsRef const& params,
+                                          StateRef const& state,
+                                          TrackSlotId tid);
+
+    // Initialize state
+    inline CELER_FUNCTION PhiloxRngEngine& operator=(Initializer_t const&);
+
+    // Generate a 32-bit pseudorandom number
+    inline CELER_FUNCTION result_type operator()();
+
+    // Generate consecutive 32-bit pseudorandom numbers
+    inline CELER_FUNCTION void generate(Span<result_type> values);
+
+    // Fill a span with random numbers on [0, 1)
+    inline CELER_FUNCTION void fill(Span<real_type> values);
+
+    // Advance the state \c count times
+    inline CELER_FUNCTION void discard(ull_int count);
+
+    // Apply the Philox4x32-10 bijection to a counter
+    static inline CELER_FUNCTION PhiloxBlock
+    generate_block(PhiloxBlock counter, PhiloxKey key);
+
+    // Apply the Philox4x32-10 bijection to a batch of counters
+    static inline CELER_FUNCTION void
+    generate_blocks(Span<PhiloxBlock const> counters,
+                    PhiloxKey key,
+                    Span<PhiloxBlock> result);
+
+  private:
+    //// TYPES ////
+
+    //! Maximum number of blocks generated per batch
+    static constexpr size_type max_batch_blocks = 4;
+
+    //! Replay buffered 32-bit values as a generator
+    struct BufferedGenerator
+    {
+        result_type const* iter;
+
+        static CELER_CONSTEXPR_FUNCTION result_type max()
+        {
+            return PhiloxRngEngine::max();
+        }
+        CELER_FUNCTION result_type operator()() { return *iter++; }
+    };
+
+    /// DATA ///
+
+    PhiloxKey key_;
+    PhiloxState* state_;
+    PhiloxBlock block_;
+    ull_int block_index_{~ull_int(0)};
+
+    //// HELPER FUNCTIONS ////
+
+    inline CELER_FUNCTION ull_int offset() const;
+    inline CELER_FUNCTION void offset(ull_int);
+
+    static inline CELER_FUNCTION PhiloxBlock apply_round(PhiloxBlock const&,
+                                                         PhiloxKey const&);
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Specialization of GenerateCanonical for PhiloxRngEngine.
+ */
+template<class RealType>
+class GenerateCanonical<PhiloxRngEngine, RealType>
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using real_type = RealType;
+    using result_type = RealType;
+    //!@}
+
+  public:
+    //! Sample a random number on [0, 1)
+    CELER_FORCEINLINE_FUNCTION result_type operator()(PhiloxRngEngine& rng)
+    {
+        return detail::GenerateCanonical32<RealType>()(rng);
+    }
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from state and persistent data.
+ */
+CELER_FUNCTION
+PhiloxRngEngine::PhiloxRngEngine(ParamsRef const& params,
+                                 StateRef const& state,
+                                 TrackSlotId tid)
+    : key_(params.key)
+{
+    CELER_EXPECT(tid < state.state.size());
+    state_ = &state.state[tid];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Initialize the RNG engine.
+ *
+ * This moves the counter to the start of the given subsequence (a
+ * subsequence has size 2^64) and skips \c offset random numbers.
+ */
+CELER_FUNCTION PhiloxRngEngine&
+PhiloxRngEngine::operator=(Initializer_t const& init)
+{
+    state_->counter[2] = static_cast<uint_t>(init.subsequence);
+    state_->counter[3] = static_cast<uint_t>(init.subsequence >> 32);
+    this->offset(init.offset);
+    block_index_ = ~ull_int(0);
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Generate a 32-bit pseudorandom number.
+ */
+CELER_FUNCTION auto PhiloxRngEngine::operator()() -> result_type
+{
+    ull_int const offset = this->offset();
+    ull_int const index = offset >> 2;
+    if (index != block_index_)
+    {
+        PhiloxBlock ctr = state_->counter;
+        ctr[0] = static_cast<uint_t>(index);
+        ctr[1] = static_cast<uint_t>(index >> 32);
+        block_ = PhiloxRngEngine::generate_block(ctr, key_);
+        block_index_ = index;
+    }
+    this->offset(offset + 1);
+    return block_[offset & 3];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Generate consecutive 32-bit pseudorandom numbers.
+ *
+ * The values are identical to successive calls to \c operator() . After
+ * finishing a partially used block, whole blocks are generated in batches.
+ */
+CELER_FUNCTION void PhiloxRngEngine::generate(Span<result_type> values)
+{
+    auto iter = values.begin();
+    auto const end = values.end();
+
+    // Use the remainder of a partially consumed block
+    while (iter != end && (this->offset() & 3) != 0)
+    {
+        *iter++ = (*this)();
+    }
+
+    // Generate whole blocks in batches
+    Array<PhiloxBlock, max_batch_blocks> counters;
+    Array<PhiloxBlock, max_batch_blocks> blocks;
+    while (end - iter >= 4)
+    {
+        size_type const num_blocks = celeritas::min(
+            max_batch_blocks, static_cast<size_type>((end - iter) / 4));
+        ull_int const index = this->offset() >> 2;
+        for (size_type b = 0; b < num_blocks; ++b)
+        {
+            counters[b] = state_->counter;
+            counters[b][0] = static_cast<uint_t>(index + b);
+            counters[b][1] = static_cast<uint_t>((index + b) >> 32);
+        }
+        PhiloxRngEngine::generate_blocks({counters.data(), num_blocks},
+                                         key_,
+                                         {blocks.data(), num_blocks});
+        for (size_type b = 0; b < num_blocks; ++b)
+        {
+            for (uint_t word : blocks[b])
+            {
+                *iter++ = word;
+            }
+        }
+        block_ = blocks[num_blocks - 1];
+        block_index_ = index + num_blocks - 1;
+        this->offset((index + num_blocks) << 2);
+    }
+
+    // Use part of the next block
+    while (iter != end)
+    {
+        *iter++ = (*this)();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Fill a span with random numbers on [0, 1).
+ *
+ * The values are identical to successive calls to \c generate_canonical .
+ */
+CELER_FUNCTION void PhiloxRngEngine::fill(Span<real_type> values)
+{
+    constexpr size_type words_per_value = sizeof(real_type)
+                                          / sizeof(result_type);
+    constexpr size_type max_words = 4 * max_batch_blocks;
+    static_assert(words_per_value > 0 && max_words % words_per_value == 0);
+
+    Array<result_type, max_words> words;
+    detail::GenerateCanonical32<real_type> generate_canonical;
+    while (!values.empty())
+    {
+        size_type const count = celeritas::min(
+            max_words / words_per_value, static_cast<size_type>(values.size()));
+        this->generate({words.data(), count * words_per_value});
+        BufferedGenerator buffered{words.data()};
+        for (size_type i = 0; i < count; ++i)
+        {
+            values[i] = generate_canonical(buffered);
+        }
+        values = values.subspan(count);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Advance the state \c count times.
+ */
+CELER_FUNCTION void PhiloxRngEngine::discard(ull_int count)
+{
+    this->offset(this->offset() + count);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the Philox4x32-10 bijection to a counter.
+ *
+ * The multipliers and Weyl increments are those of the reference
+ * implementation (Random123).
+ */
+CELER_FUNCTION PhiloxBlock PhiloxRngEngine::generate_block(PhiloxBlock ctr,
+                                                           PhiloxKey key)
+{
+    constexpr uint_t weyl[] = {0x9e3779b9u, 0xbb67ae85u};
+    constexpr int num_rounds = 10;
+
+    for (int r = 0; r < num_rounds; ++r)
+    {
+        if (r != 0)
+        {
+            key[0] += weyl[0];
+            key[1] += weyl[1];
+        }
+        ctr = PhiloxRngEngine::apply_round(ctr, key);
+    }
+    return ctr;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the Philox4x32-10 bijection to a batch of counters.
+ *
+ * The result is the same as calling \c generate_block on each counter, but
+ * the loop over counters is innermost: each round is applied to the whole
+ * batch with a shared key, so the independent blocks can be evaluated in
+ * SIMD lanes.
+ */
+CELER_FUNCTION void
+PhiloxRngEngine::generate_blocks(Span<PhiloxBlock const> counters,
+                                 PhiloxKey key,
+                                 Span<PhiloxBlock> result)
+{
+    CELER_EXPECT(counters.size() == result.size());
+
+    constexpr uint_t weyl[] = {0x9e3779b9u, 0xbb67ae85u};
+    constexpr int num_rounds = 10;
+
+    for (size_type i = 0; i < counters.size(); ++i)
+    {
+        result[i] = counters[i];
+    }
+    for (int r = 0; r < num_rounds; ++r)
+    {
+        if (r != 0)
+        {
+            key[0] += weyl[0];
+            key[1] += weyl[1];
+        }
+        for (size_type i = 0; i < result.size(); ++i)
+        {
+            result[i] = PhiloxRngEngine::apply_round(result[i], key);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the index of the next value in the subsequence.
+ */
+CELER_FUNCTION ull_int PhiloxRngEngine::offset() const
+{
+    return (static_cast<ull_int>(state_->counter[1]) << 32)
+           | state_->counter[0];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Set the index of the next value in the subsequence.
+ */
+CELER_FUNCTION void PhiloxRngEngine::offset(ull_int value)
+{
+    state_->counter[0] = static_cast<uint_t>(value);
+    state_->counter[1] = static_cast<uint_t>(value >> 32);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Apply a single Philox round with the given round key.
+ */
+CELER_FUNCTION PhiloxBlock PhiloxRngEngine::apply_round(PhiloxBlock const& ctr,
+                                                        PhiloxKey const& key)
+{
+    constexpr std::uint64_t mult[] = {0xd2511f53u, 0xcd9e8d57u};
+
+    std::uint64_t const prod0 = mult[0] * ctr[0];
+    std::uint64_t const prod1 = mult[1] * ctr[2];
+    return {static_cast<uint_t>(prod1 >> 32) ^ ctr[1] ^ key[0],
+            static_cast<uint_t>(prod1),
+            static_cast<uint_t>(prod0 >> 32) ^ ctr[3] ^ key[1],
+            static_cast<uint_t>(prod0)};
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
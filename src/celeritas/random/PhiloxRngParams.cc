@@ -0,0 +1,42 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/random/PhiloxRngParams.cc
+//---------------------------------------------------------------------------//
+#include "PhiloxRngParams.hh"
+
+#include <cstdint>
+#include <utility>
+
+#include "corecel/Assert.hh"
+
+#include "PhiloxRngData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with a low-entropy seed.
+ *
+ * The 64-bit key is generated from the seed with a single SplitMix64 step so
+ * that similar seeds give unrelated keys.
+ */
+PhiloxRngParams::PhiloxRngParams(unsigned int seed)
+{
+    std::uint64_t z = seed + 0x9e3779b97f4a7c15ull;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    z ^= (z >> 31);
+
+    HostVal<PhiloxRngParamsData> host_data;
+    host_data.seed = {seed};
+    host_data.key = {static_cast<PhiloxUInt>(z),
+                     static_cast<PhiloxUInt>(z >> 32)};
+    CELER_ASSERT(host_data);
+    data_ = CollectionMirror<PhiloxRngParamsData>{std::move(host_data)};
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
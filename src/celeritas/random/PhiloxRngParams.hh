@@ -0,0 +1,39 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/random/PhiloxRngParams.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/data/CollectionMirror.hh"
+#include "corecel/data/ParamsDataInterface.hh"
+
+#include "PhiloxRngData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Shared data for the Philox4x32 counter-based random number generator.
+ */
+class PhiloxRngParams final : public ParamsDataInterface<PhiloxRngParamsData>
+{
+  public:
+    // Construct with a low-entropy seed
+    explicit PhiloxRngParams(unsigned int seed);
+
+    //! Access RNG properties on the host
+    HostRef const& host_ref() const final { return data_.host_ref(); }
+
+    //! Access RNG properties on the device
+    DeviceRef const& device_ref() const final { return data_.device_ref(); }
+
+  private:
+    // Host/device storage and reference
+    CollectionMirror<PhiloxRngParamsData> data_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -24,5 +24,11 @@ namespace celeritas
 {
 using RngEngine = XorwowRngEngine;
 }
+#elif (CELERITAS_CORE_RNG == CELERITAS_CORE_RNG_PHILOX)
+#    include "PhiloxRngEngine.hh"
+namespace celeritas
+{
+using RngEngine = PhiloxRngEngine;
+}
 #endif
 // IWYU pragma: end_exports
@@ -15,6 +15,8 @@
 #    include "CuHipRngParams.hh"
 #elif (CELERITAS_CORE_RNG == CELERITAS_CORE_RNG_XORWOW)
 #    include "XorwowRngParams.hh"
+#elif (CELERITAS_CORE_RNG == CELERITAS_CORE_RNG_PHILOX)
+#    include "PhiloxRngParams.hh"
 #endif
 
 #include "RngParamsFwd.hh"
@@ -0,0 +1,155 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/random/XorwowRngBatch.cc
+//---------------------------------------------------------------------------//
+#include "XorwowRngBatch.hh"
+
+#include <algorithm>
+#include <type_traits>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Number of track slots advanced together
+constexpr size_type num_lanes = 8;
+
+//---------------------------------------------------------------------------//
+/*!
+ * XORWOW states for a batch of track slots in structure-of-arrays layout.
+ *
+ * Every operation is a loop over a fixed number of independent lanes, which
+ * the compiler can map onto SIMD registers.
+ */
+struct XorwowLanes
+{
+    using uint_t = XorwowUInt;
+    using Lanes = uint_t[num_lanes];
+
+    Lanes s[5]{};
+    Lanes weyl{};
+
+    //! Advance all lanes and write the next value of each
+    void operator()(Lanes& result)
+    {
+        for (size_type i = 0; i < num_lanes; ++i)
+        {
+            uint_t const t = s[0][i] ^ (s[0][i] >> 2u);
+            s[0][i] = s[1][i];
+            s[1][i] = s[2][i];
+            s[2][i] = s[3][i];
+            s[3][i] = s[4][i];
+            s[4][i] = (s[4][i] ^ (s[4][i] << 4u)) ^ (t ^ (t << 1u));
+            weyl[i] += 362437u;
+            result[i] = weyl[i] + s[4][i];
+        }
+    }
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Generate uniform random numbers for a set of track slots.
+ *
+ * This generates the same number of values on [0, 1) for each of the given
+ * (unique) track slots. The values are stored draw-major: the \em j th value
+ * for the \em i th slot is at index <code>j * slots.size() + i</code>. Each
+ * slot's values and final state are identical to successive calls to \c
+ * generate_canonical with its XorwowRngEngine.
+ *
+ * Rather than generating the values one slot at a time, the states of
+ * several slots are gathered into local arrays and advanced together so
+ * that the recurrence and conversion are vectorized on CPU.
+ */
+void fill_canonical_batch(HostRef<XorwowRngStateData> const& state,
+                          Span<TrackSlotId const> slots,
+                          Span<real_type> values)
+{
+    size_type const num_slots = slots.size();
+    CELER_EXPECT(num_slots == 0 || values.size() % num_slots == 0);
+
+    if (num_slots == 0)
+    {
+        return;
+    }
+    size_type const num_draws = values.size() / num_slots;
+
+    for (size_type base = 0; base < num_slots; base += num_lanes)
+    {
+        size_type const count = std::min(num_lanes, num_slots - base);
+        XorwowState* batch_states[num_lanes];
+        for (auto i : range(count))
+        {
+            CELER_ASSERT(slots[base + i] < state.size());
+            batch_states[i] = &state.state[slots[base + i]];
+        }
+
+        // Gather the states into lanes
+        XorwowLanes lanes;
+        for (auto i : range(count))
+        {
+            for (auto w : range(5))
+            {
+                lanes.s[w][i] = batch_states[i]->xorstate[w];
+            }
+            lanes.weyl[i] = batch_states[i]->weylstate;
+        }
+
+        // Generate values for all lanes
+        real_type* out = values.data() + base;
+        XorwowLanes::Lanes upper;
+        for ([[maybe_unused]] auto j : range(num_draws))
+        {
+            lanes(upper);
+            real_type converted[num_lanes];
+            if constexpr (std::is_same_v<real_type, float>)
+            {
+                // See GenerateCanonical32<float>
+                constexpr float norm = 2.32830643654e-10f;  // 1 / 2**32
+                for (size_type i = 0; i < num_lanes; ++i)
+                {
+                    converted[i] = norm * upper[i];
+                }
+            }
+            else
+            {
+                // See GenerateCanonical32<double>
+                constexpr double norm = 1.1102230246251565e-16;  // 1 / 2^53
+                XorwowLanes::Lanes lower;
+                lanes(lower);
+                for (size_type i = 0; i < num_lanes; ++i)
+                {
+                    converted[i] = norm
+                                   * static_cast<double>(
+                                       (static_cast<ull_int>(upper[i])
+                                        << (53ul - 32ul))
+                                       ^ static_cast<ull_int>(lower[i]));
+                }
+            }
+            std::copy_n(converted, count, out);
+            out += num_slots;
+        }
+
+        // Scatter the states back
+        for (auto i : range(count))
+        {
+            for (auto w : range(5))
+            {
+                batch_states[i]->xorstate[w] = lanes.s[w][i];
+            }
+            batch_states[i]->weylstate = lanes.weyl[i];
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,25 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/random/XorwowRngBatch.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Types.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/sys/ThreadId.hh"
+
+#include "XorwowRngData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+// Generate uniform random numbers for a set of track slots
+void fill_canonical_batch(HostRef<XorwowRngStateData> const& state,
+                          Span<TrackSlotId const> slots,
+                          Span<real_type> values);
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
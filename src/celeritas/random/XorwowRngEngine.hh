@@ -10,6 +10,7 @@
 #include "corecel/Assert.hh"
 #include "corecel/OpaqueId.hh"
 #include "corecel/Types.hh"
+#include "corecel/cont/Span.hh"
 #include "corecel/sys/ThreadId.hh"
 
 #include "XorwowRngData.hh"
@@ -19,6 +20,55 @@
 
 namespace celeritas
 {
+//---------------------------------------------------------------------------//
+/*!
+ * Generate XORWOW random data from a local copy of a track's state.
+ *
+ * The state is copied into the engine so that the compiler can keep it in
+ * registers across consecutive draws, rather than loading and storing the
+ * track's state in memory for every value. The updated state \em must be
+ * written back with \c store after the last draw: otherwise the next engine
+ * constructed for the track will repeat the same values.
+ *
+ * \code
+    auto rng = track.make_rng_engine().make_local();
+    Array<real_type, 4> xi;
+    rng.fill(make_span(xi));
+    rng.store();
+   \endcode
+ */
+class XorwowLocalRngEngine
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using uint_t = XorwowUInt;
+    using result_type = uint_t;
+    //!@}
+
+  public:
+    //! Lowest value potentially generated
+    static CELER_CONSTEXPR_FUNCTION result_type min() { return 0u; }
+    //! Highest value potentially generated
+    static CELER_CONSTEXPR_FUNCTION result_type max() { return 0xffffffffu; }
+
+    // Copy the state of a track
+    explicit inline CELER_FUNCTION XorwowLocalRngEngine(XorwowState& state);
+
+    // Generate a 32-bit pseudorandom number
+    inline CELER_FUNCTION result_type operator()();
+
+    // Fill a span with random numbers on [0, 1)
+    inline CELER_FUNCTION void fill(Span<real_type> values);
+
+    // Write the updated state back to the track
+    inline CELER_FUNCTION void store();
+
+  private:
+    XorwowState state_;
+    XorwowState* dst_;
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Generate random data using the XORWOW algorithm.
@@ -80,9 +130,18 @@ class XorwowRngEngine
     // Generate a 32-bit pseudorandom number
     inline CELER_FUNCTION result_type operator()();
 
+    // Fill a span with random numbers on [0, 1)
+    inline CELER_FUNCTION void fill(Span<real_type> values);
+
     // Advance the state \c count times
     inline CELER_FUNCTION void discard(ull_int count);
 
+    // Copy the state for repeated sampling
+    inline CELER_FUNCTION XorwowLocalRngEngine make_local() const;
+
+    // Advance a state and return the next 32-bit value
+    static inline CELER_FUNCTION result_type generate(XorwowState& state);
+
   private:
     /// TYPES ///
 
@@ -97,7 +156,7 @@ class XorwowRngEngine
     //// HELPER FUNCTIONS ////
 
     inline CELER_FUNCTION void discard_subsequence(ull_int);
-    inline CELER_FUNCTION void next();
+    static inline CELER_FUNCTION void next(XorwowState&);
     inline CELER_FUNCTION void jump(ull_int, ArrayJumpPoly const&);
     inline CELER_FUNCTION void jump(JumpPoly const&);
 
@@ -131,6 +190,29 @@ class GenerateCanonical<XorwowRngEngine, RealType>
     }
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Specialization of GenerateCanonical for XorwowLocalRngEngine.
+ */
+template<class RealType>
+class GenerateCanonical<XorwowLocalRngEngine, RealType>
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using real_type = RealType;
+    using result_type = RealType;
+    //!@}
+
+  public:
+    //! Sample a random number on [0, 1)
+    CELER_FORCEINLINE_FUNCTION result_type
+    operator()(XorwowLocalRngEngine& rng)
+    {
+        return detail::GenerateCanonical32<RealType>()(rng);
+    }
+};
+
 //---------------------------------------------------------------------------//
 // INLINE DEFINITIONS
 //---------------------------------------------------------------------------//
@@ -190,9 +272,20 @@ XorwowRngEngine::operator=(Initializer_t const& init)
  */
 CELER_FUNCTION auto XorwowRngEngine::operator()() -> result_type
 {
-    this->next();
-    state_->weylstate += 362437u;
-    return state_->weylstate + state_->xorstate[4];
+    return XorwowRngEngine::generate(*state_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Fill a span with random numbers on [0, 1).
+ *
+ * The state is loaded and stored only once for all values.
+ */
+CELER_FUNCTION void XorwowRngEngine::fill(Span<real_type> values)
+{
+    XorwowLocalRngEngine local = this->make_local();
+    local.fill(values);
+    local.store();
 }
 
 //---------------------------------------------------------------------------//
@@ -205,6 +298,29 @@ CELER_FUNCTION void XorwowRngEngine::discard(ull_int count)
     state_->weylstate += static_cast<unsigned int>(count) * 362437u;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Copy the state for repeated sampling.
+ *
+ * The returned engine must be stored back before this engine is used again.
+ */
+CELER_FUNCTION XorwowLocalRngEngine XorwowRngEngine::make_local() const
+{
+    return XorwowLocalRngEngine{*state_};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Advance a state and return the next 32-bit value.
+ */
+CELER_FUNCTION auto XorwowRngEngine::generate(XorwowState& state)
+    -> result_type
+{
+    XorwowRngEngine::next(state);
+    state.weylstate += 362437u;
+    return state.weylstate + state.xorstate[4];
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Advance the state \c count subsequences (\c count * 2^67 times).
@@ -223,9 +339,9 @@ CELER_FUNCTION void XorwowRngEngine::discard_subsequence(ull_int count)
  *
  * This does not update the Weyl sequence value.
  */
-CELER_FUNCTION void XorwowRngEngine::next()
+CELER_FUNCTION void XorwowRngEngine::next(XorwowState& state)
 {
-    auto& s = state_->xorstate;
+    auto& s = state.xorstate;
     auto const t = (s[0] ^ (s[0] >> 2u));
 
     s[0] = s[1];
@@ -307,7 +423,7 @@ CELER_FUNCTION void XorwowRngEngine::jump(JumpPoly const& jump_poly)
                     s[k] ^= state_->xorstate[k];
                 }
             }
-            this->next();
+            XorwowRngEngine::next(*state_);
         }
     }
     state_->xorstate = s;
@@ -327,5 +443,47 @@ CELER_FUNCTION std::uint64_t XorwowRngEngine::SplitMix64::operator()()
     return z ^ (z >> 31);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Copy the state of a track.
+ */
+CELER_FUNCTION XorwowLocalRngEngine::XorwowLocalRngEngine(XorwowState& state)
+    : state_(state), dst_(&state)
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Generate a 32-bit pseudorandom number from the local state.
+ */
+CELER_FUNCTION auto XorwowLocalRngEngine::operator()() -> result_type
+{
+    return XorwowRngEngine::generate(state_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Fill a span with random numbers on [0, 1).
+ *
+ * The values are identical to successive calls to \c generate_canonical .
+ */
+CELER_FUNCTION void XorwowLocalRngEngine::fill(Span<real_type> values)
+{
+    detail::GenerateCanonical32<real_type> generate;
+    for (real_type& v : values)
+    {
+        v = generate(*this);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write the updated state back to the track.
+ */
+CELER_FUNCTION void XorwowLocalRngEngine::store()
+{
+    *dst_ = state_;
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
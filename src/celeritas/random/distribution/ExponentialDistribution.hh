@@ -12,6 +12,7 @@
 #include "corecel/Assert.hh"
 #include "corecel/Macros.hh"
 #include "corecel/Types.hh"
+#include "corecel/cont/Span.hh"
 
 #include "GenerateCanonical.hh"
 
@@ -57,6 +58,11 @@ class ExponentialDistribution
     template<class Generator>
     inline CELER_FUNCTION result_type operator()(Generator& g);
 
+    // Fill a span with samples using the given random number generator
+    template<class Generator>
+    inline CELER_FUNCTION void operator()(Generator& g,
+                                          Span<result_type> values);
+
   private:
     result_type neg_inv_lambda_;
 };
@@ -87,5 +93,25 @@ ExponentialDistribution<RT>::operator()(Generator& rng) -> result_type
     return std::log(generate_canonical<RT>(rng)) * neg_inv_lambda_;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Fill a span with random numbers according to the distribution.
+ *
+ * The uniform deviates are drawn in bulk with \c fill_canonical , so the
+ * values are identical to successive calls to the single-sample operator.
+ */
+template<class RT>
+template<class Generator>
+CELER_FUNCTION void
+ExponentialDistribution<RT>::operator()(Generator& rng,
+                                        Span<result_type> values)
+{
+    fill_canonical(rng, values);
+    for (result_type& v : values)
+    {
+        v = std::log(v) * neg_inv_lambda_;
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
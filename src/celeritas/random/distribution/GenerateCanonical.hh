@@ -7,12 +7,15 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <cstddef>
 #include <limits>
 #include <random>
 #include <type_traits>
+#include <utility>
 
 #include "corecel/Macros.hh"
 #include "corecel/Types.hh"
+#include "corecel/cont/Span.hh"
 
 namespace celeritas
 {
@@ -26,6 +29,12 @@ inline CELER_FUNCTION RealType generate_canonical(Generator& g);
 template<class Generator>
 inline CELER_FUNCTION real_type generate_canonical(Generator& g);
 
+//---------------------------------------------------------------------------//
+//! Fill a span with random uniform numbers
+template<class Generator, class RealType, std::size_t N>
+inline CELER_FUNCTION void
+fill_canonical(Generator& g, Span<RealType, N> values);
+
 //---------------------------------------------------------------------------//
 /*!
  * Generate random numbers in [0, 1).
@@ -51,6 +60,25 @@ class GenerateCanonical
     result_type operator()(Generator& rng);
 };
 
+//---------------------------------------------------------------------------//
+namespace detail
+{
+//! Whether a generator has a bulk fill method for the given real type
+template<class Generator, class RealType, class = void>
+struct HasFillCanonical : std::false_type
+{
+};
+
+template<class Generator, class RealType>
+struct HasFillCanonical<
+    Generator,
+    RealType,
+    std::void_t<decltype(std::declval<Generator&>().fill(
+        std::declval<Span<RealType>>()))>> : std::true_type
+{
+};
+}  // namespace detail
+
 //---------------------------------------------------------------------------//
 // INLINE DEFINITIONS
 //---------------------------------------------------------------------------//
@@ -87,5 +115,30 @@ CELER_FUNCTION real_type generate_canonical(Generator& g)
     return GenerateCanonical<Generator, real_type>()(g);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Fill a span with random real numbers in [0, 1).
+ *
+ * This is intended for samplers that need a fixed number of uniform values.
+ * Engines that provide a bulk \c fill method use it; otherwise the values are
+ * generated one at a time. In both cases the result is identical to
+ * successive calls to \c generate_canonical .
+ */
+template<class Generator, class RealType, std::size_t N>
+CELER_FUNCTION void fill_canonical(Generator& g, Span<RealType, N> values)
+{
+    if constexpr (detail::HasFillCanonical<Generator, RealType>::value)
+    {
+        g.fill(Span<RealType>{values});
+    }
+    else
+    {
+        for (RealType& v : values)
+        {
+            v = generate_canonical<RealType>(g);
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -14,7 +14,7 @@
 #include "corecel/math/ArrayUtils.hh"
 #include "celeritas/Constants.hh"
 
-#include "UniformRealDistribution.hh"
+#include "GenerateCanonical.hh"
 
 namespace celeritas
 {
@@ -33,41 +33,29 @@ class IsotropicDistribution
     //!@}
 
   public:
-    // Constructor
-    inline CELER_FUNCTION IsotropicDistribution();
-
     // Sample a random unit vector
     template<class Generator>
     inline CELER_FUNCTION result_type operator()(Generator& rng);
-
-  private:
-    UniformRealDistribution<real_type> sample_costheta_;
-    UniformRealDistribution<real_type> sample_phi_;
 };
 
 //---------------------------------------------------------------------------//
 // INLINE DEFINITIONS
-//---------------------------------------------------------------------------//
-/*!
- * Construct with defaults.
- */
-template<class RealType>
-CELER_FUNCTION IsotropicDistribution<RealType>::IsotropicDistribution()
-    : sample_costheta_(-1, 1), sample_phi_(0, 2 * constants::pi)
-{
-}
-
 //---------------------------------------------------------------------------//
 /*!
  * Sample an isotropic unit vector.
+ *
+ * Both uniform deviates are drawn together so that engines with a bulk fill
+ * can generate them without writing back their state in between.
  */
 template<class RealType>
 template<class Generator>
 CELER_FUNCTION auto
 IsotropicDistribution<RealType>::operator()(Generator& rng) -> result_type
 {
-    real_type const costheta = sample_costheta_(rng);
-    real_type const phi = sample_phi_(rng);
+    Array<real_type, 2> xi;
+    fill_canonical(rng, make_span(xi));
+    real_type const costheta = std::fma(real_type(2), xi[0], real_type(-1));
+    real_type const phi = real_type(2 * constants::pi) * xi[1];
     return from_spherical(costheta, phi);
 }
 
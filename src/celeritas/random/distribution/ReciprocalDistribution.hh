@@ -53,6 +53,9 @@ class ReciprocalDistribution
     template<class Generator>
     inline CELER_FUNCTION result_type operator()(Generator& rng) const;
 
+    // Transform a uniform sample on [0, 1) to the distribution
+    inline CELER_FUNCTION result_type transform(real_type xi) const;
+
   private:
     RealType a_;
     RealType logratio_;
@@ -102,7 +105,21 @@ template<class Generator>
 CELER_FUNCTION auto
 ReciprocalDistribution<RealType>::operator()(Generator& rng) const -> result_type
 {
-    return a_ * std::exp(logratio_ * generate_canonical<RealType>(rng));
+    return this->transform(generate_canonical<RealType>(rng));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Transform a uniform sample on [0, 1) to the distribution.
+ *
+ * This allows the uniform deviates to be drawn in bulk with \c
+ * fill_canonical .
+ */
+template<class RealType>
+CELER_FUNCTION auto
+ReciprocalDistribution<RealType>::transform(real_type xi) const -> result_type
+{
+    return a_ * std::exp(logratio_ * xi);
 }
 
 //---------------------------------------------------------------------------//
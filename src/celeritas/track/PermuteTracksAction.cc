@@ -0,0 +1,119 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/PermuteTracksAction.cc
+//---------------------------------------------------------------------------//
+#include "PermuteTracksAction.hh"
+
+#include "corecel/Assert.hh"
+#include "corecel/Config.hh"
+
+#include "corecel/data/AuxParamsRegistry.hh"
+#include "corecel/data/AuxStateVec.hh"
+#include "corecel/sys/ActionRegistry.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
+
+#include "TrackInitParams.hh"
+#include "detail/TrackSortUtils.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Number of steps since the last check on a stream.
+ */
+struct PermuteTracksAction::State final : AuxStateInterface
+{
+    size_type num_steps{0};
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct and add to core params.
+ */
+std::shared_ptr<PermuteTracksAction>
+PermuteTracksAction::make_and_insert(CoreParams const& core,
+                                     Input const& input)
+{
+    CELER_VALIDATE(input, << "invalid track permutation input");
+    CELER_VALIDATE(CELERITAS_CORE_GEO == CELERITAS_CORE_GEO_ORANGE,
+                   << "track state permutation is only implemented for "
+                      "ORANGE geometry");
+    CELER_VALIDATE(core.init()->track_order() != TrackOrder::none
+                       && core.init()->track_order() != TrackOrder::init_charge,
+                   << "track state permutation requires a track sorting "
+                      "order");
+
+    ActionRegistry& actions = *core.action_reg();
+    AuxParamsRegistry& aux = *core.aux_reg();
+    auto result = std::make_shared<PermuteTracksAction>(
+        actions.next_id(), aux.next_id(), input);
+    actions.insert(result);
+    aux.insert(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with IDs and options.
+ */
+PermuteTracksAction::PermuteTracksAction(ActionId action_id,
+                                         AuxId aux_id,
+                                         Input const& input)
+    : action_id_{action_id}, aux_id_{aux_id}, input_{input}
+{
+    CELER_EXPECT(action_id_);
+    CELER_EXPECT(aux_id_);
+    CELER_EXPECT(input_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Description of the action.
+ */
+std::string_view PermuteTracksAction::description() const
+{
+    return "permute track states into sorted order";
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Build state data for a stream.
+ */
+auto PermuteTracksAction::create_state(MemSpace, StreamId, size_type) const
+    -> UPState
+{
+    return std::make_unique<State>();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Permute the host states if enough steps have passed and they are
+ * sufficiently out of order.
+ */
+void PermuteTracksAction::step(CoreParams const&, CoreStateHost& state) const
+{
+    auto& counter = get<State>(state.aux(), aux_id_);
+    if (++counter.num_steps < input_.interval)
+    {
+        return;
+    }
+    counter.num_steps = 0;
+
+    if (detail::calc_fragmentation(state.ref()) > input_.threshold)
+    {
+        detail::permute_tracks(state.ref());
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Do nothing for device states.
+ */
+void PermuteTracksAction::step(CoreParams const&, CoreStateDevice&) const {}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,101 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/PermuteTracksAction.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+
+#include "corecel/data/AuxInterface.hh"
+#include "celeritas/global/ActionInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Move track states into sorted order on the host.
+ *
+ * Sorting tracks only reorders the indirection array \c track_slots, so
+ * kernels launched over sorted action ranges gather track data from random
+ * locations in memory. This action periodically permutes the per-track state
+ * data so that thread \em i again uses track slot \em i, turning those
+ * gathers into contiguous streaming access.
+ *
+ * Permutation is performed at the start of a step (after track
+ * initialization and any start-of-step sorting) when at least \c interval
+ * steps have passed since the previous check and the fraction of threads
+ * whose track slot is not contiguous with the previous thread's exceeds \c
+ * threshold .
+ *
+ * Only core state data that persists between steps is permuted: auxiliary
+ * per-track state must not be carried across steps. Permutation is
+ * implemented only for host states using ORANGE geometry; it has no effect
+ * on device states, whose accesses are already coalesced by sorting.
+ */
+class PermuteTracksAction final : public CoreStepActionInterface,
+                                  public AuxParamsInterface
+{
+  public:
+    struct Input
+    {
+        //! Number of steps between checks
+        size_type interval{1};
+        //! Minimum fraction of out-of-order track slots to permute
+        real_type threshold{0.25};
+
+        //! True if the input is valid
+        explicit operator bool() const
+        {
+            return interval > 0 && threshold >= 0 && threshold <= 1;
+        }
+    };
+
+  public:
+    // Construct and add to core params
+    static std::shared_ptr<PermuteTracksAction>
+    make_and_insert(CoreParams const& core, Input const& input);
+
+    // Construct with IDs and options
+    PermuteTracksAction(ActionId action_id, AuxId aux_id, Input const& input);
+
+    //!@{
+    //! \name Metadata interface
+    //! Label for the auxiliary data and action
+    std::string_view label() const final { return "permute-tracks"; }
+    // Description of the action
+    std::string_view description() const final;
+    //!@}
+
+    //!@{
+    //! \name Step action interface
+    //! ID of the action
+    ActionId action_id() const final { return action_id_; }
+    //! Dependency ordering of the action
+    StepActionOrder order() const final { return StepActionOrder::sort_start; }
+    // Execute the action with host data
+    void step(CoreParams const& params, CoreStateHost& state) const final;
+    // Execute the action with device data
+    void step(CoreParams const& params, CoreStateDevice& state) const final;
+    //!@}
+
+    //!@{
+    //! \name Aux params interface
+    //! Index of this class instance in its registry
+    AuxId aux_id() const final { return aux_id_; }
+    // Build state data for a stream
+    UPState create_state(MemSpace m, StreamId id, size_type size) const final;
+    //!@}
+
+  private:
+    struct State;
+
+    ActionId action_id_;
+    AuxId aux_id_;
+    Input input_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -132,6 +132,7 @@ struct SimStateData
     Items<size_type> num_looping_steps;  //!< Number of steps taken since the
                                          //!< track was flagged as looping
     Items<real_type> time;  //!< Time elapsed in lab frame since start of event
+    Items<real_type> track_length;  //!< Distance traveled by the track
 
     Items<TrackStatus> status;
     Items<real_type> step_length;
@@ -144,7 +145,8 @@ struct SimStateData
     explicit CELER_FUNCTION operator bool() const
     {
         return !track_ids.empty() && !parent_ids.empty() && !event_ids.empty()
-               && !num_steps.empty() && !time.empty() && !status.empty()
+               && !num_steps.empty() && !time.empty()
+               && !track_length.empty() && !status.empty()
                && !step_length.empty() && !post_step_action.empty()
                && !along_step_action.empty();
     }
@@ -166,6 +168,7 @@ struct SimStateData
         num_steps = other.num_steps;
         num_looping_steps = other.num_looping_steps;
         time = other.time;
+        track_length = other.track_length;
         status = other.status;
         step_length = other.step_length;
         post_step_action = other.post_step_action;
@@ -194,6 +197,7 @@ void resize(SimStateData<Ownership::value, M>* data,
         resize(&data->num_looping_steps, size);
     }
     resize(&data->time, size);
+    resize(&data->track_length, size);
 
     resize(&data->status, size);
     fill(TrackStatus::inactive, &data->status);
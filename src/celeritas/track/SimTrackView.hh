@@ -52,6 +52,9 @@ class SimTrackView
     // Add the time change over the step
     inline CELER_FUNCTION void add_time(real_type delta);
 
+    // Add the distance traveled over the step
+    inline CELER_FUNCTION void add_track_length(real_type delta);
+
     // Increment the total number of steps
     inline CELER_FUNCTION void increment_num_steps();
 
@@ -93,6 +96,9 @@ class SimTrackView
     // Time elapsed in the lab frame since the start of the event
     inline CELER_FUNCTION real_type time() const;
 
+    // Total distance traveled since the track was created
+    inline CELER_FUNCTION real_type track_length() const;
+
     // Whether the track is alive or inactive or dying
     inline CELER_FUNCTION TrackStatus status() const;
 
@@ -156,6 +162,7 @@ CELER_FUNCTION SimTrackView& SimTrackView::operator=(Initializer_t const& other)
         states_.num_looping_steps[track_slot_] = 0;
     }
     states_.time[track_slot_] = other.time;
+    states_.track_length[track_slot_] = 0;
     states_.status[track_slot_] = TrackStatus::initializing;
     states_.step_length[track_slot_] = {};
     states_.post_step_action[track_slot_] = {};
@@ -173,6 +180,16 @@ CELER_FUNCTION void SimTrackView::add_time(real_type delta)
     states_.time[track_slot_] += delta;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Add the distance traveled over the step.
+ */
+CELER_FUNCTION void SimTrackView::add_track_length(real_type delta)
+{
+    CELER_EXPECT(delta >= 0);
+    states_.track_length[track_slot_] += delta;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Increment the total number of steps.
@@ -374,6 +391,15 @@ CELER_FORCEINLINE_FUNCTION real_type SimTrackView::time() const
     return states_.time[track_slot_];
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Total distance traveled since the track was created [len].
+ */
+CELER_FORCEINLINE_FUNCTION real_type SimTrackView::track_length() const
+{
+    return states_.track_length[track_slot_];
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Whether the track is inactive, alive, or being killed.
@@ -14,9 +14,11 @@
 #include "corecel/Macros.hh"
 #include "corecel/sys/ActionRegistry.hh"
 #include "celeritas/Types.hh"
+#include "celeritas/geo/GeoParams.hh"
 #include "celeritas/global/CoreParams.hh"
 #include "celeritas/global/CoreState.hh"
 
+#include "detail/SpatialKeyCalculator.hh"
 #include "detail/TrackSortUtils.hh"
 
 namespace celeritas
@@ -36,6 +38,16 @@ bool is_sort_by_action(TrackOrder torder)
            && to_int(torder) < to_int(TrackOrder::end_reindex_action_);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Checks whether the TrackOrder sorts tracks by a spatial key.
+ */
+bool is_sort_by_position(TrackOrder torder)
+{
+    return torder == TrackOrder::reindex_spatial
+           || torder == TrackOrder::reindex_position;
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace
 
@@ -50,7 +62,9 @@ SortTracksAction::SortTracksAction(ActionId id, TrackOrder track_order)
     CELER_VALIDATE(is_action_sorted(track_order_),
                    << "track ordering policy '" << to_cstring(track_order)
                    << "' should not sort tracks");
-    CELER_EXPECT(track_order != TrackOrder::reindex_both_action);
+    CELER_EXPECT(track_order != TrackOrder::reindex_both_action
+                 && track_order
+                        != TrackOrder::reindex_spatial_step_limit_action);
 
     // CAUTION: check that this matches \c is_action_sorted
     action_order_ = [track_order] {
@@ -67,6 +81,8 @@ SortTracksAction::SortTracksAction(ActionId id, TrackOrder track_order)
                 // along-step
                 return StepActionOrder::sort_pre_post;
             case TrackOrder::reindex_particle_type:
+            case TrackOrder::reindex_spatial:
+            case TrackOrder::reindex_position:
                 // Sort at the beginning of the step
                 return StepActionOrder::sort_start;
             default:
@@ -91,6 +107,10 @@ std::string_view SortTracksAction::label() const
             return "sort-tracks-post-step";
         case TrackOrder::reindex_particle_type:
             return "sort-tracks-start";
+        case TrackOrder::reindex_spatial:
+            return "sort-tracks-spatial";
+        case TrackOrder::reindex_position:
+            return "sort-tracks-position";
         default:
             CELER_ASSERT_UNREACHABLE();
     }
@@ -99,16 +119,29 @@ std::string_view SortTracksAction::label() const
 /*!
  * Execute the action with host data.
  */
-void SortTracksAction::step(CoreParams const&, CoreStateHost& state) const
+void SortTracksAction::step(CoreParams const& params,
+                            CoreStateHost& state) const
 {
-    detail::sort_tracks(state.ref(), track_order_);
-    if (is_sort_by_action(track_order_))
+    if (is_sort_by_position(track_order_))
     {
-        detail::count_tracks_per_action(
-            state.ref(),
-            state.action_thread_offsets()[AllItems<ThreadId, MemSpace::host>{}],
-            state.action_thread_offsets(),
-            track_order_);
+        detail::sort_tracks_spatial(
+            params.ptr<MemSpace::host>(),
+            state.ptr(),
+            detail::SpatialKeyCalculator::from_bbox(
+                params.geometry()->bbox(),
+                track_order_ == TrackOrder::reindex_spatial));
+    }
+    else if (is_sort_by_action(track_order_))
+    {
+        // Counting sort also calculates the action offsets
+        using ThreadItems = AllItems<ThreadId, MemSpace::host>;
+        detail::sort_tracks(state.ref(),
+                            track_order_,
+                            state.action_thread_offsets()[ThreadItems{}]);
+    }
+    else
+    {
+        detail::sort_tracks(state.ref(), track_order_);
     }
 }
 
@@ -116,8 +149,20 @@ void SortTracksAction::step(CoreParams const&, CoreStateHost& state) const
 /*!
  * Execute the action with device data.
  */
-void SortTracksAction::step(CoreParams const&, CoreStateDevice& state) const
+void SortTracksAction::step(CoreParams const& params,
+                            CoreStateDevice& state) const
 {
+    if (is_sort_by_position(track_order_))
+    {
+        detail::sort_tracks_spatial(
+            params.ptr<MemSpace::device>(),
+            state.ptr(),
+            detail::SpatialKeyCalculator::from_bbox(
+                params.geometry()->bbox(),
+                track_order_ == TrackOrder::reindex_spatial));
+        return;
+    }
+
     detail::sort_tracks(state.ref(), track_order_);
     if (is_sort_by_action(track_order_))
     {
@@ -0,0 +1,156 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/UserLimitsAction.cc
+//---------------------------------------------------------------------------//
+#include "UserLimitsAction.hh"
+
+#include <utility>
+#include <nlohmann/json.hpp>
+
+#include "corecel/Assert.hh"
+#include "corecel/data/CollectionAlgorithms.hh"
+#include "corecel/io/JsonPimpl.hh"
+#include "corecel/io/OutputRegistry.hh"  // IWYU pragma: keep
+#include "corecel/sys/ActionRegistry.hh"
+#include "celeritas/UnitTypes.hh"
+#include "celeritas/geo/GeoParams.hh"
+#include "celeritas/global/ActionLauncher.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
+#include "celeritas/global/TrackExecutor.hh"
+
+#include "detail/UserLimitsExecutor.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct and add to core params.
+ */
+std::shared_ptr<UserLimitsAction>
+UserLimitsAction::make_and_insert(CoreParams const& core, SPConstParams params)
+{
+    CELER_EXPECT(params);
+    CELER_VALIDATE(params->host_ref().volume_limits.size()
+                       == core.geometry()->volumes().size(),
+                   << "user limits have "
+                   << params->host_ref().volume_limits.size()
+                   << " volumes but the geometry has "
+                   << core.geometry()->volumes().size());
+
+    ActionRegistry& actions = *core.action_reg();
+    OutputRegistry& out = *core.output_reg();
+    auto result = std::make_shared<UserLimitsAction>(
+        actions.next_id(), std::move(params), core.max_streams());
+    actions.insert(result);
+    out.insert(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with ID, limits, and number of streams.
+ */
+UserLimitsAction::UserLimitsAction(ActionId action_id,
+                                   SPConstParams params,
+                                   size_type num_streams)
+    : action_id_{action_id}, params_{std::move(params)}
+{
+    CELER_EXPECT(action_id_);
+    CELER_EXPECT(params_);
+    CELER_EXPECT(num_streams > 0);
+
+    HostVal<UserLimitsParamsData> host_params;
+    host_params = params_->host_ref();
+    store_ = {std::move(host_params), num_streams};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Description of the action.
+ */
+std::string_view UserLimitsAction::description() const
+{
+    return "kill tracks exceeding region user limits";
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write output to the given JSON object.
+ */
+void UserLimitsAction::output(JsonPimpl* j) const
+{
+    using json = nlohmann::json;
+
+    auto tally = this->calc_tally();
+
+    auto obj = json::object();
+    obj["energy"] = std::move(tally.energy);
+    obj["num_killed"] = std::move(tally.num_killed);
+    obj["_index"] = {"limits"};
+    obj["_units"] = {{"energy", units::Mev::label()}};
+
+    j->obj = std::move(obj);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the tallies accumulated over all streams.
+ */
+auto UserLimitsAction::calc_tally() const -> Tally
+{
+    Tally result;
+    result.energy.resize(params_->num_limits());
+    result.num_killed.resize(params_->num_limits());
+
+    accumulate_over_streams(
+        store_, [](auto& state) { return state.energy; }, &result.energy);
+    accumulate_over_streams(
+        store_,
+        [](auto& state) { return state.num_killed; },
+        &result.num_killed);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Reset the tallies on all streams.
+ */
+void UserLimitsAction::clear()
+{
+    apply_to_all_streams(store_, [](auto& state) {
+        fill(real_type(0), &state.energy);
+        fill(size_type(0), &state.num_killed);
+    });
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Execute the action with host data.
+ */
+void UserLimitsAction::step(CoreParams const& params,
+                            CoreStateHost& state) const
+{
+    auto execute = make_active_track_executor(
+        params.ptr<MemSpace::native>(),
+        state.ptr(),
+        detail::UserLimitsExecutor{
+            params_->ref<MemSpace::native>(),
+            store_.state<MemSpace::native>(state.stream_id(), state.size()),
+            this->action_id()});
+    return launch_action(*this, params, state, execute);
+}
+
+//---------------------------------------------------------------------------//
+#if !CELER_USE_DEVICE
+void UserLimitsAction::step(CoreParams const&, CoreStateDevice&) const
+{
+    CELER_NOT_CONFIGURED("CUDA OR HIP");
+}
+#endif
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
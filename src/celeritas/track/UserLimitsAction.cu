@@ -0,0 +1,38 @@
+//---------------------------------*-CUDA-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/UserLimitsAction.cu
+//---------------------------------------------------------------------------//
+#include "UserLimitsAction.hh"
+
+#include "celeritas/global/ActionLauncher.device.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
+#include "celeritas/global/TrackExecutor.hh"
+
+#include "detail/UserLimitsExecutor.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Execute the action with device data.
+ */
+void UserLimitsAction::step(CoreParams const& params,
+                            CoreStateDevice& state) const
+{
+    auto execute = make_active_track_executor(
+        params.ptr<MemSpace::native>(),
+        state.ptr(),
+        detail::UserLimitsExecutor{
+            params_->ref<MemSpace::native>(),
+            store_.state<MemSpace::native>(state.stream_id(), state.size()),
+            this->action_id()});
+    static ActionLauncher<decltype(execute)> const launch_kernel(*this);
+    launch_kernel(*this, params, state, execute);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
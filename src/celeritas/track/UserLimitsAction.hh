@@ -0,0 +1,112 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/UserLimitsAction.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "corecel/data/StreamStore.hh"
+#include "corecel/io/OutputInterface.hh"
+#include "celeritas/global/ActionInterface.hh"
+
+#include "UserLimitsData.hh"
+#include "UserLimitsParams.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Kill tracks that exceed the user limits of their region.
+ *
+ * This action runs after the physics pre-step action. Tracks in a limited
+ * volume whose kinetic energy is below the minimum, or whose track length or
+ * global time is at or above the maximum, are killed and their kinetic energy
+ * is deposited at the start of the step. Because the limits are checked
+ * before each step, a track may exceed a length or time limit by up to one
+ * step. The track length is measured from the creation of the track in
+ * Celeritas, so it excludes any distance traveled in Geant4 before the track
+ * was offloaded.
+ *
+ * The killed energy and number of killed tracks in each region are tallied
+ * per stream and summed over streams in the "user-limits" result output.
+ */
+class UserLimitsAction final : public CoreStepActionInterface,
+                               public OutputInterface
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SPConstParams = std::shared_ptr<UserLimitsParams const>;
+    using VecReal = std::vector<real_type>;
+    using VecCount = std::vector<size_type>;
+    //!@}
+
+    //! Energy and number of tracks killed in each region
+    struct Tally
+    {
+        VecReal energy;  //!< Killed kinetic energy [MeV]
+        VecCount num_killed;
+    };
+
+  public:
+    // Construct and add to core params
+    static std::shared_ptr<UserLimitsAction>
+    make_and_insert(CoreParams const& core, SPConstParams params);
+
+    // Construct with ID, limits, and number of streams
+    UserLimitsAction(ActionId action_id,
+                     SPConstParams params,
+                     size_type num_streams);
+
+    //!@{
+    //! \name Metadata interface
+    //! Label for the action and output
+    std::string_view label() const final { return "user-limits"; }
+    // Description of the action
+    std::string_view description() const final;
+    //!@}
+
+    //!@{
+    //! \name Step action interface
+    //! ID of the action
+    ActionId action_id() const final { return action_id_; }
+    //! Dependency ordering of the action
+    StepActionOrder order() const final { return StepActionOrder::pre; }
+    // Execute the action with host data
+    void step(CoreParams const& params, CoreStateHost& state) const final;
+    // Execute the action with device data
+    void step(CoreParams const& params, CoreStateDevice& state) const final;
+    //!@}
+
+    //!@{
+    //! \name Output interface
+    //! Category of data to write
+    Category category() const final { return Category::result; }
+    // Write output to the given JSON object
+    void output(JsonPimpl*) const final;
+    //!@}
+
+    // Get the tallies accumulated over all streams
+    Tally calc_tally() const;
+
+    // Reset the tallies on all streams
+    void clear();
+
+    //! Access the limits
+    SPConstParams const& params() const { return params_; }
+
+  private:
+    using StoreT = StreamStore<UserLimitsParamsData, UserLimitsStateData>;
+
+    ActionId action_id_;
+    SPConstParams params_;
+    mutable StoreT store_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
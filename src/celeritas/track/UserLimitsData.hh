@@ -0,0 +1,151 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/UserLimitsData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/data/Collection.hh"
+#include "corecel/data/CollectionAlgorithms.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "corecel/math/NumericLimits.hh"
+#include "celeritas/Quantities.hh"
+#include "celeritas/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Limits beyond which a track in a region is killed.
+ *
+ * Units are native (time = s for CGS, length = cm).
+ */
+struct UserLimits
+{
+    units::MevEnergy min_energy{0};  //!< Minimum kinetic energy
+    real_type max_track_length{numeric_limits<real_type>::infinity()};
+    real_type max_time{numeric_limits<real_type>::infinity()};
+
+    //! Whether any limit is applied
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return min_energy > zero_quantity()
+               || max_track_length < numeric_limits<real_type>::infinity()
+               || max_time < numeric_limits<real_type>::infinity();
+    }
+};
+
+//! Index of a set of user limits (a region)
+using UserLimitsId = OpaqueId<UserLimits>;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Shared data for region-dependent user limits.
+ */
+template<Ownership W, MemSpace M>
+struct UserLimitsParamsData
+{
+    template<class T>
+    using VolumeItems = Collection<T, W, M, VolumeId>;
+    template<class T>
+    using LimitsItems = Collection<T, W, M, UserLimitsId>;
+
+    //// DATA ////
+
+    //! Limits applied in each volume (null if unlimited)
+    VolumeItems<UserLimitsId> volume_limits;
+
+    //! Limits for each region
+    LimitsItems<UserLimits> limits;
+
+    //// METHODS ////
+
+    //! True if assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !volume_limits.empty() && !limits.empty();
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    UserLimitsParamsData& operator=(UserLimitsParamsData<W2, M2> const& other)
+    {
+        CELER_EXPECT(other);
+        volume_limits = other.volume_limits;
+        limits = other.limits;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Energy and number of tracks killed in each region on a stream.
+ *
+ * The tallies integrate over all steps and events until they are cleared.
+ */
+template<Ownership W, MemSpace M>
+struct UserLimitsStateData
+{
+    template<class T>
+    using LimitsItems = Collection<T, W, M, UserLimitsId>;
+
+    //// DATA ////
+
+    LimitsItems<real_type> energy;  //!< Killed kinetic energy [MeV]
+    LimitsItems<size_type> num_killed;  //!< Number of killed tracks
+
+    //! Number of track slots (unused during calculation)
+    size_type num_track_slots{};
+
+    //// METHODS ////
+
+    //! Number of states
+    CELER_FUNCTION size_type size() const { return num_track_slots; }
+
+    //! True if constructed
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !energy.empty() && num_killed.size() == energy.size()
+               && num_track_slots > 0;
+    }
+
+    //! Assign from another set of states
+    template<Ownership W2, MemSpace M2>
+    UserLimitsStateData& operator=(UserLimitsStateData<W2, M2>& other)
+    {
+        CELER_EXPECT(other);
+        energy = other.energy;
+        num_killed = other.num_killed;
+        num_track_slots = other.num_track_slots;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Resize and zero the tallies.
+ */
+template<MemSpace M>
+inline void resize(UserLimitsStateData<Ownership::value, M>* state,
+                   HostCRef<UserLimitsParamsData> const& params,
+                   StreamId,
+                   size_type num_track_slots)
+{
+    CELER_EXPECT(params);
+    CELER_EXPECT(num_track_slots > 0);
+
+    resize(&state->energy, params.limits.size());
+    fill(real_type(0), &state->energy);
+    resize(&state->num_killed, params.limits.size());
+    fill(size_type(0), &state->num_killed);
+    state->num_track_slots = num_track_slots;
+
+    CELER_ENSURE(*state);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
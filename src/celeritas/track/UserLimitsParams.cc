@@ -0,0 +1,142 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/UserLimitsParams.cc
+//---------------------------------------------------------------------------//
+#include "UserLimitsParams.hh"
+
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "corecel/io/Label.hh"
+#include "corecel/io/Logger.hh"
+#include "geocel/GeoParamsInterface.hh"
+#include "celeritas/io/ImportData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from imported regions, returning null if none are limited.
+ *
+ * Geometry volumes are matched to the imported volumes by label, falling back
+ * to the volume name if the geometry does not use unique Geant4 labels. Only
+ * the kinetic energy, track length, and time limits are supported: step
+ * length and range limits are ignored with a warning.
+ */
+std::shared_ptr<UserLimitsParams>
+UserLimitsParams::from_import(ImportData const& data,
+                              GeoParamsInterface const& geo)
+{
+    using Energy = units::MevEnergy;
+
+    Input input;
+
+    // Convert region limits
+    std::vector<UserLimitsId> region_limits(data.regions.size());
+    for (auto region_idx : range(data.regions.size()))
+    {
+        ImportRegion const& region = data.regions[region_idx];
+        if (!region.user_limits)
+        {
+            continue;
+        }
+
+        auto const& ul = region.limits;
+        if (ul.max_step < ImportUserLimits::inf || ul.min_range > 0)
+        {
+            CELER_LOG(warning) << "Ignoring unsupported step and range user "
+                                  "limits in region '"
+                               << region.name << "'";
+        }
+
+        UserLimits limits;
+        limits.min_energy = Energy(ul.min_kinetic_energy);
+        limits.max_track_length = ul.max_track_length;
+        limits.max_time = ul.max_time;
+        if (!limits)
+        {
+            continue;
+        }
+        region_limits[region_idx] = UserLimitsId(input.limits.size());
+        input.limits.push_back(limits);
+    }
+    if (input.limits.empty())
+    {
+        return nullptr;
+    }
+
+    // Assign limits to geometry volumes
+    input.volume_limits.resize(geo.volumes().size());
+    size_type num_assigned{0};
+    for (ImportVolume const& volume : data.volumes)
+    {
+        if (!volume || volume.region_id >= region_limits.size())
+        {
+            continue;
+        }
+        UserLimitsId limits_id = region_limits[volume.region_id];
+        if (!limits_id)
+        {
+            continue;
+        }
+
+        auto label = Label::from_geant(volume.name);
+        if (VolumeId vid = geo.volumes().find_exact(label))
+        {
+            input.volume_limits[vid.unchecked_get()] = limits_id;
+            ++num_assigned;
+            continue;
+        }
+        for (VolumeId vid : geo.volumes().find_all(label.name))
+        {
+            input.volume_limits[vid.unchecked_get()] = limits_id;
+            ++num_assigned;
+        }
+    }
+    CELER_VALIDATE(num_assigned > 0,
+                   << "no geometry volumes matched the regions with user "
+                      "limits");
+
+    CELER_LOG(debug) << "Applying " << input.limits.size()
+                     << " sets of user limits to " << num_assigned
+                     << " volumes";
+    return std::make_shared<UserLimitsParams>(input);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from per-volume limits.
+ */
+UserLimitsParams::UserLimitsParams(Input const& input)
+{
+    CELER_VALIDATE(input, << "invalid user limits input");
+
+    HostVal<UserLimitsParamsData> host_data;
+    for (UserLimits const& limits : input.limits)
+    {
+        CELER_VALIDATE(limits.min_energy >= zero_quantity()
+                           && limits.max_track_length > 0
+                           && limits.max_time > 0,
+                       << "invalid user limits");
+    }
+    for (UserLimitsId id : input.volume_limits)
+    {
+        CELER_VALIDATE(!id || id < input.limits.size(),
+                       << "invalid user limits ID " << id.unchecked_get());
+    }
+    make_builder(&host_data.volume_limits)
+        .insert_back(input.volume_limits.begin(), input.volume_limits.end());
+    make_builder(&host_data.limits)
+        .insert_back(input.limits.begin(), input.limits.end());
+
+    data_ = CollectionMirror<UserLimitsParamsData>{std::move(host_data)};
+    CELER_ENSURE(data_);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,82 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/UserLimitsParams.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "corecel/data/CollectionMirror.hh"
+#include "corecel/data/ParamsDataInterface.hh"
+
+#include "UserLimitsData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+class GeoParamsInterface;
+struct ImportData;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Region-dependent limits on the energy, length, and time of tracks.
+ *
+ * This is the Celeritas equivalent of the Geant4 \c G4UserLimits attached to
+ * a region and applied with \c G4UserSpecialCuts : tracks in a limited volume
+ * are killed if their kinetic energy is below a threshold or if their total
+ * length or global time exceeds a maximum. Each geometry volume maps to at
+ * most one set of limits.
+ */
+class UserLimitsParams final : public ParamsDataInterface<UserLimitsParamsData>
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using VecLimits = std::vector<UserLimits>;
+    using VecLimitsId = std::vector<UserLimitsId>;
+    //!@}
+
+    struct Input
+    {
+        //! Limits for each region
+        VecLimits limits;
+        //! Limits applied in each geometry volume (null if unlimited)
+        VecLimitsId volume_limits;
+
+        //! True if the input is valid
+        explicit operator bool() const
+        {
+            return !limits.empty() && !volume_limits.empty();
+        }
+    };
+
+  public:
+    // Construct from imported regions, returning null if none are limited
+    static std::shared_ptr<UserLimitsParams>
+    from_import(ImportData const& data, GeoParamsInterface const& geo);
+
+    // Construct from per-volume limits
+    explicit UserLimitsParams(Input const& input);
+
+    //! Number of distinct sets of limits
+    UserLimitsId::size_type num_limits() const
+    {
+        return this->host_ref().limits.size();
+    }
+
+    //! Access data on the host
+    HostRef const& host_ref() const final { return data_.host_ref(); }
+
+    //! Access data on the device
+    DeviceRef const& device_ref() const final { return data_.device_ref(); }
+
+  private:
+    CollectionMirror<UserLimitsParamsData> data_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
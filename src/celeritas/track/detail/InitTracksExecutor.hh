@@ -8,6 +8,7 @@
 #pragma once
 
 #include "corecel/Assert.hh"
+#include "corecel/Config.hh"
 #include "corecel/Macros.hh"
 #include "corecel/cont/Span.hh"
 #include "corecel/sys/ThreadId.hh"
@@ -19,6 +20,7 @@
 #include "celeritas/mat/MaterialTrackView.hh"
 #include "celeritas/phys/ParticleTrackView.hh"
 #include "celeritas/phys/PhysicsTrackView.hh"
+#include "celeritas/random/RngEngine.hh"
 
 #include "Utils.hh"
 #include "../CoreStateCounters.hh"
@@ -111,6 +113,19 @@ CELER_FUNCTION void InitTracksExecutor::operator()(ThreadId tid) const
     vacancy.make_sim_view() = init.sim;
     vacancy.make_particle_view() = init.particle;
 
+#if CELERITAS_CORE_RNG == CELERITAS_CORE_RNG_PHILOX
+    {
+        // Start a counter-based random stream unique to the event and track
+        // so that sampling is independent of the track slot
+        RngEngine::Initializer_t rng_init;
+        rng_init.subsequence
+            = (static_cast<ull_int>(init.sim.event_id.unchecked_get()) << 32)
+              | init.sim.track_id.unchecked_get();
+        auto rng = vacancy.make_rng_engine();
+        rng = rng_init;
+    }
+#endif
+
     // Initialize the geometry
     {
         auto geo = vacancy.make_geo_view();
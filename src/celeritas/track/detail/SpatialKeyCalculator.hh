@@ -0,0 +1,169 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/detail/SpatialKeyCalculator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/math/Algorithms.hh"
+#include "geocel/BoundingBox.hh"
+#include "geocel/Types.hh"
+#include "celeritas/Units.hh"
+#include "celeritas/geo/GeoTrackView.hh"
+#include "celeritas/global/CoreTrackData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate a track sort key from its volume and position.
+ *
+ * The low \c 3*pos_bits (42) bits of the key are a Morton (Z-order) code of
+ * the position on a uniform grid with \f$ 2^{14} \f$ cells along each axis.
+ * If \c use_volume is set, the high 22 bits are the volume ID. Sorting by
+ * this key groups tracks in the same volume, and within a volume orders them
+ * along a space-filling curve so that nearby tracks are likely to be
+ * processed by neighboring threads. Without the volume prefix, tracks are
+ * ordered only by position, which keeps tracks near a boundary together
+ * regardless of which side they are on.
+ */
+struct SpatialKeyCalculator
+{
+    //!@{
+    //! \name Type aliases
+    using result_type = unsigned long long;
+    //!@}
+
+    //! Number of bits per spatial dimension (at most 21)
+    static constexpr int pos_bits = 14;
+    //! Maximum volume ID stored in the key
+    static constexpr result_type max_volume = (result_type{1}
+                                               << (64 - 3 * pos_bits))
+                                              - 1;
+    //! Key for inactive tracks or tracks outside the geometry
+    static constexpr result_type invalid_key = ~result_type{0};
+
+    Real3 lower;  //!< Lower corner of the sorting grid
+    Real3 inv_width;  //!< Inverse width of a grid cell
+    bool use_volume{true};  //!< Prefix the key with the volume ID
+
+    // Construct from a bounding box
+    static inline SpatialKeyCalculator
+    from_bbox(BBox const& bbox, bool use_volume = true);
+
+    // Calculate the key
+    inline CELER_FUNCTION result_type operator()(VolumeId volume,
+                                                 Real3 const& pos) const;
+
+    // Spread the low pos_bits bits of a value to every third bit
+    static inline CELER_FUNCTION result_type spread_bits(result_type x);
+};
+
+static_assert(3 * SpatialKeyCalculator::pos_bits < 64);
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the spatial sort key of a track slot.
+ */
+inline CELER_FUNCTION SpatialKeyCalculator::result_type
+calc_spatial_key(NativeCRef<CoreParamsData> const& params,
+                 NativeRef<CoreStateData> const& states,
+                 SpatialKeyCalculator const& calc_key,
+                 TrackSlotId slot)
+{
+    if (states.sim.status[slot] == TrackStatus::inactive)
+    {
+        return SpatialKeyCalculator::invalid_key;
+    }
+    GeoTrackView geo(params.geometry, states.geometry, slot);
+    if (geo.is_outside())
+    {
+        return SpatialKeyCalculator::invalid_key;
+    }
+    return calc_key(geo.volume_id(), geo.pos());
+}
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from a bounding box.
+ *
+ * Unbounded dimensions (e.g. from an infinite world volume) are truncated to
+ * a kilometer.
+ */
+SpatialKeyCalculator
+SpatialKeyCalculator::from_bbox(BBox const& bbox, bool use_volume)
+{
+    constexpr real_type max_extent = 1e5 * units::centimeter;
+    constexpr real_type num_cells = result_type{1} << pos_bits;
+
+    SpatialKeyCalculator result;
+    for (auto ax : range(3))
+    {
+        real_type lo = clamp(bbox.lower()[ax], -max_extent, max_extent);
+        real_type hi = clamp(bbox.upper()[ax], -max_extent, max_extent);
+        result.lower[ax] = lo;
+        result.inv_width[ax] = hi > lo ? num_cells / (hi - lo) : 0;
+    }
+    result.use_volume = use_volume;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the key.
+ */
+CELER_FUNCTION auto
+SpatialKeyCalculator::operator()(VolumeId volume, Real3 const& pos) const
+    -> result_type
+{
+    constexpr real_type max_cell = (result_type{1} << pos_bits) - 1;
+
+    result_type result = 0;
+    for (int ax = 0; ax < 3; ++ax)
+    {
+        real_type cell = clamp((pos[ax] - lower[ax]) * inv_width[ax],
+                               real_type{0},
+                               max_cell);
+        result |= spread_bits(static_cast<result_type>(cell)) << ax;
+    }
+    if (!use_volume)
+    {
+        return result;
+    }
+    result_type vol = volume ? volume.unchecked_get() : max_volume;
+    return (celeritas::min(vol, max_volume) << (3 * pos_bits)) | result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Spread the low \c pos_bits bits of a value to every third bit.
+ *
+ * The shifts and masks interleave up to 21 bits, but higher bits are
+ * discarded so that the result occupies only the lowest \c 3*pos_bits bits.
+ */
+CELER_FUNCTION auto SpatialKeyCalculator::spread_bits(result_type x)
+    -> result_type
+{
+    x &= (result_type{1} << pos_bits) - 1;
+    x = (x | x << 32) & 0x1f00000000ffffull;
+    x = (x | x << 16) & 0x1f0000ff0000ffull;
+    x = (x | x << 8) & 0x100f00f00f00f00full;
+    x = (x | x << 4) & 0x10c30c30c30c30c3ull;
+    x = (x | x << 2) & 0x1249249249249249ull;
+    return x;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -10,8 +10,19 @@
 #include <algorithm>
 #include <iterator>
 #include <numeric>
+#include <utility>
+#include <vector>
+
+#include "corecel/Config.hh"
 
 #include "corecel/data/Collection.hh"
+#include "corecel/math/Algorithms.hh"
+
+#include "SpatialKeyCalculator.hh"
+
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#    include <omp.h>
+#endif
 
 namespace celeritas
 {
@@ -37,29 +48,190 @@ void partition_impl(TrackSlots const& track_slots, F&& func)
 }
 
 //---------------------------------------------------------------------------//
-//! Sort track slots based on a binary predicate
-template<class F>
-void sort_impl(TrackSlots const& track_slots, F&& func)
+//! Minimum number of track slots handled by a single thread when sorting
+constexpr size_type min_sort_chunk_size = 4096;
+
+//---------------------------------------------------------------------------//
+//! Get the number of contiguous chunks to sort in parallel
+size_type calc_num_chunks(size_type size)
 {
-    auto* start = track_slots.data().get();
-    std::sort(start, start + track_slots.size(), std::forward<F>(func));
+    size_type result = 1;
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+    result = static_cast<size_type>(omp_get_max_threads());
+#endif
+    return clamp(size / min_sort_chunk_size, size_type{1}, result);
+}
+
+//---------------------------------------------------------------------------//
+//! Calculate one past the largest valid ID in the state
+template<class Id>
+size_type calc_num_keys(ObserverPtr<Id const> ids, size_type size)
+{
+    size_type result = 0;
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#    pragma omp parallel for reduction(max : result)
+#endif
+    for (size_type i = 0; i < size; ++i)
+    {
+        if (Id id = ids.get()[i])
+        {
+            result = std::max(result, id.unchecked_get() + 1);
+        }
+    }
+    return result;
 }
 
 //---------------------------------------------------------------------------//
-//! Compare indices by indirection from a track slot index
+/*!
+ * Stably sort track slots by an ID accessed through the track slot.
+ *
+ * This is a counting sort over contiguous chunks of the track slots, one
+ * chunk per thread: each chunk is histogrammed by ID, an exclusive prefix sum
+ * over the (ID, chunk) histogram gives the output position of each chunk's
+ * tracks, and the track slots are scattered to a temporary buffer. Tracks
+ * with a null ID are placed at the end.
+ *
+ * If \c offsets is not empty it must have size \c num_keys + 1, and it is
+ * filled with the thread offset of each ID (see \c backfill_action_count).
+ */
 template<class Id>
-struct IdLess
+void counting_sort_impl(TrackSlots const& track_slots,
+                        ObserverPtr<Id const> ids,
+                        size_type num_keys,
+                        Span<ThreadId> offsets)
 {
-    ObserverPtr<Id const> ids_;
+    CELER_EXPECT(offsets.empty() || offsets.size() == num_keys + 1);
+
+    using SlotT = TrackSlotId::size_type;
+    SlotT* const slots = track_slots.data().get();
+    size_type const size = track_slots.size();
+    size_type const num_buckets = num_keys + 1;
+    size_type const num_chunks = calc_num_chunks(size);
+    size_type const chunk_size = ceil_div(size, num_chunks);
+
+    auto get_bucket = [ids, num_keys](SlotT slot) -> size_type {
+        Id id = ids.get()[slot];
+        CELER_ASSERT(!id || id.unchecked_get() < num_keys);
+        return id ? id.unchecked_get() : num_keys;
+    };
+    auto get_chunk_end = [size, chunk_size](size_type chunk) {
+        return std::min(size, (chunk + 1) * chunk_size);
+    };
 
-    bool operator()(size_type a, size_type b) const
+    // Histogram each chunk: counts are stored [chunk][bucket]
+    std::vector<size_type> counts(num_chunks * num_buckets, 0);
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#    pragma omp parallel for
+#endif
+    for (size_type c = 0; c < num_chunks; ++c)
     {
-        return ids_.get()[a] < ids_.get()[b];
+        size_type* chunk_counts = counts.data() + c * num_buckets;
+        for (size_type i = c * chunk_size, end = get_chunk_end(c); i < end;
+             ++i)
+        {
+            ++chunk_counts[get_bucket(slots[i])];
+        }
     }
-};
 
+    // Exclusive prefix sum over buckets, then chunks, to get the starting
+    // output position of each chunk's tracks in each bucket
+    size_type total = 0;
+    for (size_type b = 0; b < num_buckets; ++b)
+    {
+        if (b < num_keys && !offsets.empty())
+        {
+            offsets[b] = ThreadId{total};
+        }
+        for (size_type c = 0; c < num_chunks; ++c)
+        {
+            size_type& count = counts[c * num_buckets + b];
+            size_type start = total;
+            total += count;
+            count = start;
+        }
+    }
+    CELER_ASSERT(total == size);
+    if (!offsets.empty())
+    {
+        offsets.back() = ThreadId{size};
+    }
+
+    // Scatter track slots into sorted order
+    std::vector<SlotT> sorted(size);
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#    pragma omp parallel for
+#endif
+    for (size_type c = 0; c < num_chunks; ++c)
+    {
+        size_type* chunk_pos = counts.data() + c * num_buckets;
+        for (size_type i = c * chunk_size, end = get_chunk_end(c); i < end;
+             ++i)
+        {
+            sorted[chunk_pos[get_bucket(slots[i])]++] = slots[i];
+        }
+    }
+
+    // Copy back
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#    pragma omp parallel for
+#endif
+    for (size_type i = 0; i < size; ++i)
+    {
+        slots[i] = sorted[i];
+    }
+}
+
+//---------------------------------------------------------------------------//
+//! Sort track slots by ID with an unknown number of IDs
 template<class Id>
-IdLess(ObserverPtr<Id>) -> IdLess<Id>;
+void counting_sort_impl(TrackSlots const& track_slots,
+                        ObserverPtr<Id const> ids)
+{
+    size_type num_keys = calc_num_keys(ids, track_slots.size());
+    counting_sort_impl(track_slots, ids, num_keys, {});
+}
+
+//---------------------------------------------------------------------------//
+//! Track slot of each thread
+using SlotOrder = Span<TrackSlotId::size_type const>;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Gather per-track items into thread order.
+ *
+ * The collection is a 2D array with dimensions {track}{stride}.
+ */
+template<class T, class I>
+void permute_items(SlotOrder order,
+                   Collection<T, Ownership::reference, MemSpace::host, I> const&
+                       items)
+{
+    size_type const stride = items.size() / order.size();
+    CELER_ASSERT(stride * order.size() == items.size());
+    if (stride == 0)
+    {
+        return;
+    }
+
+    T* data = items.data().get();
+    std::vector<T> temp(items.size());
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#    pragma omp parallel for
+#endif
+    for (size_type i = 0; i < order.size(); ++i)
+    {
+        std::copy_n(data + order[i] * stride, stride, temp.data() + i * stride);
+    }
+    std::copy(temp.begin(), temp.end(), data);
+}
+
+//---------------------------------------------------------------------------//
+//! Gather multiple per-track collections into thread order
+template<class... Ts>
+void permute_all(SlotOrder order, Ts const&... items)
+{
+    (permute_items(order, items), ...);
+}
 
 //---------------------------------------------------------------------------//
 }  // namespace
@@ -77,16 +249,180 @@ void sort_tracks(HostRef<CoreStateData> const& states, TrackOrder order)
                                   IsNotInactive{states.sim.status.data()});
         case TrackOrder::reindex_along_step_action:
         case TrackOrder::reindex_step_limit_action:
-            return sort_impl(states.track_slots,
-                             IdLess{get_action_ptr(states, order)});
+            return counting_sort_impl(states.track_slots,
+                                      get_action_ptr(states, order));
         case TrackOrder::reindex_particle_type:
-            return sort_impl(states.track_slots,
-                             IdLess{states.particles.particle_id.data()});
+            return counting_sort_impl(
+                states.track_slots,
+                ObserverPtr<ParticleId const>{
+                    states.particles.particle_id.data()});
         default:
             CELER_ASSERT_UNREACHABLE();
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Sort tracks by action and calculate the thread offset of each action.
+ *
+ * The offsets have size num_actions + 1 and are written as a by-product of the
+ * counting sort, so a separate \c count_tracks_per_action pass is unneeded.
+ */
+void sort_tracks(HostRef<CoreStateData> const& states,
+                 TrackOrder order,
+                 Span<ThreadId> offsets)
+{
+    CELER_EXPECT(order == TrackOrder::reindex_along_step_action
+                 || order == TrackOrder::reindex_step_limit_action);
+    CELER_EXPECT(offsets.size() >= 2);
+
+    counting_sort_impl(states.track_slots,
+                       get_action_ptr(states, order),
+                       offsets.size() - 1,
+                       offsets);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sort tracks by volume and position.
+ *
+ * Inactive tracks and tracks outside the geometry are placed at the end.
+ */
+void sort_tracks_spatial(CoreParamsPtr<MemSpace::host> params,
+                         CoreStatePtr<MemSpace::host> state,
+                         SpatialKeyCalculator const& calc_key)
+{
+    CELER_EXPECT(params && state);
+
+    using KeySlot
+        = std::pair<SpatialKeyCalculator::result_type, TrackSlotId::size_type>;
+
+    auto const& states = *state;
+    auto* slots = states.track_slots.data().get();
+    size_type const size = states.track_slots.size();
+
+    std::vector<KeySlot> keys(size);
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#    pragma omp parallel for
+#endif
+    for (size_type i = 0; i < size; ++i)
+    {
+        keys[i].first = calc_spatial_key(
+            *params, states, calc_key, TrackSlotId{slots[i]});
+        keys[i].second = slots[i];
+    }
+    std::sort(keys.begin(), keys.end());
+    for (size_type i = 0; i < size; ++i)
+    {
+        slots[i] = keys[i].second;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the fraction of threads whose track slot is not contiguous.
+ *
+ * This is zero if the track slots are unsorted or have been permuted, and it
+ * approaches one if the tracks are randomly ordered.
+ */
+real_type calc_fragmentation(HostRef<CoreStateData> const& states)
+{
+    auto const* slots = states.track_slots.data().get();
+    size_type const size = states.track_slots.size();
+    if (size < 2)
+    {
+        return 0;
+    }
+
+    size_type count = 0;
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#    pragma omp parallel for reduction(+ : count)
+#endif
+    for (size_type i = 1; i < size; ++i)
+    {
+        if (slots[i] != slots[i - 1] + 1)
+        {
+            ++count;
+        }
+    }
+    return static_cast<real_type>(count) / static_cast<real_type>(size - 1);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Permute track states into sorted order and reset the track slots.
+ *
+ * After this call, the track in thread \em i occupies track slot \em i so
+ * that kernels launched over sorted action ranges access contiguous memory.
+ * Only data persisting between steps is permuted: scratch space and
+ * per-step data (secondaries, initializer bookkeeping) are unchanged.
+ */
+void permute_tracks(HostRef<CoreStateData> const& states)
+{
+    CELER_EXPECT(states);
+    CELER_EXPECT(states.track_slots.size() == states.size());
+
+    SlotOrder order{states.track_slots.data().get(),
+                    states.track_slots.size()};
+
+#if CELERITAS_CORE_GEO == CELERITAS_CORE_GEO_ORANGE
+    {
+        auto const& geo = states.geometry;
+        permute_all(order,
+                    geo.level,
+                    geo.surface_level,
+                    geo.surf,
+                    geo.sense,
+                    geo.boundary,
+                    geo.next_level,
+                    geo.next_step,
+                    geo.next_surf,
+                    geo.next_sense,
+                    geo.pos,
+                    geo.dir,
+                    geo.vol,
+                    geo.universe);
+    }
+#else
+    CELER_NOT_IMPLEMENTED("permuting track states for non-ORANGE geometry");
+#endif
+    permute_all(order, states.materials.state);
+    permute_all(order,
+                states.particles.particle_id,
+                states.particles.particle_energy);
+    permute_all(order,
+                states.physics.state,
+                states.physics.msc_step,
+                states.physics.per_process_xs);
+#if (CELERITAS_CORE_RNG == CELERITAS_CORE_RNG_CURAND) \
+    || (CELERITAS_CORE_RNG == CELERITAS_CORE_RNG_HIPRAND)
+    permute_all(order, states.rng.rng);
+#else
+    permute_all(order, states.rng.state);
+#endif
+    {
+        auto const& sim = states.sim;
+        permute_all(order,
+                    sim.track_ids,
+                    sim.parent_ids,
+                    sim.event_ids,
+                    sim.num_steps,
+                    sim.num_looping_steps,
+                    sim.time,
+                    sim.track_length,
+                    sim.status,
+                    sim.step_length,
+                    sim.post_step_action,
+                    sim.along_step_action);
+    }
+
+    // Tracks are now stored in thread order
+    auto* slots = states.track_slots.data().get();
+    std::iota(slots,
+              slots + states.track_slots.size(),
+              TrackSlotId::size_type{0});
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Count tracks associated to each action that was used to sort them, specified
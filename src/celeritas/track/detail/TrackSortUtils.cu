@@ -24,6 +24,8 @@
 #include "corecel/sys/Stream.hh"
 #include "corecel/sys/Thrust.device.hh"
 
+#include "SpatialKeyCalculator.hh"
+
 namespace celeritas
 {
 namespace detail
@@ -80,6 +82,9 @@ reorder_ids_kernel(ObserverPtr<TrackSlotId::size_type const> track_slots,
 //---------------------------------------------------------------------------//
 /*!
  * Sort track slots using ids as keys.
+ *
+ * The sort is stable so that the order from a previous (e.g. spatial) sort is
+ * preserved within each ID.
  */
 template<class Id, class IdT = typename Id::size_type>
 void sort_impl(TrackSlots const& track_slots,
@@ -95,10 +100,10 @@ void sort_impl(TrackSlots const& track_slots,
                                    ids,
                                    make_observer(reordered_ids.data()),
                                    track_slots.size());
-    thrust::sort_by_key(thrust_execute_on(stream_id),
-                        reordered_ids.data(),
-                        reordered_ids.data() + reordered_ids.size(),
-                        device_pointer_cast(track_slots.data()));
+    thrust::stable_sort_by_key(thrust_execute_on(stream_id),
+                               reordered_ids.data(),
+                               reordered_ids.data() + reordered_ids.size(),
+                               device_pointer_cast(track_slots.data()));
     CELER_DEVICE_CHECK_ERROR();
 }
 
@@ -135,6 +140,26 @@ tracks_per_action_kernel(ObserverPtr<ActionId const> actions,
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the spatial key of each sorted track slot.
+ */
+__global__ void
+spatial_keys_kernel(CoreParamsPtr<MemSpace::device> params,
+                    CoreStatePtr<MemSpace::device> state,
+                    SpatialKeyCalculator calc_key,
+                    ObserverPtr<SpatialKeyCalculator::result_type> keys)
+{
+    auto const& states = *state;
+    if (ThreadId tid = celeritas::KernelParamCalculator::thread_id();
+        tid < states.size())
+    {
+        TrackSlotId slot{states.track_slots[tid]};
+        keys.get()[tid.get()]
+            = calc_spatial_key(*params, states, calc_key, slot);
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace
 
@@ -167,6 +192,33 @@ void sort_tracks(DeviceRef<CoreStateData> const& states, TrackOrder order)
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Sort tracks by volume and position.
+ */
+void sort_tracks_spatial(CoreParamsPtr<MemSpace::device> params,
+                         CoreStatePtr<MemSpace::device> state,
+                         SpatialKeyCalculator const& calc_key)
+{
+    CELER_EXPECT(params && state);
+
+    auto const& states = *state;
+    DeviceVector<SpatialKeyCalculator::result_type> keys(states.size(),
+                                                         states.stream_id);
+    CELER_LAUNCH_KERNEL(spatial_keys,
+                        states.size(),
+                        celeritas::device().stream(states.stream_id).get(),
+                        params,
+                        state,
+                        calc_key,
+                        make_observer(keys.data()));
+    thrust::sort_by_key(thrust_execute_on(states.stream_id),
+                        keys.data(),
+                        keys.data() + keys.size(),
+                        device_pointer_cast(states.track_slots.data()));
+    CELER_DEVICE_CHECK_ERROR();
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Count tracks associated to each action that was used to sort them, specified
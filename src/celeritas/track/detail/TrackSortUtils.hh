@@ -21,6 +21,8 @@ namespace celeritas
 {
 namespace detail
 {
+struct SpatialKeyCalculator;
+
 //---------------------------------------------------------------------------//
 // HELPER FUNCTIONS
 //---------------------------------------------------------------------------//
@@ -30,6 +32,17 @@ namespace detail
 void sort_tracks(HostRef<CoreStateData> const&, TrackOrder);
 void sort_tracks(DeviceRef<CoreStateData> const&, TrackOrder);
 
+// Sort tracks by action and calculate action offsets in a single pass
+void sort_tracks(HostRef<CoreStateData> const&, TrackOrder, Span<ThreadId>);
+
+// Sort tracks by volume and position
+void sort_tracks_spatial(CoreParamsPtr<MemSpace::host>,
+                         CoreStatePtr<MemSpace::host>,
+                         SpatialKeyCalculator const&);
+void sort_tracks_spatial(CoreParamsPtr<MemSpace::device>,
+                         CoreStatePtr<MemSpace::device>,
+                         SpatialKeyCalculator const&);
+
 //---------------------------------------------------------------------------//
 // Count tracks associated to each action
 void count_tracks_per_action(
@@ -44,6 +57,13 @@ void count_tracks_per_action(
     Collection<ThreadId, Ownership::value, MemSpace::mapped, ActionId>&,
     TrackOrder);
 
+//---------------------------------------------------------------------------//
+// Calculate the fraction of threads whose track slot is not contiguous
+real_type calc_fragmentation(HostRef<CoreStateData> const&);
+
+// Permute track states into sorted order and reset the track slots
+void permute_tracks(HostRef<CoreStateData> const&);
+
 //---------------------------------------------------------------------------//
 // Fill missing action offsets.
 void backfill_action_count(Span<ThreadId>, size_type);
@@ -100,6 +120,13 @@ inline void sort_tracks(DeviceRef<CoreStateData> const&, TrackOrder)
     CELER_NOT_CONFIGURED("CUDA or HIP");
 }
 
+inline void sort_tracks_spatial(CoreParamsPtr<MemSpace::device>,
+                                CoreStatePtr<MemSpace::device>,
+                                SpatialKeyCalculator const&)
+{
+    CELER_NOT_CONFIGURED("CUDA or HIP");
+}
+
 inline void count_tracks_per_action(
     DeviceRef<CoreStateData> const&,
     Span<ThreadId>,
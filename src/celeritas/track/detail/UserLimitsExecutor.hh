@@ -0,0 +1,84 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/detail/UserLimitsExecutor.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Macros.hh"
+#include "corecel/math/Atomics.hh"
+#include "celeritas/global/CoreTrackView.hh"
+
+#include "../UserLimitsData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Kill tracks that exceed the user limits of their volume.
+ *
+ * This is applied after the physics pre-step so that the step's energy
+ * deposition has been reset. As with \c G4UserSpecialCuts, the kinetic energy
+ * of a killed track is deposited locally (positrons do not annihilate). The
+ * along-step and post-step actions are set to this action so that the track
+ * is neither transported nor interacts.
+ */
+struct UserLimitsExecutor
+{
+    //// DATA ////
+
+    NativeCRef<UserLimitsParamsData> params;
+    NativeRef<UserLimitsStateData> state;
+    ActionId action;
+
+    //// FUNCTIONS ////
+
+    inline CELER_FUNCTION void operator()(celeritas::CoreTrackView& track);
+};
+
+//---------------------------------------------------------------------------//
+CELER_FUNCTION void
+UserLimitsExecutor::operator()(celeritas::CoreTrackView& track)
+{
+    using Energy = units::MevEnergy;
+
+    auto geo = track.make_geo_view();
+    if (geo.is_outside())
+    {
+        return;
+    }
+    UserLimitsId limits_id = params.volume_limits[geo.volume_id()];
+    if (!limits_id)
+    {
+        // No limits in this volume
+        return;
+    }
+
+    UserLimits const& limits = params.limits[limits_id];
+    auto particle = track.make_particle_view();
+    auto sim = track.make_sim_view();
+    if (particle.energy() >= limits.min_energy
+        && sim.track_length() < limits.max_track_length
+        && sim.time() < limits.max_time)
+    {
+        return;
+    }
+
+    // Deposit the remaining energy, tally, and kill the track
+    Energy deposited = particle.energy();
+    track.make_physics_step_view().deposit_energy(deposited);
+    atomic_add(&state.energy[limits_id], value_as<Energy>(deposited));
+    atomic_add(&state.num_killed[limits_id], size_type(1));
+    particle.subtract_energy(deposited);
+    sim.status(TrackStatus::killed);
+    sim.along_step_action(action);
+    sim.reset_step_limit(StepLimit{0, action});
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
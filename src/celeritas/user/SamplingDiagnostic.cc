@@ -0,0 +1,290 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/SamplingDiagnostic.cc
+//---------------------------------------------------------------------------//
+#include "SamplingDiagnostic.hh"
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+#include <nlohmann/json.hpp>
+
+#include "corecel/Config.hh"
+
+#include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionAlgorithms.hh"
+#include "corecel/io/JsonPimpl.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/io/OutputRegistry.hh"  // IWYU pragma: keep
+#include "corecel/sys/ActionRegistry.hh"  // IWYU pragma: keep
+#include "celeritas/global/ActionLauncher.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
+#include "celeritas/global/TrackExecutor.hh"
+
+#include "SamplingTallyData.hh"
+
+#include "detail/SamplingDiagnosticExecutor.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct and add to core params.
+ */
+std::shared_ptr<SamplingDiagnostic>
+SamplingDiagnostic::make_and_insert(CoreParams const& core, size_type num_bins)
+{
+    ActionRegistry& actions = *core.action_reg();
+    OutputRegistry& out = *core.output_reg();
+    auto result
+        = std::make_shared<SamplingDiagnostic>(actions.next_id(), num_bins);
+    actions.insert(result);
+    out.insert(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the action ID and number of histogram bins.
+ *
+ * Other required attributes are deferred until beginning-of-run.
+ */
+SamplingDiagnostic::SamplingDiagnostic(ActionId id, size_type num_bins)
+    : id_(id), num_bins_(num_bins)
+{
+    CELER_EXPECT(id_);
+
+    CELER_VALIDATE(CELERITAS_SAMPLING_COUNTERS,
+                   << "sampling diagnostic requires Celeritas to be built "
+                      "with CELERITAS_SAMPLING_COUNTERS enabled");
+    CELER_VALIDATE(num_bins_ > 1 && num_bins_ <= 32,
+                   << "invalid number of sampling diagnostic bins "
+                   << num_bins_ << " (must be in [2, 32])");
+}
+
+//---------------------------------------------------------------------------//
+//! Default destructor
+SamplingDiagnostic::~SamplingDiagnostic() = default;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Build the storage for diagnostic parameters and stream-dependent states.
+ */
+void SamplingDiagnostic::begin_run(CoreParams const& params, CoreStateHost&)
+{
+    return this->begin_run_impl(params);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Build the storage for diagnostic parameters and stream-dependent states.
+ */
+void SamplingDiagnostic::begin_run(CoreParams const& params, CoreStateDevice&)
+{
+    return this->begin_run_impl(params);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Execute action with host data.
+ */
+void SamplingDiagnostic::step(CoreParams const& params,
+                              CoreStateHost& state) const
+{
+    auto execute = make_active_track_executor(
+        params.ptr<MemSpace::native>(),
+        state.ptr(),
+        detail::SamplingDiagnosticExecutor{
+            store_.params<MemSpace::native>(),
+            store_.state<MemSpace::native>(state.stream_id(),
+                                           this->state_size())});
+    return launch_action(*this, params, state, execute);
+}
+
+//---------------------------------------------------------------------------//
+#if !CELER_USE_DEVICE
+void SamplingDiagnostic::step(CoreParams const&, CoreStateDevice&) const
+{
+    CELER_NOT_CONFIGURED("CUDA OR HIP");
+}
+#endif
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a long description of the action.
+ */
+std::string_view SamplingDiagnostic::description() const
+{
+    return "accumulate random number usage by sampling actions";
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write output to the given JSON object.
+ *
+ * Only actions that sampled at least once are written.
+ */
+void SamplingDiagnostic::output(JsonPimpl* j) const
+{
+    using json = nlohmann::json;
+
+    auto obj = json::object();
+    if (store_)
+    {
+        auto draws = this->calc_draws();
+        auto iterations = this->calc_iterations();
+        auto failures = this->calc_failures();
+
+        auto sp_action_reg = action_reg_.lock();
+        CELER_ASSERT(sp_action_reg);
+
+        auto actions = json::object();
+        for (auto action : range(ActionId(draws.size())))
+        {
+            auto const& action_draws = draws[action.get()];
+            if (std::all_of(action_draws.begin(),
+                            action_draws.end(),
+                            [](size_type c) { return c == 0; }))
+            {
+                continue;
+            }
+            actions[std::string{sp_action_reg->id_to_label(action)}] = {
+                {"draws", action_draws},
+                {"iterations", iterations[action.get()]},
+                {"failures", failures[action.get()]},
+            };
+        }
+        obj["actions"] = std::move(actions);
+    }
+
+    // Lower edge of each bin
+    VecCount bin_lower{0};
+    for (size_type i = 1; i < num_bins_; ++i)
+    {
+        bin_lower.push_back(size_type{1} << (i - 1));
+    }
+    obj["_bin_lower"] = std::move(bin_lower);
+
+    j->obj = std::move(obj);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the random number draw histograms indexed as [action][bin].
+ */
+auto SamplingDiagnostic::calc_draws() const -> VecVecCount
+{
+    CELER_EXPECT(store_);
+
+    VecCount counts(this->state_size(), 0);
+    accumulate_over_streams(
+        store_, [](auto& state) { return state.draws; }, &counts);
+    return this->reshape(counts);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the rejection iteration histograms indexed as [action][bin].
+ */
+auto SamplingDiagnostic::calc_iterations() const -> VecVecCount
+{
+    CELER_EXPECT(store_);
+
+    VecCount counts(this->state_size(), 0);
+    accumulate_over_streams(
+        store_, [](auto& state) { return state.iterations; }, &counts);
+    return this->reshape(counts);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the number of failed interactions for each action.
+ */
+auto SamplingDiagnostic::calc_failures() const -> VecCount
+{
+    CELER_EXPECT(store_);
+
+    VecCount result(store_.params<MemSpace::host>().num_actions, 0);
+    accumulate_over_streams(
+        store_, [](auto& state) { return state.failures; }, &result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Histogram state data size (number of actions times number of bins).
+ */
+size_type SamplingDiagnostic::state_size() const
+{
+    CELER_EXPECT(store_);
+
+    auto const& params = store_.params<MemSpace::host>();
+    return params.num_bins * params.num_actions;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Reset diagnostic results.
+ */
+void SamplingDiagnostic::clear()
+{
+    CELER_EXPECT(store_);
+
+    apply_to_all_streams(store_, [](auto& state) {
+        fill(size_type(0), &state.draws);
+        fill(size_type(0), &state.iterations);
+        fill(size_type(0), &state.failures);
+    });
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Build the storage for diagnostic parameters and stream-dependent states.
+ *
+ * This must be done lazily because the diagnostic may be created before all
+ * actions are defined in the \c ActionRegistry.
+ */
+void SamplingDiagnostic::begin_run_impl(CoreParams const& params)
+{
+    if (!store_)
+    {
+        static std::mutex initialize_mutex;
+        std::lock_guard<std::mutex> scoped_lock{initialize_mutex};
+
+        if (!store_)
+        {
+            action_reg_ = params.action_reg();
+
+            HostVal<SamplingTallyParamsData> host_params;
+            host_params.num_bins = num_bins_;
+            host_params.num_actions = params.action_reg()->num_actions();
+            store_ = {std::move(host_params), params.max_streams()};
+        }
+    }
+    CELER_ENSURE(store_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Reshape flattened histograms.
+ */
+auto SamplingDiagnostic::reshape(VecCount const& counts) const -> VecVecCount
+{
+    auto const& params = store_.params<MemSpace::host>();
+
+    VecVecCount result(params.num_actions);
+    for (auto i : range(result.size()))
+    {
+        auto start = counts.begin() + i * params.num_bins;
+        CELER_ASSERT(start + params.num_bins <= counts.end());
+        result[i] = {start, start + params.num_bins};
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
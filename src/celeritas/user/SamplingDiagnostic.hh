@@ -0,0 +1,140 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/SamplingDiagnostic.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "corecel/data/StreamStore.hh"
+#include "corecel/io/OutputInterface.hh"
+#include "celeritas/global/ActionInterface.hh"
+#include "celeritas/global/CoreTrackData.hh"
+
+#include "SamplingTallyData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+class ActionRegistry;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tally random number usage by each sampling action.
+ *
+ * This adds a \c sampling-diagnostic entry to the \c result category of the
+ * main Celeritas output with, for each action that sampled, histograms of the
+ * number of random numbers drawn and rejection loop iterations per call, and
+ * the number of interactions that failed. Discrete interactions are keyed by
+ * their model action, and multiple scattering by the along-step action.
+ * Counts are binned by powers of two (see \c SamplingTallyParamsData).
+ *
+ * The counters are only recorded when Celeritas is built with
+ * \c CELERITAS_SAMPLING_COUNTERS .
+ */
+class SamplingDiagnostic final : public CoreStepActionInterface,
+                                 public CoreBeginRunActionInterface,
+                                 public OutputInterface
+{
+  public:
+    //@{
+    //! \name Type aliases
+    using CoreStepActionInterface::CoreStateDevice;
+    using CoreStepActionInterface::CoreStateHost;
+    //@}
+
+  public:
+    //!@{
+    //! \name Type aliases
+    using WPConstActionRegistry = std::weak_ptr<ActionRegistry const>;
+    using VecCount = std::vector<size_type>;
+    using VecVecCount = std::vector<VecCount>;
+    //!@}
+
+  public:
+    // Construct and add to core params
+    static std::shared_ptr<SamplingDiagnostic>
+    make_and_insert(CoreParams const& core, size_type num_bins);
+
+    // Construct with ID and number of bins, deferring other data till later
+    SamplingDiagnostic(ActionId id, size_type num_bins);
+
+    // Default destructor
+    ~SamplingDiagnostic();
+
+    //!@{
+    //! \name Action interface
+    //! ID of the action
+    ActionId action_id() const final { return id_; }
+    //! Short name for the action
+    std::string_view label() const final { return "sampling-diagnostic"; }
+    // Description of the action for user interaction
+    std::string_view description() const final;
+    //! Dependency ordering of the action
+    StepActionOrder order() const final { return StepActionOrder::user_post; }
+    //!@}
+
+    //!@{
+    //! \name BeginRunAction interface
+    // Set host data at the beginning of a run
+    void begin_run(CoreParams const&, CoreStateHost&) final;
+    // Set device data at the beginning of a run
+    void begin_run(CoreParams const&, CoreStateDevice&) final;
+    //!@}
+
+    //!@{
+    //! \name ExplicitAction interface
+    // Launch kernel with host data
+    void step(CoreParams const&, CoreStateHost&) const final;
+    // Launch kernel with device data
+    void step(CoreParams const&, CoreStateDevice&) const final;
+    //!@}
+
+    //!@{
+    //! \name Output interface
+    //! Category of data to write
+    Category category() const final { return Category::result; }
+    // Write output to the given JSON object
+    void output(JsonPimpl*) const final;
+    //!@}
+
+    // Get the random number draw histograms indexed as [action][bin]
+    VecVecCount calc_draws() const;
+
+    // Get the rejection iteration histograms indexed as [action][bin]
+    VecVecCount calc_iterations() const;
+
+    // Get the number of failed interactions for each action
+    VecCount calc_failures() const;
+
+    // Histogram state data size (number of actions times number of bins)
+    size_type state_size() const;
+
+    // Reset diagnostic results
+    void clear();
+
+  private:
+    using StoreT = StreamStore<SamplingTallyParamsData, SamplingTallyStateData>;
+
+    ActionId id_;
+    size_type num_bins_;
+
+    WPConstActionRegistry action_reg_;
+
+    mutable StoreT store_;
+
+    //// HELPER METHODS ////
+
+    // Build the storage for diagnostic parameters and stream-dependent states
+    void begin_run_impl(CoreParams const&);
+
+    // Reshape flattened histograms
+    VecVecCount reshape(VecCount const& counts) const;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,50 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/SamplingTallyData.cc
+//---------------------------------------------------------------------------//
+#include "SamplingTallyData.hh"
+
+#include "corecel/Assert.hh"
+#include "corecel/data/CollectionAlgorithms.hh"
+#include "corecel/data/CollectionBuilder.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Resize based on number of bins and actions.
+ */
+template<MemSpace M>
+inline void resize(SamplingTallyStateData<Ownership::value, M>* state,
+                   HostCRef<SamplingTallyParamsData> const& params,
+                   StreamId,
+                   size_type)
+{
+    CELER_EXPECT(params);
+    resize(&state->draws, params.num_bins * params.num_actions);
+    fill(size_type(0), &state->draws);
+    resize(&state->iterations, params.num_bins * params.num_actions);
+    fill(size_type(0), &state->iterations);
+    resize(&state->failures, params.num_actions);
+    fill(size_type(0), &state->failures);
+}
+
+//---------------------------------------------------------------------------//
+// Explicit instantiations
+template void
+resize(SamplingTallyStateData<Ownership::value, MemSpace::host>* state,
+       HostCRef<SamplingTallyParamsData> const& params,
+       StreamId,
+       size_type);
+
+template void
+resize(SamplingTallyStateData<Ownership::value, MemSpace::device>* state,
+       HostCRef<SamplingTallyParamsData> const& params,
+       StreamId,
+       size_type);
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
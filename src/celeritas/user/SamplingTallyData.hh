@@ -0,0 +1,109 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/SamplingTallyData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Macros.hh"
+#include "corecel/data/Collection.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Shared sampling diagnostic attributes.
+ *
+ * Counts are binned logarithmically: bin zero is for no draws or iterations,
+ * bin \em k is for counts in \f$ [2^{k-1}, 2^k) \f$, and the last bin also
+ * includes all higher counts.
+ */
+template<Ownership W, MemSpace M>
+struct SamplingTallyParamsData
+{
+    //// DATA ////
+
+    //! Number of tally bins
+    size_type num_bins{0};
+    //! Number of actions
+    size_type num_actions{0};
+
+    //// METHODS ////
+
+    //! Whether the data is assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return num_bins > 0 && num_actions > 0;
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    SamplingTallyParamsData&
+    operator=(SamplingTallyParamsData<W2, M2> const& other)
+    {
+        CELER_EXPECT(other);
+        num_bins = other.num_bins;
+        num_actions = other.num_actions;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * State data for accumulating sampling costs for each action.
+ *
+ * \c draws and \c iterations are indexed as action_id * num_bins + bin_index,
+ * and \c failures is indexed by action ID.
+ */
+template<Ownership W, MemSpace M>
+struct SamplingTallyStateData
+{
+    //// TYPES ////
+
+    template<class T>
+    using Items = Collection<T, W, M>;
+
+    //// DATA ////
+
+    Items<size_type> draws;
+    Items<size_type> iterations;
+    Items<size_type> failures;
+
+    //// METHODS ////
+
+    //! Number of states
+    CELER_FUNCTION size_type size() const { return draws.size(); }
+
+    //! Whether the data is assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !draws.empty() && iterations.size() == draws.size()
+               && !failures.empty();
+    }
+
+    //! Assign from another set of states
+    template<Ownership W2, MemSpace M2>
+    SamplingTallyStateData& operator=(SamplingTallyStateData<W2, M2>& other)
+    {
+        CELER_EXPECT(other);
+        draws = other.draws;
+        iterations = other.iterations;
+        failures = other.failures;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+// Resize based on number of bins and actions
+template<MemSpace M>
+void resize(SamplingTallyStateData<Ownership::value, M>* state,
+            HostCRef<SamplingTallyParamsData> const& params,
+            StreamId,
+            size_type);
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
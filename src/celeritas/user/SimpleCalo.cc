@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #include "SimpleCalo.hh"
 
+#include <algorithm>
 #include <functional>
 #include <vector>
 #include <nlohmann/json.hpp>
@@ -101,6 +102,13 @@ SimpleCalo::SimpleCalo(std::string output_label,
     host_params.num_detectors = this->num_detectors();
     store_ = {std::move(host_params), num_streams};
 
+    tallies_.resize(num_streams);
+    for (auto& tally : tallies_)
+    {
+        tally.event.assign(this->num_detectors(), real_type{0});
+        tally.total.assign(this->num_detectors(), real_type{0});
+    }
+
     CELER_ENSURE(volume_ids_.size() == volume_labels_.size());
     CELER_ENSURE(store_);
 }
@@ -156,6 +164,67 @@ void SimpleCalo::process_steps(DeviceStepState state)
         store_.state<MemSpace::device>(state.stream_id, state.steps.size()));
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Reduce and reset the stream's tally at the end of an event.
+ *
+ * Per-thread host tallies are first combined into the stream's deposition.
+ * The stream's accumulated deposition (from whichever memory space it was
+ * tallied in) is then copied to host, added to the run total, and optionally
+ * written to the stream's output file.
+ */
+void SimpleCalo::end_event(StreamId stream_id, EventId event_id)
+{
+    CELER_EXPECT(stream_id < store_.num_streams());
+    CELER_EXPECT(event_id);
+
+    EventTally& tally = tallies_[stream_id.get()];
+    std::fill(tally.event.begin(), tally.event.end(), real_type{0});
+
+    VecReal temp_host(this->num_detectors());
+    auto reduce_state = [&tally, &temp_host](auto* state) {
+        if (!state)
+        {
+            return;
+        }
+        copy_to_host(state->energy_deposition, make_span(temp_host));
+        fill(real_type(0), &state->energy_deposition);
+        for (auto i : range(temp_host.size()))
+        {
+            tally.event[i] += temp_host[i];
+        }
+    };
+    if (auto* state = store_.state<MemSpace::host>(stream_id))
+    {
+        detail::simple_calo_reduce(*state);
+        reduce_state(state);
+    }
+    reduce_state(store_.state<MemSpace::device>(stream_id));
+
+    for (auto i : range(tally.event.size()))
+    {
+        tally.total[i] += tally.event[i];
+    }
+
+    if (event_filename_base_.empty())
+    {
+        return;
+    }
+    if (!tally.outfile.is_open())
+    {
+        std::string filename = event_filename_base_
+                               + std::to_string(stream_id.get()) + ".jsonl";
+        tally.outfile.open(filename, std::ios::out | std::ios::trunc);
+        CELER_VALIDATE(tally.outfile,
+                       << "failed to open file at '" << filename << "'");
+    }
+    nlohmann::json j = {
+        {"event", event_id.get()},
+        {"energy_deposition", tally.event},
+    };
+    tally.outfile << j.dump() << std::endl;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Write output to the given JSON object.
@@ -204,6 +273,19 @@ auto SimpleCalo::energy_deposition(StreamId stream_id) const
     return *result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get energy deposition from the last completed event on a stream.
+ *
+ * The result is zero before \c end_event is first called on the stream.
+ */
+auto SimpleCalo::event_energy_deposition(StreamId stream_id) const
+    -> VecReal const&
+{
+    CELER_EXPECT(stream_id < tallies_.size());
+    return tallies_[stream_id.get()].event;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Get accumulated energy deposition over all streams.
@@ -213,26 +295,68 @@ auto SimpleCalo::energy_deposition(StreamId stream_id) const
  * both host and device for some weird reason.
  *
  * The index in the vector corresponds to the detector ID and is in the same
- * order as the input labels.
+ * order as the input labels. The result includes both completed events and
+ * any deposition not yet reduced with \c end_event .
  */
 auto SimpleCalo::calc_total_energy_deposition() const -> VecReal
 {
     VecReal result(this->num_detectors(), real_type{0});
 
+    for (auto const& tally : tallies_)
+    {
+        for (auto i : range(result.size()))
+        {
+            result[i] += tally.total[i];
+        }
+    }
     accumulate_over_streams(
         store_, [](auto& state) { return state.energy_deposition; }, &result);
+    for (StreamId s : range(StreamId{store_.num_streams()}))
+    {
+        // Add host thread tallies not yet reduced
+        if (auto* state = store_.state<MemSpace::host>(s))
+        {
+            auto thread_edep
+                = state->thread_energy_deposition[AllItems<real_type>{}];
+            for (auto i : range(thread_edep.size()))
+            {
+                result[i % result.size()] += thread_edep[i];
+            }
+        }
+    }
     return result;
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Reset energy deposition to zero, usually at the start of an event.
+ * Write per-event energy deposition to a file for each stream.
+ *
+ * Files are opened when the first event on each stream ends.
+ */
+void SimpleCalo::set_event_output(std::string filename_base)
+{
+    CELER_EXPECT(!filename_base.empty());
+    event_filename_base_ = std::move(filename_base);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Reset energy deposition to zero, usually at the start of a run.
  */
 void SimpleCalo::clear()
 {
     apply_to_all_streams(store_, [](auto& state) {
         fill(real_type(0), &state.energy_deposition);
+        if (!state.thread_energy_deposition.empty())
+        {
+            fill(real_type(0), &state.thread_energy_deposition);
+        }
     });
+    for (auto& tally : tallies_)
+    {
+        std::fill(tally.event.begin(), tally.event.end(), real_type{0});
+        std::fill(tally.total.begin(), tally.total.end(), real_type{0});
+    }
 }
 
 //---------------------------------------------------------------------------//
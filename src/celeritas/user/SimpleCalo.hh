@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <fstream>
+#include <string>
 #include <vector>
 
 #include "corecel/Types.hh"
@@ -29,6 +31,14 @@ class GeoParamsInterface;
 /*!
  * Accumulate energy deposition in volumes.
  *
+ * Energy deposition is tallied into a per-stream state during each step. At
+ * the end of an event, \c end_event copies the stream's tally to host, adds it
+ * to the stream's run total, and resets the state so that the next event on
+ * that stream starts from zero. The deposition from the last completed event
+ * is available from \c event_energy_deposition and can optionally be written
+ * to a "JSON lines" file (one line per event) for each stream: a filename
+ * base of \c calo- writes \c calo-0.jsonl, \c calo-1.jsonl, etc.
+ *
  * \todo Add a "begin run" interface to set up the stream store, rather than
  * passing in number of streams at construction time.
  */
@@ -70,6 +80,8 @@ class SimpleCalo final : public StepInterface, public OutputInterface
     void process_steps(HostStepState) final;
     // Process device-generated hits
     void process_steps(DeviceStepState) final;
+    // Reduce and reset the stream's tally at the end of an event
+    void end_event(StreamId, EventId) final;
     //!@}
 
     //!@{
@@ -91,21 +103,36 @@ class SimpleCalo final : public StepInterface, public OutputInterface
     template<MemSpace M>
     DetectorRef<M> const& energy_deposition(StreamId) const;
 
+    // Get energy deposition from the last completed event on a stream
+    VecReal const& event_energy_deposition(StreamId) const;
+
     // Get accumulated energy deposition over all streams and host/device
     VecReal calc_total_energy_deposition() const;
 
     //// MUTATORS ////
 
-    // Reset energy deposition to zero, usually at the start of an event
+    // Write per-event energy deposition to a file for each stream
+    void set_event_output(std::string filename_base);
+
+    // Reset energy deposition to zero, usually at the start of a run
     void clear();
 
   private:
     using StoreT = StreamStore<SimpleCaloParamsData, SimpleCaloStateData>;
 
+    struct EventTally
+    {
+        VecReal event;  //!< Deposition from the last completed event
+        VecReal total;  //!< Deposition summed over completed events
+        std::ofstream outfile;
+    };
+
     std::string output_label_;
     VecLabel volume_labels_;
     std::vector<VolumeId> volume_ids_;
     StoreT store_;
+    std::vector<EventTally> tallies_;
+    std::string event_filename_base_;
 };
 
 //---------------------------------------------------------------------------//
@@ -7,15 +7,24 @@
 //---------------------------------------------------------------------------//
 #include "SimpleCaloData.hh"
 
+#include "corecel/Config.hh"
+
 #include "corecel/Assert.hh"
 #include "corecel/data/CollectionAlgorithms.hh"
 #include "corecel/data/CollectionBuilder.hh"
 
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#    include <omp.h>
+#endif
+
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
  * Resize based on the number of detectors.
+ *
+ * Host states used by more than one OpenMP thread also allocate a private
+ * tally for each thread.
  */
 template<MemSpace M>
 void resize(SimpleCaloStateData<Ownership::value, M>* state,
@@ -26,6 +35,20 @@ void resize(SimpleCaloStateData<Ownership::value, M>* state,
     CELER_EXPECT(params);
     resize(&state->energy_deposition, params.num_detectors);
     fill(real_type(0), &state->energy_deposition);
+
+    size_type num_threads = 1;
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+    if constexpr (M == MemSpace::host)
+    {
+        num_threads = static_cast<size_type>(omp_get_max_threads());
+    }
+#endif
+    if (num_threads > 1)
+    {
+        resize(&state->thread_energy_deposition,
+               num_threads * params.num_detectors);
+        fill(real_type(0), &state->thread_energy_deposition);
+    }
     state->num_track_slots = num_track_slots;
     CELER_ENSURE(*state);
 }
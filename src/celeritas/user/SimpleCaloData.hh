@@ -43,6 +43,11 @@ struct SimpleCaloParamsData
  * statistical average of energy deposition, or to find energy deposition for a
  * particular event, the detector data can be reset at the end of each event,
  * at the end of a batch of events, or at the end of the simulation.
+ *
+ * With track-level OpenMP parallelism, each host thread tallies into its own
+ * row of \c thread_energy_deposition so that no atomics or locks are needed
+ * during a step; the rows are added to \c energy_deposition at the end of the
+ * event. The per-thread data is empty on device and for a single host thread.
  */
 template<Ownership W, MemSpace M>
 struct SimpleCaloStateData
@@ -51,6 +56,8 @@ struct SimpleCaloStateData
 
     template<class T>
     using DetItems = celeritas::Collection<T, W, M, DetectorId>;
+    template<class T>
+    using Items = celeritas::Collection<T, W, M>;
     using EnergyUnits = units::Mev;
 
     //// DATA ////
@@ -58,6 +65,9 @@ struct SimpleCaloStateData
     // Energy indexed by detector ID
     DetItems<real_type> energy_deposition;
 
+    // Unreduced energy indexed by thread * num_detectors + detector ID
+    Items<real_type> thread_energy_deposition;
+
     // Number of track slots (unused during calculation)
     size_type num_track_slots{};
 
@@ -77,6 +87,7 @@ struct SimpleCaloStateData
     SimpleCaloStateData& operator=(SimpleCaloStateData<W2, M2>& other)
     {
         energy_deposition = other.energy_deposition;
+        thread_energy_deposition = other.thread_energy_deposition;
         num_track_slots = other.num_track_slots;
         return *this;
     }
@@ -44,7 +44,7 @@ StepCollector::StepCollector(VecInterface callbacks,
                              SPConstGeo geo,
                              size_type num_streams,
                              ActionRegistry* action_registry)
-    : storage_(std::make_shared<detail::StepStorage>())
+    : callbacks_(callbacks), storage_(std::make_shared<detail::StepStorage>())
 {
     CELER_EXPECT(!callbacks.empty());
     CELER_EXPECT(std::all_of(
@@ -166,5 +166,32 @@ StepSelection const& StepCollector::selection() const
     return storage_->obj.params<MemSpace::host>().selection;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Access the selection and detector mapping on host.
+ *
+ * This allows step data generated outside the core stepping loop (e.g. by
+ * parameterized showers) to be filtered consistently with gathered steps.
+ */
+HostCRef<StepParamsData> const& StepCollector::host_ref() const
+{
+    return storage_->obj.params<MemSpace::host>();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Finalize step interfaces at the end of an event on a stream.
+ */
+void StepCollector::end_event(StreamId stream, EventId event) const
+{
+    CELER_EXPECT(stream);
+    CELER_EXPECT(event);
+
+    for (SPStepInterface const& sp_interface : callbacks_)
+    {
+        sp_interface->end_event(stream, event);
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -70,11 +70,21 @@ class StepCollector
     // See which data are being gathered
     StepSelection const& selection() const;
 
+    // Access the selection and detector mapping on host
+    HostCRef<StepParamsData> const& host_ref() const;
+
+    //! Access the step interfaces
+    VecInterface const& callbacks() const { return callbacks_; }
+
+    // Finalize step interfaces at the end of an event on a stream
+    void end_event(StreamId, EventId) const;
+
   private:
     template<StepPoint P>
     using SPStepGatherAction = std::shared_ptr<detail::StepGatherAction<P>>;
     using SPStepStorage = std::shared_ptr<detail::StepStorage>;
 
+    VecInterface callbacks_;
     SPStepStorage storage_;
     SPStepGatherAction<StepPoint::pre> pre_action_;
     SPStepGatherAction<StepPoint::post> post_action_;
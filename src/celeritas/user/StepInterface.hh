@@ -71,7 +71,15 @@ class StepInterface
     //! Process device-generated hit data
     virtual void process_steps(DeviceStepState) = 0;
 
-    // TODO: hook for end-of-event and/or end-of-run
+    /*!
+     * Finalize the data for an event that was transported on a stream.
+     *
+     * This is called after all tracks from the event have been transported
+     * and before the next event starts on the same stream. It is \em not
+     * called when multiple events are transported simultaneously on a stream.
+     * By default nothing is done.
+     */
+    virtual void end_event(StreamId, EventId) {}
 
   protected:
     // Protected destructor prevents deletion of pointer-to-interface
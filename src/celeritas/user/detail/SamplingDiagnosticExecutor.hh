@@ -0,0 +1,105 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/user/detail/SamplingDiagnosticExecutor.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Config.hh"
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/math/Atomics.hh"
+#include "celeritas/global/CoreTrackView.hh"
+
+#include "../SamplingTallyData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+struct SamplingDiagnosticExecutor
+{
+    inline CELER_FUNCTION void
+    operator()(celeritas::CoreTrackView const& track);
+
+    // Tally a single sampling record
+    inline CELER_FUNCTION void tally(SamplingRecord const& record);
+
+    // Logarithmic bin for a count
+    inline CELER_FUNCTION size_type calc_bin(size_type count) const;
+
+    NativeCRef<SamplingTallyParamsData> const params;
+    NativeRef<SamplingTallyStateData> const state;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tally the random number usage of this step's MSC and interaction sampling.
+ */
+CELER_FUNCTION void
+SamplingDiagnosticExecutor::operator()(CoreTrackView const& track)
+{
+    CELER_EXPECT(params);
+    CELER_EXPECT(state);
+
+#if CELERITAS_SAMPLING_COUNTERS
+    auto phys_step = track.make_physics_step_view();
+    this->tally(phys_step.msc_sampling());
+    this->tally(phys_step.interaction_sampling());
+#else
+    CELER_DISCARD(track);
+    CELER_ASSERT_UNREACHABLE();
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tally a single sampling record.
+ */
+CELER_FUNCTION void
+SamplingDiagnosticExecutor::tally(SamplingRecord const& record)
+{
+    if (!record)
+    {
+        // No sampling by this type of action during the step
+        return;
+    }
+
+    using BinId = ItemId<size_type>;
+
+    size_type action = record.action.get();
+    CELER_ASSERT(action < params.num_actions);
+    size_type offset = action * params.num_bins;
+    BinId draws_bin{offset + this->calc_bin(record.counters.draws)};
+    BinId iterations_bin{offset + this->calc_bin(record.counters.iterations)};
+    atomic_add(&state.draws[draws_bin], size_type{1});
+    atomic_add(&state.iterations[iterations_bin], size_type{1});
+    if (record.failed)
+    {
+        atomic_add(&state.failures[BinId(action)], size_type{1});
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Logarithmic bin for a count.
+ */
+CELER_FUNCTION size_type
+SamplingDiagnosticExecutor::calc_bin(size_type count) const
+{
+    size_type result = 0;
+    while (count > 0 && result + 1 < params.num_bins)
+    {
+        count >>= 1;
+        ++result;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
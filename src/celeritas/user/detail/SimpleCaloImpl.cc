@@ -10,10 +10,14 @@
 #include "corecel/Config.hh"
 
 #include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
 #include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ThreadId.hh"
 
-#include "SimpleCaloExecutor.hh"  // IWYU pragma: associated
+#if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
+#    include <omp.h>
+#endif
 
 namespace celeritas
 {
@@ -22,23 +26,76 @@ namespace detail
 //---------------------------------------------------------------------------//
 /*!
  * Accumulate energy deposition on host.
+ *
+ * With multiple OpenMP threads, each thread tallies into its own row of the
+ * per-thread deposition, so no atomics or locks are needed. The rows are added
+ * to the detector totals by \c simple_calo_reduce at the end of the event.
  */
 void simple_calo_accum(HostRef<StepStateData> const& step,
                        HostRef<SimpleCaloStateData>& calo)
 {
     CELER_EXPECT(step && calo);
+    CELER_EXPECT(!step.data.energy_deposition.empty());
+
+    auto accum = [&step](Span<real_type> edep, TrackSlotId tid) {
+        if (DetectorId det = step.data.detector[tid])
+        {
+            CELER_ASSERT(det < edep.size());
+            edep[det.get()] += step.data.energy_deposition[tid].value();
+        }
+    };
+
     MultiExceptionHandler capture_exception;
-    SimpleCaloExecutor execute{step, calo};
 #if CELERITAS_OPENMP == CELERITAS_OPENMP_TRACK
-#    pragma omp parallel for
+    if (auto thread_edep
+        = calo.thread_energy_deposition[AllItems<real_type>{}];
+        !thread_edep.empty())
+    {
+        auto const num_detectors = calo.energy_deposition.size();
+        int const num_threads
+            = static_cast<int>(thread_edep.size() / num_detectors);
+#    pragma omp parallel num_threads(num_threads)
+        {
+            auto local_edep = thread_edep.subspan(
+                static_cast<size_type>(omp_get_thread_num()) * num_detectors,
+                num_detectors);
+#    pragma omp for
+            for (ThreadId::size_type i = 0; i < step.size(); ++i)
+            {
+                CELER_TRY_HANDLE(accum(local_edep, TrackSlotId{i}),
+                                 capture_exception);
+            }
+        }
+        log_and_rethrow(std::move(capture_exception));
+        return;
+    }
 #endif
+
+    auto edep = calo.energy_deposition[AllItems<real_type>{}];
     for (ThreadId::size_type i = 0; i < step.size(); ++i)
     {
-        CELER_TRY_HANDLE(execute(ThreadId{i}), capture_exception);
+        CELER_TRY_HANDLE(accum(edep, TrackSlotId{i}), capture_exception);
     }
     log_and_rethrow(std::move(capture_exception));
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Add per-thread host deposition to the detector totals and reset it.
+ */
+void simple_calo_reduce(HostRef<SimpleCaloStateData>& calo)
+{
+    CELER_EXPECT(calo);
+
+    auto edep = calo.energy_deposition[AllItems<real_type>{}];
+    auto thread_edep = calo.thread_energy_deposition[AllItems<real_type>{}];
+    for (auto i : range(thread_edep.size()))
+    {
+        edep[i % edep.size()] += thread_edep[i];
+        thread_edep[i] = 0;
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace detail
 }  // namespace celeritas
@@ -24,6 +24,8 @@ void simple_calo_accum(HostRef<StepStateData> const& step,
 void simple_calo_accum(DeviceRef<StepStateData> const& step,
                        DeviceRef<SimpleCaloStateData>& calo);
 
+void simple_calo_reduce(HostRef<SimpleCaloStateData>& calo);
+
 #if !CELER_USE_DEVICE
 inline void simple_calo_accum(DeviceRef<StepStateData> const&,
                               DeviceRef<SimpleCaloStateData>&)
@@ -46,6 +46,7 @@ void BuildOutput::output(JsonPimpl* j) const
         cfg["CELERITAS_BUILD_TYPE"] = celeritas_build_type;
         cfg["CELERITAS_HOSTNAME"] = celeritas_hostname;
         cfg["CELERITAS_REAL_TYPE"] = celeritas_real_type;
+        cfg["CELERITAS_TABLE_REAL_TYPE"] = celeritas_table_real_type;
         cfg["CELERITAS_CORE_GEO"] = celeritas_core_geo;
         cfg["CELERITAS_CORE_RNG"] = celeritas_core_rng;
         cfg["CELERITAS_UNITS"] = celeritas_units;
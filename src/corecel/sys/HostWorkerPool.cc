@@ -0,0 +1,191 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/HostWorkerPool.cc
+//---------------------------------------------------------------------------//
+#include "HostWorkerPool.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+#include "corecel/cont/Range.hh"
+
+#ifdef _OPENMP
+#    include <omp.h>
+#endif
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Number of polling iterations before a waiting thread gives up its core
+constexpr int spin_count = 1 << 14;
+
+//! Maximum time a parked worker sleeps before checking for work
+constexpr std::chrono::milliseconds park_interval{100};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the default number of threads.
+ *
+ * This respects \c OMP_NUM_THREADS if OpenMP is enabled.
+ */
+size_type default_num_threads()
+{
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return std::max(1u, std::thread::hardware_concurrency());
+#endif
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the total number of threads, including the caller.
+ */
+HostWorkerPool::HostWorkerPool(size_type num_threads)
+{
+    CELER_EXPECT(num_threads > 0);
+
+    workers_.reserve(num_threads - 1);
+    for ([[maybe_unused]] auto i : range(num_threads - 1))
+    {
+        workers_.emplace_back([this] { this->run_worker(); });
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the default number of threads.
+ */
+HostWorkerPool::HostWorkerPool() : HostWorkerPool(default_num_threads()) {}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Stop and join the worker threads.
+ */
+HostWorkerPool::~HostWorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> park_lock(park_mutex_);
+        stop_ = true;
+        generation_.fetch_add(1, std::memory_order_release);
+    }
+    wake_.notify_all();
+    for (auto& t : workers_)
+    {
+        t.join();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Execute a job on all threads and wait for it to complete.
+ */
+void HostWorkerPool::launch(Job const& job)
+{
+    CELER_EXPECT(job.execute && job.func);
+    CELER_EXPECT(job.size <= std::numeric_limits<size_type>::max()
+                                 - this->num_threads() * job.chunk_size);
+
+    if (job.size == 0)
+    {
+        return;
+    }
+    if (job.size <= job.chunk_size || workers_.empty()
+        || busy_.exchange(true, std::memory_order_acquire))
+    {
+        // Not enough work to share, or the pool is already in use: execute on
+        // the calling thread
+        job.execute(job.func, 0, job.size);
+        return;
+    }
+
+    job_ = job;
+    next_begin_.store(0, std::memory_order_relaxed);
+    num_busy_.store(workers_.size(), std::memory_order_relaxed);
+    {
+        // Lock to avoid a lost wake-up for workers about to park
+        std::lock_guard<std::mutex> park_lock(park_mutex_);
+        generation_.fetch_add(1, std::memory_order_release);
+    }
+    wake_.notify_all();
+
+    this->execute_chunks();
+
+    // Wait for the workers to finish their last chunks
+    for (int i = 0; num_busy_.load(std::memory_order_acquire) != 0; ++i)
+    {
+        if (i >= spin_count)
+        {
+            std::this_thread::yield();
+        }
+    }
+    busy_.store(false, std::memory_order_release);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Claim and execute chunks until the range is exhausted.
+ */
+void HostWorkerPool::execute_chunks()
+{
+    Job const& job = job_;
+    for (size_type begin
+         = next_begin_.fetch_add(job.chunk_size, std::memory_order_relaxed);
+         begin < job.size;
+         begin = next_begin_.fetch_add(job.chunk_size,
+                                       std::memory_order_relaxed))
+    {
+        size_type end = std::min(begin + job.chunk_size, job.size);
+        job.execute(job.func, begin, end);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Wait for jobs and execute them until the pool is destroyed.
+ */
+void HostWorkerPool::run_worker()
+{
+    unsigned int seen = 0;
+    while (true)
+    {
+        // Spin briefly, then park until the next launch
+        unsigned int gen = generation_.load(std::memory_order_acquire);
+        for (int i = 0; gen == seen && i < spin_count; ++i)
+        {
+            gen = generation_.load(std::memory_order_acquire);
+        }
+        if (gen == seen)
+        {
+            // Use a timed wait: the untimed condition_variable::wait symbol
+            // was re-versioned in newer libstdc++ releases, so calling it
+            // prevents loading with older runtimes (e.g. Conda environments)
+            std::unique_lock<std::mutex> park_lock(park_mutex_);
+            auto woken = [this, &gen, seen] {
+                gen = generation_.load(std::memory_order_acquire);
+                return gen != seen;
+            };
+            while (!wake_.wait_for(park_lock, park_interval, woken)) {}
+        }
+        seen = gen;
+
+        if (stop_)
+        {
+            return;
+        }
+        this->execute_chunks();
+        num_busy_.fetch_sub(1, std::memory_order_acq_rel);
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,132 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/HostWorkerPool.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Persistent threads for executing ranges of work on the host.
+ *
+ * The worker threads are created once and wait between launches, so a launch
+ * costs a wake-up and a join rather than the creation of a parallel region.
+ * Idle workers spin for a short time before parking on a condition variable:
+ * consecutive launches in a step wake them without a system call, and a pool
+ * that is not in use does not consume CPU time.
+ *
+ * Work is self-scheduled: the calling thread and all workers repeatedly claim
+ * the next chunk of the range from a shared atomic counter until the range is
+ * exhausted, and the call returns once every thread has finished its last
+ * chunk.
+ *
+ * Only one launch may execute at a time. If the pool is already executing
+ * work (e.g. when launched by multiple streams concurrently, or from inside
+ * an executing function) the range is executed on the calling thread.
+ *
+ * \code
+    HostWorkerPool pool(4);
+    pool(num_slots, 64, [&](size_type begin, size_type end) {
+        for (auto i : range(begin, end))
+        {
+            execute(ThreadId{i});
+        }
+    });
+ * \endcode
+ *
+ * The executed function must not throw.
+ */
+class HostWorkerPool
+{
+  public:
+    // Construct with the total number of threads, including the caller
+    explicit HostWorkerPool(size_type num_threads);
+
+    // Construct with the default number of threads
+    HostWorkerPool();
+
+    // Stop and join the worker threads
+    ~HostWorkerPool();
+
+    CELER_DELETE_COPY_MOVE(HostWorkerPool);
+
+    // Execute a function over chunks of [0, size)
+    template<class F>
+    inline void operator()(size_type size, size_type chunk_size, F const& f);
+
+    //! Total number of threads, including the caller
+    size_type num_threads() const { return workers_.size() + 1; }
+
+  private:
+    //// TYPES ////
+
+    using ExecuteRange = void (*)(void const*, size_type, size_type);
+
+    struct Job
+    {
+        ExecuteRange execute{nullptr};
+        void const* func{nullptr};
+        size_type size{0};
+        size_type chunk_size{1};
+    };
+
+    //// DATA ////
+
+    std::vector<std::thread> workers_;
+    std::mutex park_mutex_;
+    std::condition_variable wake_;
+    std::atomic<bool> busy_{false};
+    std::atomic<unsigned int> generation_{0};
+    std::atomic<size_type> next_begin_{0};
+    std::atomic<size_type> num_busy_{0};
+    bool stop_{false};
+    Job job_;
+
+    //// HELPER FUNCTIONS ////
+
+    void launch(Job const& job);
+    void execute_chunks();
+    void run_worker();
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Execute a function over chunks of [0, size).
+ *
+ * The function is called with nonempty half-open [begin, end) ranges of at
+ * most \c chunk_size elements that together cover [0, size) exactly once.
+ */
+template<class F>
+void HostWorkerPool::operator()(size_type size,
+                                size_type chunk_size,
+                                F const& f)
+{
+    CELER_EXPECT(chunk_size > 0);
+    Job job;
+    job.execute = [](void const* func, size_type begin, size_type end) {
+        (*static_cast<F const*>(func))(begin, end);
+    };
+    job.func = &f;
+    job.size = size;
+    job.chunk_size = chunk_size;
+    this->launch(job);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
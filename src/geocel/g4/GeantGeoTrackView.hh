@@ -14,6 +14,8 @@
 #include <G4TouchableHandle.hh>
 #include <G4TouchableHistory.hh>
 
+#include "corecel/Config.hh"
+
 #include "corecel/Macros.hh"
 #include "corecel/math/Algorithms.hh"
 #include "corecel/math/ArrayUtils.hh"
@@ -37,6 +39,11 @@ namespace celeritas
  * duplicating the "geant4" position and direction that are also stored under
  * the hood in the heavyweight navigator.
  *
+ * Each track slot has its own navigator and touchable history, so different
+ * slots can be navigated concurrently. When OpenMP is enabled (with either
+ * event- or track-level parallelism), the Geant4 thread-local geometry data
+ * is initialized the first time a thread constructs a track view.
+ *
  * For a description of ordering requirements, see: \sa OrangeTrackView .
  */
 class GeantGeoTrackView
@@ -174,6 +181,9 @@ GeantGeoTrackView::GeantGeoTrackView(ParamsRef const&,
     , touch_handle_(states.nav_state.touch_handle(tid))
     , navi_(states.nav_state.navigator(tid))
 {
+#if CELERITAS_USE_OPENMP
+    detail::initialize_geant_geo_thread();
+#endif
     g4pos_ = convert_to_geant(pos_, clhep_length);
     g4dir_ = convert_to_geant(dir_, 1);
     g4safety_ = convert_to_geant(safety_radius_, clhep_length);
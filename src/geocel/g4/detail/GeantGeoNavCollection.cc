@@ -7,9 +7,16 @@
 //---------------------------------------------------------------------------//
 #include "GeantGeoNavCollection.hh"
 
+#include <G4LogicalVolume.hh>
 #include <G4Navigator.hh>
+#include <G4PVParameterised.hh>
+#include <G4PVReplica.hh>
+#include <G4PhysicalVolumeStore.hh>
+#include <G4Region.hh>
 #include <G4TouchableHandle.hh>
 #include <G4TouchableHistory.hh>
+#include <G4VPhysicalVolume.hh>
+#include <G4VSolid.hh>
 
 #include "corecel/Assert.hh"
 #include "corecel/cont/Range.hh"
@@ -29,6 +36,58 @@ void G4ExternDeleter<T>::operator()(T* ptr) noexcept
 template struct G4ExternDeleter<GeantTouchableHandle>;
 template struct G4ExternDeleter<G4Navigator>;
 
+//---------------------------------------------------------------------------//
+/*!
+ * Initialize Geant4 thread-local geometry data on the current thread.
+ *
+ * Geant4 stores per-thread data for logical, physical, and replicated volumes
+ * and regions in "split classes" that are only set up for the master thread
+ * and Geant4 worker threads. Other threads (such as OpenMP threads that
+ * transport different events or track slots) must copy the master's data
+ * before accessing the geometry. This reproduces the geometry portion of
+ * \c G4WorkerThread::BuildGeometryAndPhysicsVector , including cloning
+ * solids of parameterised volumes so that each thread can modify its own.
+ *
+ * This is a no-op after the first call on a thread or if the thread already
+ * has split-class data.
+ */
+void initialize_geant_geo_thread()
+{
+    static thread_local bool const initialized = [] {
+        if (G4LogicalVolume::GetSubInstanceManager().GetOffset())
+        {
+            // Master or Geant4 worker thread
+            return true;
+        }
+
+        G4LogicalVolume::GetSubInstanceManager().SlaveCopySubInstanceArray();
+        G4VPhysicalVolume::GetSubInstanceManager().SlaveCopySubInstanceArray();
+        G4PVReplica::GetSubInstanceManager().SlaveCopySubInstanceArray();
+        G4Region::GetSubInstanceManager().SlaveInitializeSubInstance();
+
+        for (G4VPhysicalVolume* pv : *G4PhysicalVolumeStore::GetInstance())
+        {
+            auto* replica = dynamic_cast<G4PVReplica*>(pv);
+            if (!replica)
+            {
+                continue;
+            }
+            replica->InitialiseWorker(replica);
+
+            G4LogicalVolume* lv = pv->GetLogicalVolume();
+            G4VSolid* solid = lv->GetMasterSolid();
+            if (dynamic_cast<G4PVParameterised*>(pv))
+            {
+                // Parameterisations modify the solid in place
+                solid = solid->Clone();
+            }
+            lv->InitialiseWorker(lv, solid, nullptr);
+        }
+        return true;
+    }();
+    CELER_ENSURE(initialized);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Resize with a number of states.
@@ -58,6 +58,10 @@ using UPTouchHandle = std::unique_ptr<GeantTouchableHandle,
                                       G4ExternDeleter<GeantTouchableHandle>>;
 using UPNavigator = std::unique_ptr<G4Navigator, G4ExternDeleter<G4Navigator>>;
 
+//---------------------------------------------------------------------------//
+// Initialize Geant4 thread-local geometry data on the current thread
+void initialize_geant_geo_thread();
+
 //---------------------------------------------------------------------------//
 // HOST MEMSPACE
 //---------------------------------------------------------------------------//
@@ -0,0 +1,633 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/OrangeBinaryIO.cc
+//---------------------------------------------------------------------------//
+#include "OrangeBinaryIO.hh"
+
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Array.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/io/Label.hh"
+#include "corecel/io/Logger.hh"
+#include "geocel/BoundingBox.hh"
+
+#include "surf/SurfaceTypeTraits.hh"
+#include "transform/TransformTypeTraits.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// FILE FORMAT
+//---------------------------------------------------------------------------//
+//! Format version: increment when the layout of any field changes
+constexpr std::uint32_t format_version = 1;
+
+//! Identifier at the start of every file
+constexpr char format_magic[8] = {'O', 'R', 'A', 'N', 'G', 'E', 'B', 'N'};
+
+//! Written in native byte order to detect a mismatched reader
+constexpr std::uint32_t byte_order_mark = 0x01020304u;
+
+//! Largest number of reals needed to construct a surface or transform
+constexpr size_type max_storage_size = 12;
+
+//! Integers at or above this value are stored relative to the maximum
+constexpr std::uint32_t high_int = std::uint32_t{1} << 31;
+
+static_assert(std::is_same_v<std::variant_alternative_t<
+                                 static_cast<std::size_t>(UniverseType::simple),
+                                 VariantUniverseInput>,
+                             UnitInput>,
+              "universe type does not match variant index");
+static_assert(
+    std::is_same_v<std::variant_alternative_t<
+                       static_cast<std::size_t>(UniverseType::rect_array),
+                       VariantUniverseInput>,
+                   RectArrayInput>,
+    "universe type does not match variant index");
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert an integer, ID, or enum to a 32-bit value.
+ *
+ * Logic tokens and null IDs are near the top of the \c size_type range: they
+ * are stored relative to the top of the 32-bit range, so that the encoded
+ * value does not depend on the width of \c size_type .
+ */
+template<class T>
+std::uint32_t encode_int(T value)
+{
+    size_type v;
+    if constexpr (std::is_enum_v<T>)
+    {
+        v = static_cast<size_type>(value);
+    }
+    else if constexpr (std::is_integral_v<T>)
+    {
+        v = value;
+    }
+    else
+    {
+        v = value.unchecked_get();
+    }
+
+    constexpr auto max_int = std::numeric_limits<size_type>::max();
+    if (v < high_int)
+    {
+        return static_cast<std::uint32_t>(v);
+    }
+    CELER_VALIDATE(max_int - v < high_int,
+                   << "integer " << v
+                   << " is too large for ORANGE binary output");
+    return std::numeric_limits<std::uint32_t>::max()
+           - static_cast<std::uint32_t>(max_int - v);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a 32-bit value back to an integer, ID, or enum.
+ */
+template<class T>
+T decode_int(std::uint32_t value)
+{
+    size_type v = value;
+    if (value >= high_int)
+    {
+        v = std::numeric_limits<size_type>::max()
+            - (std::numeric_limits<std::uint32_t>::max() - value);
+    }
+    if constexpr (std::is_enum_v<T> || std::is_integral_v<T>)
+    {
+        return static_cast<T>(v);
+    }
+    else
+    {
+        return T{v};
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write plain data to a binary stream.
+ *
+ * Integers, IDs, enums, and array sizes are stored as 32-bit values; reals are
+ * stored with the native precision of the build.
+ */
+class BinaryWriter
+{
+  public:
+    explicit BinaryWriter(std::ostream* os) : os_{os} { CELER_EXPECT(os_); }
+
+    template<class T>
+    void value(T const& v)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        this->write_bytes(&v, sizeof(T));
+    }
+
+    template<class T>
+    void integer(T v)
+    {
+        this->value(encode_int(v));
+    }
+
+    template<class T>
+    void integers(std::vector<T> const& values)
+    {
+        this->size(values.size());
+        buffer_.resize(values.size());
+        for (auto i : range(values.size()))
+        {
+            buffer_[i] = encode_int(values[i]);
+        }
+        this->write_bytes(buffer_.data(), buffer_.size() * sizeof(buffer_[0]));
+    }
+
+    template<class T, std::size_t N>
+    void reals(Span<T, N> values)
+    {
+        static_assert(std::is_floating_point_v<std::remove_const_t<T>>);
+        this->write_bytes(values.data(), values.size() * sizeof(T));
+    }
+
+    void reals(std::vector<double> const& values)
+    {
+        this->size(values.size());
+        this->reals(make_span(values));
+    }
+
+    void size(std::size_t s)
+    {
+        CELER_VALIDATE(s <= std::numeric_limits<std::uint32_t>::max(),
+                       << "array size " << s
+                       << " is too large for ORANGE binary output");
+        this->value(static_cast<std::uint32_t>(s));
+    }
+
+    void string(std::string const& s)
+    {
+        this->size(s.size());
+        this->write_bytes(s.data(), s.size());
+    }
+
+  private:
+    std::ostream* os_;
+    std::vector<std::uint32_t> buffer_;
+
+    void write_bytes(void const* src, std::size_t count)
+    {
+        os_->write(static_cast<char const*>(src), count);
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read plain data from a binary stream, checking for truncation.
+ */
+class BinaryReader
+{
+  public:
+    explicit BinaryReader(std::istream* is) : is_{is} { CELER_EXPECT(is_); }
+
+    template<class T>
+    T value()
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        T result;
+        this->read_bytes(&result, sizeof(T));
+        return result;
+    }
+
+    template<class T>
+    T integer()
+    {
+        return decode_int<T>(this->value<std::uint32_t>());
+    }
+
+    template<class T>
+    void integers(std::vector<T>* values)
+    {
+        buffer_.resize(this->size());
+        this->read_bytes(buffer_.data(), buffer_.size() * sizeof(buffer_[0]));
+        values->resize(buffer_.size());
+        for (auto i : range(buffer_.size()))
+        {
+            (*values)[i] = decode_int<T>(buffer_[i]);
+        }
+    }
+
+    template<class T, std::size_t N>
+    void reals(Span<T, N> values)
+    {
+        static_assert(std::is_floating_point_v<T>);
+        this->read_bytes(values.data(), values.size() * sizeof(T));
+    }
+
+    void reals(std::vector<double>* values)
+    {
+        values->resize(this->size());
+        this->reals(make_span(*values));
+    }
+
+    std::size_t size() { return this->value<std::uint32_t>(); }
+
+    std::string string()
+    {
+        std::string result(this->size(), '\0');
+        this->read_bytes(result.data(), result.size());
+        return result;
+    }
+
+  private:
+    std::istream* is_;
+    std::vector<std::uint32_t> buffer_;
+
+    void read_bytes(void* dst, std::size_t count)
+    {
+        is_->read(static_cast<char*>(dst), count);
+        CELER_VALIDATE(*is_, << "ORANGE binary input is truncated");
+    }
+};
+
+//---------------------------------------------------------------------------//
+// WRITE
+//---------------------------------------------------------------------------//
+void write(BinaryWriter& out, Label const& label)
+{
+    out.string(label.name);
+    out.string(label.ext);
+}
+
+void write(BinaryWriter& out, BBox const& bbox)
+{
+    out.reals(make_span(bbox.lower()));
+    out.reals(make_span(bbox.upper()));
+}
+
+void write(BinaryWriter& out, VariantTransform const& transform)
+{
+    out.value(static_cast<TransformType>(transform.index()));
+    std::visit([&out](auto const& t) { out.reals(t.data()); }, transform);
+}
+
+void write(BinaryWriter& out, VolumeInput const& vol)
+{
+    write(out, vol.label);
+    out.integers(vol.faces);
+    out.integers(vol.logic);
+    write(out, vol.bbox);
+    out.value(static_cast<bool>(vol.obz));
+    if (vol.obz)
+    {
+        write(out, vol.obz.inner);
+        write(out, vol.obz.outer);
+        out.integer(vol.obz.transform_id);
+    }
+    out.integer(vol.flags);
+    out.integer(vol.zorder);
+}
+
+void write(BinaryWriter& out, UnitInput const& unit)
+{
+    out.size(unit.surfaces.size());
+    for (auto const& s : unit.surfaces)
+    {
+        out.value(static_cast<SurfaceType>(s.index()));
+        std::visit([&out](auto const& surf) { out.reals(surf.data()); }, s);
+    }
+
+    out.size(unit.volumes.size());
+    for (auto const& v : unit.volumes)
+    {
+        write(out, v);
+    }
+
+    write(out, unit.bbox);
+
+    out.size(unit.daughter_map.size());
+    for (auto const& [vol_id, daughter] : unit.daughter_map)
+    {
+        out.integer(vol_id);
+        out.integer(daughter.universe_id);
+        write(out, daughter.transform);
+    }
+
+    out.size(unit.surface_labels.size());
+    for (auto const& label : unit.surface_labels)
+    {
+        write(out, label);
+    }
+    write(out, unit.label);
+}
+
+void write(BinaryWriter& out, RectArrayInput const& arr)
+{
+    for (auto const& g : arr.grid)
+    {
+        out.reals(g);
+    }
+
+    out.size(arr.daughters.size());
+    for (auto const& daughter : arr.daughters)
+    {
+        out.integer(daughter.universe_id);
+        write(out, daughter.transform);
+    }
+    write(out, arr.label);
+}
+
+//---------------------------------------------------------------------------//
+// READ
+//---------------------------------------------------------------------------//
+void read(BinaryReader& in, Label* label)
+{
+    label->name = in.string();
+    label->ext = in.string();
+}
+
+void read(BinaryReader& in, BBox* bbox)
+{
+    Real3 lower;
+    Real3 upper;
+    in.reals(make_span(lower));
+    in.reals(make_span(upper));
+    *bbox = BBox::from_unchecked(lower, upper);
+}
+
+void read(BinaryReader& in, VariantTransform* transform)
+{
+    auto tt = in.value<TransformType>();
+    CELER_VALIDATE(tt < TransformType::size_,
+                   << "invalid transform type " << static_cast<int>(tt)
+                   << " in ORANGE binary input");
+
+    visit_transform_type(
+        [&in, transform](auto tt_constant) {
+            using Transform = typename decltype(tt_constant)::type;
+            using StorageSpan = typename Transform::StorageSpan;
+            static_assert(StorageSpan::extent <= max_storage_size);
+
+            Array<real_type, max_storage_size> data;
+            in.reals(Span<real_type, StorageSpan::extent>{
+                data.data(), StorageSpan::extent});
+            transform->emplace<Transform>(
+                StorageSpan{data.data(), StorageSpan::extent});
+        },
+        tt);
+}
+
+void read(BinaryReader& in, VolumeInput* vol)
+{
+    read(in, &vol->label);
+    in.integers(&vol->faces);
+    in.integers(&vol->logic);
+    read(in, &vol->bbox);
+    if (in.value<bool>())
+    {
+        read(in, &vol->obz.inner);
+        read(in, &vol->obz.outer);
+        vol->obz.transform_id = in.integer<TransformId>();
+    }
+    vol->flags = in.integer<logic_int>();
+    vol->zorder = in.integer<ZOrder>();
+    CELER_VALIDATE(*vol,
+                   << "invalid volume '" << vol->label
+                   << "' in ORANGE binary input");
+}
+
+void read(BinaryReader& in, UnitInput* unit)
+{
+    auto num_surfaces = in.size();
+    unit->surfaces.reserve(num_surfaces);
+    for ([[maybe_unused]] auto i : range(num_surfaces))
+    {
+        auto st = in.value<SurfaceType>();
+        CELER_VALIDATE(st < SurfaceType::size_,
+                       << "invalid surface type " << static_cast<int>(st)
+                       << " in ORANGE binary input");
+        visit_surface_type(
+            [&in, unit](auto st_constant) {
+                using Surface = typename decltype(st_constant)::type;
+                using StorageSpan = typename Surface::StorageSpan;
+                static_assert(StorageSpan::extent <= max_storage_size);
+
+                Array<real_type, max_storage_size> data;
+                in.reals(Span<real_type, StorageSpan::extent>{
+                    data.data(), StorageSpan::extent});
+                unit->surfaces.emplace_back(
+                    std::in_place_type<Surface>,
+                    StorageSpan{data.data(), StorageSpan::extent});
+            },
+            st);
+    }
+
+    unit->volumes.resize(in.size());
+    for (auto& v : unit->volumes)
+    {
+        read(in, &v);
+    }
+
+    read(in, &unit->bbox);
+
+    auto num_daughters = in.size();
+    for ([[maybe_unused]] auto i : range(num_daughters))
+    {
+        auto vol_id = in.integer<LocalVolumeId>();
+        CELER_VALIDATE(vol_id < unit->volumes.size(),
+                       << "invalid daughter volume in ORANGE binary input");
+        DaughterInput daughter;
+        daughter.universe_id = in.integer<UniverseId>();
+        read(in, &daughter.transform);
+        unit->daughter_map.emplace(vol_id, std::move(daughter));
+    }
+
+    unit->surface_labels.resize(in.size());
+    for (auto& label : unit->surface_labels)
+    {
+        read(in, &label);
+    }
+    read(in, &unit->label);
+}
+
+void read(BinaryReader& in, RectArrayInput* arr)
+{
+    for (auto& g : arr->grid)
+    {
+        in.reals(&g);
+    }
+
+    arr->daughters.resize(in.size());
+    for (auto& daughter : arr->daughters)
+    {
+        daughter.universe_id = in.integer<UniverseId>();
+        read(in, &daughter.transform);
+    }
+    read(in, &arr->label);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write the header.
+ */
+OrangeBinaryWriter::OrangeBinaryWriter(std::ostream* os,
+                                       Tolerance<> const& tol,
+                                       size_type num_universes)
+    : os_{os}, num_remaining_{num_universes}
+{
+    CELER_EXPECT(os_);
+    CELER_EXPECT(tol);
+    CELER_EXPECT(num_universes > 0);
+
+    BinaryWriter out{os_};
+    out.value(format_magic);
+    out.value(format_version);
+    out.value(byte_order_mark);
+    out.value(static_cast<std::uint32_t>(sizeof(real_type)));
+    out.size(num_universes);
+    out.value(tol.rel);
+    out.value(tol.abs);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write the next universe.
+ */
+void OrangeBinaryWriter::operator()(VariantUniverseInput const& inp)
+{
+    CELER_EXPECT(!this->finished());
+
+    BinaryWriter out{os_};
+    out.value(static_cast<UniverseType>(inp.index()));
+    std::visit([&out](auto const& u) { write(out, u); }, inp);
+    CELER_VALIDATE(*os_, << "failed to write ORANGE binary output");
+    --num_remaining_;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read and validate the header.
+ */
+OrangeBinaryReader::OrangeBinaryReader(std::istream* is) : is_{is}
+{
+    CELER_EXPECT(is_);
+
+    BinaryReader in{is_};
+    auto magic = in.value<Array<char, sizeof(format_magic)>>();
+    CELER_VALIDATE(
+        std::memcmp(magic.data(), format_magic, sizeof(format_magic)) == 0,
+        << "stream is not ORANGE binary input");
+
+    auto version = in.value<std::uint32_t>();
+    CELER_VALIDATE(version == format_version,
+                   << "unsupported ORANGE binary format version " << version
+                   << " (expected " << format_version << ")");
+    CELER_VALIDATE(in.value<std::uint32_t>() == byte_order_mark,
+                   << "ORANGE binary input was written with a different "
+                      "byte order");
+    auto real_size = in.value<std::uint32_t>();
+    CELER_VALIDATE(real_size == sizeof(real_type),
+                   << "ORANGE binary input was written with "
+                   << 8 * real_size << "-bit reals, but this build uses "
+                   << 8 * sizeof(real_type) << "-bit reals");
+
+    num_universes_ = in.size();
+    tol_.rel = in.value<real_type>();
+    tol_.abs = in.value<real_type>();
+    CELER_VALIDATE(num_universes_ > 0 && tol_,
+                   << "invalid ORANGE binary input header");
+
+    CELER_LOG(debug) << "Reading ORANGE binary input version " << version
+                     << " with " << num_universes_ << " universes";
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read the next universe.
+ */
+VariantUniverseInput OrangeBinaryReader::operator()()
+{
+    CELER_EXPECT(!this->finished());
+
+    BinaryReader in{is_};
+    VariantUniverseInput result;
+    switch (in.value<UniverseType>())
+    {
+        case UniverseType::simple:
+            read(in, &result.emplace<UnitInput>());
+            break;
+        case UniverseType::rect_array:
+            read(in, &result.emplace<RectArrayInput>());
+            break;
+        default:
+            CELER_VALIDATE(false,
+                           << "invalid universe type in ORANGE binary input");
+    }
+    ++num_read_;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Write a complete ORANGE input to a binary stream.
+ */
+void write_binary(std::ostream& os, OrangeInput const& inp)
+{
+    CELER_EXPECT(inp);
+
+    OrangeBinaryWriter write{&os, inp.tol, inp.universes.size()};
+    for (auto const& u : inp.universes)
+    {
+        write(u);
+    }
+    CELER_ENSURE(write.finished());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read a complete ORANGE input from a binary stream.
+ *
+ * Example to read from a file:
+ * \code
+   std::ifstream infile("foo.org.bin", std::ios::in | std::ios::binary);
+   OrangeInput inp = read_binary(infile);
+ * \endcode
+ */
+OrangeInput read_binary(std::istream& is)
+{
+    OrangeBinaryReader read{&is};
+
+    OrangeInput result;
+    result.tol = read.tol();
+    result.universes.reserve(read.num_universes());
+    while (!read.finished())
+    {
+        result.universes.push_back(read());
+    }
+
+    CELER_ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
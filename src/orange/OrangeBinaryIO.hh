@@ -0,0 +1,102 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/OrangeBinaryIO.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <iosfwd>
+
+#include "OrangeInput.hh"
+#include "OrangeTypes.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Write ORANGE input to a compact binary stream one universe at a time.
+ *
+ * The binary format is a header (identifier, format version, byte order,
+ * real size, number of universes, and tolerance) followed by each universe.
+ * Unlike the JSON format, it stores every field of the input (including
+ * oriented bounding zones) exactly and requires no parsing. Integers and IDs
+ * are stored as 32-bit values, and reals are stored with the precision of the
+ * build: a file can only be read by a build with the same \c real_type and
+ * byte order.
+ *
+ * The stream should be opened in binary mode.
+ * \code
+   std::ofstream outfile("foo.org.bin", std::ios::out | std::ios::binary);
+   OrangeBinaryWriter write{&outfile, inp.tol, inp.universes.size()};
+   for (auto const& u : inp.universes)
+   {
+       write(u);
+   }
+ * \endcode
+ */
+class OrangeBinaryWriter
+{
+  public:
+    // Write the header
+    OrangeBinaryWriter(std::ostream* os,
+                       Tolerance<> const& tol,
+                       size_type num_universes);
+
+    // Write the next universe
+    void operator()(VariantUniverseInput const& inp);
+
+    //! Whether all universes have been written
+    bool finished() const { return num_remaining_ == 0; }
+
+  private:
+    std::ostream* os_;
+    size_type num_remaining_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read ORANGE input from a binary stream one universe at a time.
+ *
+ * The header is read and validated on construction. Each call reads the next
+ * universe directly from the stream, so the full file is never buffered in
+ * memory.
+ */
+class OrangeBinaryReader
+{
+  public:
+    // Read and validate the header
+    explicit OrangeBinaryReader(std::istream* is);
+
+    // Read the next universe
+    VariantUniverseInput operator()();
+
+    //! Tolerance for construction and transport
+    Tolerance<> const& tol() const { return tol_; }
+
+    //! Total number of universes in the stream
+    size_type num_universes() const { return num_universes_; }
+
+    //! Whether all universes have been read
+    bool finished() const { return num_read_ == num_universes_; }
+
+  private:
+    std::istream* is_;
+    Tolerance<> tol_;
+    size_type num_universes_{};
+    size_type num_read_{0};
+};
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+
+// Write a complete ORANGE input to a binary stream
+void write_binary(std::ostream& os, OrangeInput const& inp);
+
+// Read a complete ORANGE input from a binary stream
+OrangeInput read_binary(std::istream& is);
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
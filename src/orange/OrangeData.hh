@@ -206,6 +206,38 @@ struct TransformRecord
     }
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Precomputed lower bound on the safety distance inside a unit.
+ *
+ * The safety is stored on the nodes of a regular grid that spans the unit's
+ * bounding box. Each node value is the safety distance of the volume
+ * enclosing the node (zero if the node is on a surface or in a volume without
+ * a simple safety calculation). The values are indexed as a C-ordered
+ * \c [x][y][z] array.
+ *
+ * Because the safety distance changes by at most the distance moved, a
+ * trilinearly interpolated value less the voxel diagonal is a conservative
+ * lower bound on the safety of any point inside the grid.
+ */
+struct SafetyGridRecord
+{
+    using Dims = Array<size_type, 3>;
+
+    Real3 origin{};  //!< Position of the first node
+    Real3 inv_delta{};  //!< Inverse of the node spacing along each axis
+    Dims dims{};  //!< Number of nodes along each axis
+    real_type diagonal{};  //!< Length of a voxel diagonal
+    ItemRange<real_type> values;  //!< Safety distance at each node
+
+    //! True if a grid is present
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return diagonal > 0
+               && values.size() == dims[0] * dims[1] * dims[2];
+    }
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Scalar data for a single "unit" of volumes defined by surfaces.
@@ -227,6 +259,9 @@ struct SimpleUnitRecord
     LocalVolumeId background{};  //!< Default if not in any other volume
     bool simple_safety{};
 
+    // Optional precomputed safety distances
+    SafetyGridRecord safety_grid;
+
     //! True if defined
     explicit CELER_FUNCTION operator bool() const
     {
@@ -7,10 +7,13 @@
 //---------------------------------------------------------------------------//
 #include "OrangeParams.hh"
 
+#include <cstddef>
+#include <cstdlib>
 #include <fstream>
 #include <initializer_list>
 #include <limits>
 #include <numeric>
+#include <string>
 #include <utility>
 #include <vector>
 #include <nlohmann/json.hpp>
@@ -26,11 +29,14 @@
 #include "corecel/io/Logger.hh"
 #include "corecel/io/ScopedTimeLog.hh"
 #include "corecel/io/StringUtils.hh"
+#include "corecel/sys/Environment.hh"
 #include "corecel/sys/ScopedMem.hh"
 #include "corecel/sys/ScopedProfiling.hh"
+#include "corecel/sys/Stopwatch.hh"
 #include "geocel/BoundingBox.hh"
 #include "geocel/GeantGeoUtils.hh"
 
+#include "OrangeBinaryIO.hh"
 #include "OrangeData.hh"  // IWYU pragma: associated
 #include "OrangeInput.hh"
 #include "OrangeInputIO.json.hh"
@@ -40,6 +46,7 @@
 
 #include "detail/DepthCalculator.hh"
 #include "detail/RectArrayInserter.hh"
+#include "detail/SafetyGridBuilder.hh"
 #include "detail/UnitInserter.hh"
 #include "detail/UniverseInserter.hh"
 
@@ -69,20 +76,41 @@ OrangeInput input_from_json(std::string filename)
 
 //---------------------------------------------------------------------------//
 /*!
- * Load a geometry from the given filename.
+ * Load a geometry from the given binary file.
  */
-OrangeInput input_from_file(std::string filename)
+OrangeInput input_from_binary(std::string const& filename)
 {
+    CELER_LOG(info) << "Loading ORANGE geometry from binary at " << filename;
+    ScopedTimeLog scoped_time;
+
+    std::ifstream infile(filename, std::ios::in | std::ios::binary);
+    CELER_VALIDATE(infile,
+                   << "failed to open geometry at '" << filename << '\'');
+    return read_binary(infile);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Load a geometry from the given filename, saving the time of each phase.
+ */
+OrangeInput
+input_from_file(std::string filename, OrangeParams::MapStrReal* times)
+{
+    CELER_EXPECT(times);
+
     if (ends_with(filename, ".gdml"))
     {
         if (CELERITAS_USE_GEANT4
             && CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE)
         {
             // Load with Geant4: must *not* be using run manager
+            Stopwatch get_time;
             auto* world = ::celeritas::load_geant_geometry_native(filename);
-            auto result = g4org::Converter{}(world).input;
+            (*times)["load_gdml"] = get_time();
+            auto result = g4org::Converter{}(world);
             ::celeritas::reset_geant_geometry();
-            return result;
+            times->insert(result.times.begin(), result.times.end());
+            return std::move(result.input);
         }
         else
         {
@@ -93,13 +121,103 @@ OrangeInput input_from_file(std::string filename)
             filename += ".org.json";
         }
     }
+    else if (ends_with(filename, ".bin"))
+    {
+        Stopwatch get_time;
+        auto result = input_from_binary(filename);
+        (*times)["load_binary"] = get_time();
+        return result;
+    }
     else
     {
         CELER_VALIDATE(ends_with(filename, ".json"),
                        << "expected JSON extension for ORANGE input '"
                        << filename << "'");
     }
-    return input_from_json(std::move(filename));
+    Stopwatch get_time;
+    auto result = input_from_json(std::move(filename));
+    (*times)["load_json"] = get_time();
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Parse a nonnegative real number from an environment variable.
+ */
+double nonnegative_from_env(char const* name, std::string const& var)
+{
+    char* end = nullptr;
+    double result = std::strtod(var.c_str(), &end);
+    CELER_VALIDATE(end != var.c_str() && *end == '\0',
+                   << "invalid " << name << "='" << var
+                   << "' (expected a number)");
+    CELER_VALIDATE(result >= 0,
+                   << "invalid " << name << "=" << result
+                   << " (must be nonnegative)");
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get safety grid options from the environment.
+ *
+ * \c ORANGE_SAFETY_GRID is the memory budget per unit in MiB, and
+ * \c ORANGE_SAFETY_SPACING is the target node spacing in native units.
+ */
+detail::SafetyGridBuilder::Options safety_grid_options()
+{
+    detail::SafetyGridBuilder::Options result;
+    if (std::string var = celeritas::getenv("ORANGE_SAFETY_GRID"); !var.empty())
+    {
+        double mib = nonnegative_from_env("ORANGE_SAFETY_GRID", var);
+        result.max_memory = static_cast<std::size_t>(mib * 1024 * 1024);
+    }
+    if (std::string var = celeritas::getenv("ORANGE_SAFETY_SPACING");
+        !var.empty())
+    {
+        result.spacing = nonnegative_from_env("ORANGE_SAFETY_SPACING", var);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Precompute safety distances for each unit, returning the memory used.
+ */
+std::size_t insert_safety_grids(detail::SafetyGridBuilder::Options const& opts,
+                                std::vector<BBox> const& unit_bboxes,
+                                HostVal<OrangeParamsData>* data)
+{
+    CELER_EXPECT(unit_bboxes.size() == data->simple_units.size());
+
+    // Calculate using the completed unit data
+    std::vector<detail::SafetyGridBuilder::Result> grids(unit_bboxes.size());
+    {
+        HostCRef<OrangeParamsData> ref;
+        ref = *data;
+        detail::SafetyGridBuilder build_grid{ref, opts};
+        for (auto i : range(unit_bboxes.size()))
+        {
+            grids[i] = build_grid(SimpleUnitId(i), unit_bboxes[i]);
+        }
+    }
+
+    // Insert node values
+    auto reals = make_builder(&data->reals);
+    std::size_t result{0};
+    for (auto i : range(grids.size()))
+    {
+        if (!grids[i])
+        {
+            continue;
+        }
+        auto const& values = grids[i].values;
+        SafetyGridRecord grid = grids[i].grid;
+        grid.values = reals.insert_back(values.begin(), values.end());
+        data->simple_units[SimpleUnitId(i)].safety_grid = grid;
+        result += values.size() * sizeof(real_type);
+    }
+    return result;
 }
 
 //---------------------------------------------------------------------------//
@@ -110,11 +228,13 @@ OrangeInput input_from_file(std::string filename)
  * Construct from a JSON file (if JSON is enabled).
  *
  * The JSON format is defined by the SCALE ORANGE exporter (not currently
- * distributed).
+ * distributed). A file ending in \c .bin is read as ORANGE binary input
+ * (see \c OrangeBinaryReader ), and a GDML file is converted through Geant4
+ * if available.
  */
 OrangeParams::OrangeParams(std::string const& filename)
-    : OrangeParams(input_from_file(filename))
 {
+    this->build_runtime(input_from_file(filename, &times_));
 }
 
 //---------------------------------------------------------------------------//
@@ -124,8 +244,10 @@ OrangeParams::OrangeParams(std::string const& filename)
  * TODO: expose options? Fix volume mappings?
  */
 OrangeParams::OrangeParams(G4VPhysicalVolume const* world)
-    : OrangeParams(std::move(g4org::Converter{}(world).input))
 {
+    auto result = g4org::Converter{}(world);
+    times_ = std::move(result.times);
+    this->build_runtime(std::move(result.input));
 }
 
 //---------------------------------------------------------------------------//
@@ -135,6 +257,15 @@ OrangeParams::OrangeParams(G4VPhysicalVolume const* world)
  * Volume and surface labels must be unique for the time being.
  */
 OrangeParams::OrangeParams(OrangeInput&& input)
+{
+    this->build_runtime(std::move(input));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct runtime data from the input.
+ */
+void OrangeParams::build_runtime(OrangeInput&& input)
 {
     CELER_VALIDATE(input, << "input geometry is incomplete");
 
@@ -143,6 +274,7 @@ OrangeParams::OrangeParams(OrangeInput&& input)
     CELER_LOG(debug) << "Merging runtime data"
                      << (celeritas::device() ? " and copying to GPU" : "");
     ScopedTimeLog scoped_time;
+    Stopwatch get_time;
 
     // Save global bounding box
     bbox_ = [&input] {
@@ -157,6 +289,16 @@ OrangeParams::OrangeParams(OrangeInput&& input)
     host_data.scalars.tol = input.tol;
     host_data.scalars.max_depth = detail::DepthCalculator{input.universes}();
 
+    // Save unit bounding boxes for precomputing safety
+    std::vector<BBox> unit_bboxes;
+    for (auto const& u : input.universes)
+    {
+        if (auto* unit = std::get_if<UnitInput>(&u))
+        {
+            unit_bboxes.push_back(unit->bbox);
+        }
+    }
+
     // Insert all universes
     {
         std::vector<Label> universe_labels;
@@ -198,10 +340,22 @@ OrangeParams::OrangeParams(OrangeInput&& input)
                       "stack is limited to a depth of "
                    << detail::LogicStack::max_stack_depth());
 
+    if (auto opts = safety_grid_options())
+    {
+        Stopwatch get_grid_time;
+        auto bytes = insert_safety_grids(opts, unit_bboxes, &host_data);
+        times_["safety_grid"] = get_grid_time();
+        CELER_LOG(debug) << "Precomputed safety grids using "
+                         << bytes / (1024.0 * 1024.0) << " MiB in "
+                         << times_["safety_grid"] << " s";
+    }
+
     // Construct device values and device/host references
     CELER_ASSERT(host_data);
     data_ = CollectionMirror<OrangeParamsData>{std::move(host_data)};
 
+    times_["build_runtime"] = get_time();
+
     CELER_ENSURE(surf_labels_ && univ_labels_ && vol_labels_);
     CELER_ENSURE(data_);
     CELER_ENSURE(vol_labels_.size() > 0);
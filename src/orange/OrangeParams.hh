@@ -8,6 +8,7 @@
 #pragma once
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "corecel/Types.hh"
@@ -42,10 +43,11 @@ class OrangeParams final : public GeoParamsSurfaceInterface,
     //! \name Type aliases
     using SurfaceMap = LabelIdMultiMap<SurfaceId>;
     using UniverseMap = LabelIdMultiMap<UniverseId>;
+    using MapStrReal = std::unordered_map<std::string, real_type>;
     //!@}
 
   public:
-    // Construct from a JSON or GDML file (if JSON or Geant4 are enabled)
+    // Construct from a JSON, binary, or GDML file
     explicit OrangeParams(std::string const& filename);
 
     // Construct in-memory from Geant4
@@ -63,6 +65,9 @@ class OrangeParams final : public GeoParamsSurfaceInterface,
     //! Maximum universe depth
     size_type max_depth() const { return this->host_ref().scalars.max_depth; }
 
+    //! Wall time [s] spent in each phase of construction
+    MapStrReal const& times() const { return times_; }
+
     //// LABELS AND MAPPING ////
 
     // Get surface metadata
@@ -118,9 +123,13 @@ class OrangeParams final : public GeoParamsSurfaceInterface,
     VolumeMap vol_labels_;
     BBox bbox_;
     bool supports_safety_{};
+    MapStrReal times_;
 
     // Host/device storage and reference
     CollectionMirror<OrangeParamsData> data_;
+
+    // Construct runtime data from the input
+    void build_runtime(OrangeInput&& input);
 };
 
 //---------------------------------------------------------------------------//
@@ -73,6 +73,16 @@ void OrangeParamsOutput::output(JsonPimpl* j) const
         OPO_SAVE_SIZE(daughters);
 #undef OPO_SAVE_SIZE
 
+        // Save number of precomputed safety distances
+        sizes["safety_grid"] = [&units = data.simple_units] {
+            size_type result{0};
+            for (auto const& su : units[AllItems<SimpleUnitRecord>()])
+            {
+                result += su.safety_grid.values.size();
+            }
+            return result;
+        }();
+
         // Save BIH sizes
         sizes["bih"] = [&bihdata = data.bih_tree_data] {
             auto bih = json::object();
@@ -88,6 +98,9 @@ void OrangeParamsOutput::output(JsonPimpl* j) const
         return sizes;
     }();
 
+    // Save construction time for each phase
+    obj["time"] = orange_->times();
+
     //! \todo Make universe metadata accessible from ORANGE, and write it
 
     j->obj = std::move(obj);
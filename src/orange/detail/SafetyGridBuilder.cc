@@ -0,0 +1,160 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/SafetyGridBuilder.cc
+//---------------------------------------------------------------------------//
+#include "SafetyGridBuilder.hh"
+
+#include <algorithm>
+#include <cmath>
+
+#include "corecel/Config.hh"
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/math/ArrayUtils.hh"
+#include "orange/BoundingBoxUtils.hh"
+#include "orange/univ/SimpleUnitTracker.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Number of nodes needed along each axis for a given spacing
+SafetyGridRecord::Dims calc_dims(Real3 const& width, real_type spacing)
+{
+    SafetyGridRecord::Dims result;
+    for (auto ax : range(3))
+    {
+        result[ax] = static_cast<size_type>(
+                         std::ceil(width[ax] / spacing - real_type(1e-8)))
+                     + 1;
+        result[ax] = std::max<size_type>(result[ax], 2);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+//! Total number of nodes without overflowing
+double calc_num_nodes(SafetyGridRecord::Dims const& dims)
+{
+    return static_cast<double>(dims[0]) * static_cast<double>(dims[1])
+           * static_cast<double>(dims[2]);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with ORANGE data and grid options.
+ */
+SafetyGridBuilder::SafetyGridBuilder(HostRef const& params,
+                                     Options const& opts)
+    : params_{params}, opts_{opts}
+{
+    CELER_EXPECT(params_);
+    CELER_EXPECT(opts_);
+    CELER_EXPECT(opts_.spacing >= 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Build a grid for a unit, returning an empty result if not possible.
+ */
+auto SafetyGridBuilder::operator()(SimpleUnitId id, BBox const& bbox) const
+    -> Result
+{
+    CELER_EXPECT(id < params_.simple_units.size());
+
+    if (!bbox || !is_finite(bbox) || is_degenerate(bbox))
+    {
+        return {};
+    }
+    double const max_nodes = static_cast<double>(
+        opts_.max_memory / sizeof(real_type));
+    if (max_nodes < 8)
+    {
+        return {};
+    }
+
+    // Choose the node spacing: start from the spacing that exactly fills the
+    // budget and coarsen until the rounded-up node counts fit
+    Real3 width;
+    for (auto ax : range(3))
+    {
+        width[ax] = bbox.upper()[ax] - bbox.lower()[ax];
+    }
+    real_type spacing = std::cbrt(width[0] * width[1] * width[2] / max_nodes);
+    spacing = std::max(spacing, opts_.spacing);
+    SafetyGridRecord::Dims dims = calc_dims(width, spacing);
+    while (calc_num_nodes(dims) > max_nodes)
+    {
+        spacing *= real_type(1.05);
+        dims = calc_dims(width, spacing);
+    }
+
+    Result result;
+    SafetyGridRecord& grid = result.grid;
+    grid.origin = bbox.lower();
+    Real3 delta;
+    for (auto ax : range(3))
+    {
+        grid.dims[ax] = dims[ax];
+        delta[ax] = width[ax] / static_cast<real_type>(dims[ax] - 1);
+        grid.inv_delta[ax] = 1 / delta[ax];
+    }
+    grid.diagonal = norm(delta);
+
+    // Calculate safety at each node
+    real_type const max_safety = norm(width);
+    SimpleUnitTracker const tracker{params_, id};
+    LocalVolumeId const background = params_.simple_units[id].background;
+    size_type const stride_y = dims[2];
+    size_type const stride_x = dims[1] * stride_y;
+    result.values.resize(dims[0] * stride_x);
+
+    // Each slab of nodes needs its own temporary sense storage
+#if CELERITAS_USE_OPENMP
+#    pragma omp parallel for schedule(dynamic)
+#endif
+    for (size_type i = 0; i < dims[0]; ++i)
+    {
+        std::vector<Sense> temp_sense(params_.scalars.max_faces);
+        LocalState state;
+        state.dir = {0, 0, 1};
+        state.temp_sense = make_span(temp_sense);
+        state.pos[0] = grid.origin[0] + i * delta[0];
+        for (auto j : range(dims[1]))
+        {
+            state.pos[1] = grid.origin[1] + j * delta[1];
+            for (auto k : range(dims[2]))
+            {
+                state.pos[2] = grid.origin[2] + k * delta[2];
+                LocalVolumeId vol = tracker.initialize(state).volume;
+                real_type safety = 0;
+                if (vol && vol != background)
+                {
+                    // The face safety is infinite at degenerate points such
+                    // as a sphere center: use zero to stay conservative
+                    safety = tracker.safety(state.pos, vol);
+                    safety = std::isinf(safety) ? 0
+                                                : std::min(safety, max_safety);
+                }
+                result.values[i * stride_x + j * stride_y + k] = safety;
+            }
+        }
+    }
+
+    CELER_ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,83 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/SafetyGridBuilder.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "corecel/Types.hh"
+#include "geocel/BoundingBox.hh"
+
+#include "../OrangeData.hh"
+#include "../OrangeTypes.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate safety distances on a regular grid spanning a simple unit.
+ *
+ * The grid covers the given bounding box (which must be finite) with the
+ * requested node spacing, coarsened if needed to fit in the memory budget. If
+ * no spacing is requested, the finest grid that fits is used. Each node is
+ * located with the unit tracker and assigned the exact safety of its volume.
+ * Nodes on a surface, outside all volumes, or in the background volume are
+ * assigned zero. Safeties are capped at the bounding box diagonal so that
+ * interpolation weights never multiply an infinite value.
+ *
+ * The resulting grid record's \c values range is unset: the caller is
+ * responsible for inserting the values into the parameter data.
+ */
+class SafetyGridBuilder
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using HostRef = HostCRef<OrangeParamsData>;
+    using VecReal = std::vector<real_type>;
+    //!@}
+
+    //! Resolution of the grid
+    struct Options
+    {
+        //! Maximum memory per unit [bytes]
+        std::size_t max_memory{0};
+        //! Target node spacing, or zero to use the full memory budget
+        real_type spacing{0};
+
+        //! True if grids should be built
+        explicit operator bool() const { return max_memory > 0; }
+    };
+
+    //! Grid metadata and node values
+    struct Result
+    {
+        SafetyGridRecord grid;
+        VecReal values;
+
+        //! True if a grid was built
+        explicit operator bool() const { return !values.empty(); }
+    };
+
+  public:
+    // Construct with ORANGE data and grid options
+    SafetyGridBuilder(HostRef const& params, Options const& opts);
+
+    // Build a grid for a unit, returning an empty result if not possible
+    Result operator()(SimpleUnitId id, BBox const& bbox) const;
+
+  private:
+    HostRef const& params_;
+    Options opts_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -8,6 +8,7 @@
 #include "Converter.hh"
 
 #include "corecel/io/Logger.hh"
+#include "corecel/sys/Stopwatch.hh"
 #include "geocel/detail/LengthUnits.hh"
 #include "orange/orangeinp/InputBuilder.hh"
 
@@ -50,19 +51,25 @@ auto Converter::operator()(arg_type g4world) -> result_type
 
     using orangeinp::InputBuilder;
 
+    result_type result;
+
     // Convert solids, logical volumes, physical volumes
+    Stopwatch get_time;
     PhysicalVolumeConverter::Options options;
     options.verbose = opts_.verbose;
     PhysicalVolumeConverter convert_pv(std::move(options));
     PhysicalVolume world = convert_pv(*g4world);
     CELER_VALIDATE(std::holds_alternative<NoTransformation>(world.transform),
                    << "world volume should not have a transformation");
+    result.times["convert_geant"] = get_time();
 
     // Convert logical volumes into protos
+    get_time = {};
     auto global_proto = ProtoConstructor{opts_.verbose}(*world.lv);
+    result.times["construct_protos"] = get_time();
 
     // Build universes from protos
-    result_type result;
+    get_time = {};
     InputBuilder build_input([&opts = opts_] {
         InputBuilder::Options ibo;
         ibo.tol = opts.tol;
@@ -71,6 +78,7 @@ auto Converter::operator()(arg_type g4world) -> result_type
         return ibo;
     }());
     result.input = build_input(*global_proto);
+    result.times["build_input"] = get_time();
     return result;
 }
 
@@ -9,6 +9,7 @@
 
 #include <functional>
 #include <memory>
+#include <string>
 #include <unordered_map>
 
 #include "corecel/Config.hh"
@@ -54,6 +55,7 @@ class Converter
     //! \name Type aliases
     using arg_type = G4VPhysicalVolume const*;
     using MapLvVolId = std::unordered_map<G4LogicalVolume const*, VolumeId>;
+    using MapStrReal = std::unordered_map<std::string, real_type>;
     //!@}
 
     //! Input options for the conversion
@@ -73,6 +75,7 @@ class Converter
     {
         OrangeInput input;
         MapLvVolId volumes;  //! TODO
+        MapStrReal times;  //!< Wall time [s] of each conversion phase
     };
 
   public:
@@ -7,13 +7,20 @@
 //---------------------------------------------------------------------------//
 #include "PhysicalVolumeConverter.hh"
 
+#include <algorithm>
+#include <cmath>
 #include <deque>
 #include <iomanip>
 #include <iostream>
+#include <optional>
+#include <unordered_map>
 #include <unordered_set>
+#include <G4Box.hh>
 #include <G4LogicalVolume.hh>
 #include <G4PVPlacement.hh>
+#include <G4PVReplica.hh>
 #include <G4ReflectionFactory.hh>
+#include <G4ReplicaNavigation.hh>
 #include <G4VPVParameterisation.hh>
 #include <G4VPhysicalVolume.hh>
 
@@ -21,10 +28,13 @@
 #include "corecel/io/Logger.hh"
 #include "corecel/io/ScopedTimeLog.hh"
 #include "corecel/io/StreamableVariant.hh"
+#include "corecel/math/ArrayOperators.hh"
+#include "corecel/math/SoftEqual.hh"
 #include "corecel/sys/ScopedMem.hh"
 #include "corecel/sys/ScopedProfiling.hh"
 #include "corecel/sys/TypeDemangler.hh"
 #include "geocel/GeantGeoUtils.hh"
+#include "orange/BoundingBoxUtils.hh"
 #include "orange/transform/TransformIO.hh"
 
 #include "LogicalVolumeConverter.hh"
@@ -36,6 +46,62 @@ namespace celeritas
 {
 namespace g4org
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Minimum number of copies of a volume to convert into a lattice
+constexpr std::size_t lattice_threshold{8};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the bounding box of a logical volume in its local reference frame.
+ */
+BBox calc_bbox(Scaler const& scale, G4LogicalVolume const& g4lv)
+{
+    G4ThreeVector lower;
+    G4ThreeVector upper;
+    g4lv.GetSolid()->BoundingLimits(lower, upper);
+    return BBox{scale(lower), scale(upper)};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the translation of a transform if it has no rotation.
+ */
+std::optional<Real3> get_translation(VariantTransform const& transform)
+{
+    if (std::holds_alternative<NoTransformation>(transform))
+    {
+        return Real3{0, 0, 0};
+    }
+    if (auto* t = std::get_if<Translation>(&transform))
+    {
+        return t->translation();
+    }
+    return std::nullopt;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether a replica is sliced along a Cartesian axis.
+ *
+ * Replicas along radial and azimuthal axes change the shape of each copy and
+ * are not supported.
+ */
+bool is_cartesian_replica(G4VPhysicalVolume const& g4pv)
+{
+    EAxis axis{kUndefined};
+    G4int num_replicas{};
+    G4double width{};
+    G4double offset{};
+    G4bool consuming{};
+    g4pv.GetReplicationData(axis, num_replicas, width, offset, consuming);
+    return axis == kXAxis || axis == kYAxis || axis == kZAxis;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
 //---------------------------------------------------------------------------//
 struct PhysicalVolumeConverter::Data
 {
@@ -62,6 +128,7 @@ struct PhysicalVolumeConverter::Builder
 
     Data* data;
     std::deque<QueuedDaughter> child_queue;
+    std::vector<std::shared_ptr<LogicalVolume>> converted;
 
     // Convert a physical volume, queuing children if needed
     PhysicalVolume make_pv(int depth, G4VPhysicalVolume const& pv);
@@ -72,6 +139,14 @@ struct PhysicalVolumeConverter::Builder
 
     // Build all children in the queue
     void build_children();
+
+    // Replace copies on a regular grid with a lattice
+    void make_lattices(LogicalVolume* lv);
+
+    // Try to construct a lattice from copies of the same volume
+    std::optional<PhysicalVolume>
+    make_lattice(LogicalVolume const& lv,
+                 std::vector<size_type> const& indices) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -102,9 +177,13 @@ auto PhysicalVolumeConverter::operator()(arg_type g4world) -> result_type
     ScopedTimeLog scoped_time;
 
     // Construct world volume
-    Builder impl{data_.get(), {}};
+    Builder impl{data_.get(), {}, {}};
     auto world = impl.make_pv(0, g4world);
     impl.build_children();
+    for (auto const& lv : impl.converted)
+    {
+        impl.make_lattices(lv.get());
+    }
     return world;
 }
 
@@ -161,6 +240,7 @@ PhysicalVolumeConverter::Builder::make_pv(int depth,
                       << StreamableVariant{result.transform} << std::endl;
         }
         // Queue up children for construction
+        converted.push_back(lv);
         auto num_children = g4lv->GetNoDaughters();
         lv->children.reserve(num_children);
         for (auto i : range(num_children))
@@ -206,8 +286,29 @@ void PhysicalVolumeConverter::Builder::place_child(
             param->ComputeTransformation(
                 j, const_cast<G4VPhysicalVolume*>(&g4pv));
 
-            // Add a copy
+            // Add a copy, numbered as the navigator does
+            lv->children.push_back(this->make_pv(depth, g4pv));
+            lv->children.back().copy_number = j;
+        }
+    }
+    else if (dynamic_cast<G4PVReplica const*>(&g4pv)
+             && is_cartesian_replica(g4pv))
+    {
+        if (CELER_UNLIKELY(data->verbose))
+        {
+            CELER_LOG(debug)
+                << "Processing replicated volume " << g4pv.GetName()
+                << " with " << g4pv.GetMultiplicity() << " instances";
+        }
+
+        // Place each copy the same way the Geant4 navigator does
+        G4ReplicaNavigation replica_nav;
+        for (auto j : range(g4pv.GetMultiplicity()))
+        {
+            replica_nav.ComputeTransformation(
+                j, const_cast<G4VPhysicalVolume*>(&g4pv));
             lv->children.push_back(this->make_pv(depth, g4pv));
+            lv->children.back().copy_number = j;
         }
     }
     else
@@ -239,6 +340,263 @@ void PhysicalVolumeConverter::Builder::build_children()
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Replace copies on a regular grid with a lattice.
+ *
+ * Replicas, parameterisations, and repeated placements of a single logical
+ * volume are all converted to individual placements by \c place_child . This
+ * groups the unrotated copies of each logical volume and replaces each group
+ * that forms a complete, uniformly spaced grid with a single lattice, which
+ * is constructed as a rectilinear array universe with a single cell
+ * definition.
+ *
+ * Every cell shares the same volumes, so the copy number of each merged
+ * placement is saved on the lattice to identify its touchable.
+ */
+void PhysicalVolumeConverter::Builder::make_lattices(LogicalVolume* lv)
+{
+    CELER_EXPECT(lv);
+    auto& children = lv->children;
+    if (children.size() < lattice_threshold
+        || !dynamic_cast<G4Box const*>(lv->g4lv->GetSolid()))
+    {
+        // Only arrays of many elements inside a box are converted, since the
+        // outer cells of the array are extended to its boundaries
+        return;
+    }
+
+    // Group copies by logical volume, preserving the placement order
+    std::vector<LogicalVolume const*> child_lvs;
+    std::unordered_map<LogicalVolume const*, std::vector<size_type>> groups;
+    for (auto i : range(children.size()))
+    {
+        auto&& [iter, inserted]
+            = groups.insert({children[i].lv.get(), std::vector<size_type>{}});
+        if (inserted)
+        {
+            child_lvs.push_back(children[i].lv.get());
+        }
+        iter->second.push_back(i);
+    }
+
+    std::vector<bool> replaced(children.size(), false);
+    std::vector<PhysicalVolume> lattices;
+    for (auto const* child_lv : child_lvs)
+    {
+        auto const& indices = groups[child_lv];
+        if (indices.size() < lattice_threshold)
+        {
+            continue;
+        }
+        if (auto lattice = this->make_lattice(*lv, indices))
+        {
+            if (CELER_UNLIKELY(data->verbose))
+            {
+                CELER_LOG(debug)
+                    << "Converted " << indices.size() << " copies of "
+                    << child_lv->name << " in " << lv->name
+                    << " to a lattice";
+            }
+            for (auto i : indices)
+            {
+                replaced[i] = true;
+            }
+            lattices.push_back(std::move(*lattice));
+        }
+    }
+    if (lattices.empty())
+    {
+        return;
+    }
+
+    // Replace the grouped copies with the lattices
+    std::vector<PhysicalVolume> remaining;
+    remaining.reserve(children.size());
+    for (auto i : range(children.size()))
+    {
+        if (!replaced[i])
+        {
+            remaining.push_back(std::move(children[i]));
+        }
+    }
+    std::move(lattices.begin(), lattices.end(), std::back_inserter(remaining));
+    children = std::move(remaining);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Try to construct a lattice from copies of the same volume.
+ *
+ * The copies must be unrotated, and their translations must form a complete
+ * grid with uniform spacing along each axis. Each copy must fit inside its
+ * cell, and the array must be inside the parent and must not overlap any
+ * other daughter.
+ */
+std::optional<PhysicalVolume> PhysicalVolumeConverter::Builder::make_lattice(
+    LogicalVolume const& lv, std::vector<size_type> const& indices) const
+{
+    CELER_EXPECT(!indices.empty());
+    auto const& children = lv.children;
+    auto const& child_lv = *children[indices.front()].lv;
+    SoftEqual<real_type> soft_eq{1e-8};
+
+    // Get the position of each copy
+    std::vector<Real3> centers;
+    centers.reserve(indices.size());
+    for (auto i : indices)
+    {
+        auto t = get_translation(children[i].transform);
+        if (!t)
+        {
+            return std::nullopt;
+        }
+        centers.push_back(*t);
+    }
+
+    // Find unique coordinates along each axis
+    Array<std::vector<real_type>, 3> coords;
+    std::size_t num_cells = 1;
+    for (auto ax : range(to_int(Axis::size_)))
+    {
+        auto& c = coords[ax];
+        for (auto const& pos : centers)
+        {
+            c.push_back(pos[ax]);
+        }
+        std::sort(c.begin(), c.end());
+        c.erase(std::unique(c.begin(), c.end(), soft_eq), c.end());
+        num_cells *= c.size();
+    }
+    if (num_cells != centers.size())
+    {
+        return std::nullopt;
+    }
+
+    // Construct cells around uniformly spaced coordinates
+    BBox const child_bbox = calc_bbox(data->scale, *child_lv.g4lv);
+    Lattice lattice;
+    lattice.parent = &lv;
+    Real3 offset{0, 0, 0};
+    Real3 pitch{0, 0, 0};
+    for (auto ax : range(to_int(Axis::size_)))
+    {
+        auto const& c = coords[ax];
+        real_type const lo = child_bbox.lower()[ax];
+        real_type const hi = child_bbox.upper()[ax];
+        auto& edges = lattice.grid[ax];
+        if (c.size() == 1)
+        {
+            // Cell is the extent of the child along this axis
+            edges = {c.front() + lo, c.front() + hi};
+            offset[ax] = -(lo + hi) / 2;
+            continue;
+        }
+
+        pitch[ax] = (c.back() - c.front()) / (c.size() - 1);
+        for (auto i : range(c.size()))
+        {
+            if (!soft_eq(c.front() + i * pitch[ax], c[i]))
+            {
+                return std::nullopt;
+            }
+        }
+        if (lo < -pitch[ax] / 2 && !soft_eq(lo, -pitch[ax] / 2))
+        {
+            return std::nullopt;
+        }
+        if (hi > pitch[ax] / 2 && !soft_eq(hi, pitch[ax] / 2))
+        {
+            return std::nullopt;
+        }
+        for (auto i : range(c.size() + 1))
+        {
+            edges.push_back(c.front() + (i - real_type(0.5)) * pitch[ax]);
+        }
+    }
+
+    // Check that every cell is occupied exactly once, saving its copy number
+    std::vector<bool> occupied(num_cells, false);
+    lattice.copy_numbers.resize(num_cells);
+    for (auto i : range(centers.size()))
+    {
+        auto const& pos = centers[i];
+        std::size_t cell = 0;
+        for (auto ax : range(to_int(Axis::size_)))
+        {
+            std::size_t idx = 0;
+            if (pitch[ax] > 0)
+            {
+                idx = static_cast<std::size_t>(
+                    std::lround((pos[ax] - coords[ax].front()) / pitch[ax]));
+            }
+            cell = cell * coords[ax].size() + idx;
+        }
+        if (cell >= num_cells || occupied[cell])
+        {
+            return std::nullopt;
+        }
+        occupied[cell] = true;
+        lattice.copy_numbers[cell] = children[indices[i]].copy_number;
+    }
+
+    // Check that the array fits inside the parent
+    Real3 lower;
+    Real3 upper;
+    for (auto ax : range(to_int(Axis::size_)))
+    {
+        lower[ax] = lattice.grid[ax].front();
+        upper[ax] = lattice.grid[ax].back();
+    }
+    BBox const array_bbox{lower, upper};
+    BoundingBoxBumper<real_type> bump_bbox{Tolerance<>::from_relative(1e-8)};
+    if (!encloses(bump_bbox(calc_bbox(data->scale, *lv.g4lv)), array_bbox))
+    {
+        return std::nullopt;
+    }
+
+    // Check that other children don't overlap the array
+    std::vector<bool> in_group(children.size(), false);
+    for (auto i : indices)
+    {
+        in_group[i] = true;
+    }
+    for (auto i : range(children.size()))
+    {
+        if (in_group[i])
+        {
+            continue;
+        }
+        auto const& pv = children[i];
+        auto overlap = calc_intersection(
+            array_bbox,
+            apply_transform(pv.transform,
+                            calc_bbox(data->scale, *pv.lv->g4lv)));
+        auto widths = overlap.upper() - overlap.lower();
+        if (std::all_of(widths.begin(), widths.end(), [&](real_type w) {
+                return w > 0 && !soft_eq(w, 0);
+            }))
+        {
+            return std::nullopt;
+        }
+    }
+
+    PhysicalVolume result;
+    result.name = children[indices.front()].name;
+    result.copy_number = children[indices.front()].copy_number;
+    if (offset != Real3{0, 0, 0})
+    {
+        result.transform = Translation{offset};
+    }
+    else
+    {
+        result.transform = NoTransformation{};
+    }
+    result.lv = children[indices.front()].lv;
+    result.lattice = std::move(lattice);
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace g4org
 }  // namespace celeritas
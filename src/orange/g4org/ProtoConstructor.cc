@@ -9,9 +9,12 @@
 
 #include <iostream>
 
+#include "corecel/cont/Range.hh"
 #include "corecel/io/StreamableVariant.hh"
 #include "orange/orangeinp/CsgObject.hh"
 #include "orange/orangeinp/PolySolid.hh"
+#include "orange/orangeinp/RectArrayProto.hh"
+#include "orange/orangeinp/Shape.hh"
 #include "orange/orangeinp/Transformed.hh"
 #include "orange/transform/TransformIO.hh"
 
@@ -26,6 +29,28 @@ namespace
 //---------------------------------------------------------------------------//
 using SPConstObject = ProtoConstructor::SPConstObject;
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct the box spanned by a lattice in its parent's reference frame.
+ */
+SPConstObject make_lattice_interior(PhysicalVolume const& pv)
+{
+    CELER_EXPECT(pv.lattice);
+
+    Real3 half_width;
+    Real3 center;
+    for (auto ax : range(to_int(Axis::size_)))
+    {
+        auto const& edges = pv.lattice.grid[ax];
+        half_width[ax] = (edges.back() - edges.front()) / 2;
+        center[ax] = (edges.back() + edges.front()) / 2;
+    }
+    return orangeinp::Transformed::or_object(
+        std::make_shared<orangeinp::BoxShape>(pv.name + ".array",
+                                              orangeinp::Box{half_width}),
+        Translation{center});
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct an explicit "background" cell.
@@ -41,7 +66,9 @@ SPConstObject make_explicit_background(LogicalVolume const& lv,
     for (auto const& child_pv : lv.children)
     {
         children.push_back(
-            Transformed::or_object(child_pv.lv->solid, child_pv.transform));
+            child_pv.lattice ? make_lattice_interior(child_pv)
+                             : Transformed::or_object(child_pv.lv->solid,
+                                                      child_pv.transform));
     }
 
     SPConstObject interior;
@@ -144,6 +171,12 @@ void ProtoConstructor::place_pv(VariantTransform const& parent_transform,
 
     using namespace orangeinp;
 
+    if (pv.lattice)
+    {
+        this->place_lattice(parent_transform, pv, proto);
+        return;
+    }
+
     // Transform for this PV, whether as a "top level" volume or as a volume
     // that's subtracted from an inlined LV
     auto transform = apply_transform(parent_transform, pv.transform);
@@ -246,6 +279,67 @@ void ProtoConstructor::place_pv(VariantTransform const& parent_transform,
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Place a lattice of copies of a physical volume into the proto.
+ *
+ * Each cell of the lattice is a new universe bounded by the cell, with the
+ * physical volume placed inside it and the parent's material filling the
+ * remainder. The cells are then placed in a rectilinear array.
+ */
+void ProtoConstructor::place_lattice(VariantTransform const& parent_transform,
+                                     PhysicalVolume const& pv,
+                                     ProtoInput* proto)
+{
+    CELER_EXPECT(pv.lattice);
+
+    using namespace orangeinp;
+
+    auto const& grid = pv.lattice.grid;
+    auto const& parent = *pv.lattice.parent;
+
+    if (CELER_UNLIKELY(verbose_))
+    {
+        std::clog << std::string(depth_, ' ') << "- Add lattice of " << pv.name
+                  << " with " << grid[0].size() - 1 << 'x'
+                  << grid[1].size() - 1 << 'x' << grid[2].size() - 1
+                  << " cells to " << proto->label << std::endl;
+    }
+
+    // Build the universe for a single cell
+    ProtoInput cell;
+    cell.label = pv.lv->name + ".cell";
+    Real3 half_width;
+    for (auto ax : range(to_int(Axis::size_)))
+    {
+        half_width[ax] = (grid[ax][1] - grid[ax][0]) / 2;
+    }
+    cell.boundary.interior = std::make_shared<BoxShape>(std::string{cell.label},
+                                                        Box{half_width});
+    cell.background.fill = parent.material_id;
+    cell.background.label = Label::from_geant(parent.name);
+
+    PhysicalVolume cell_pv;
+    cell_pv.name = pv.name;
+    cell_pv.copy_number = pv.copy_number;
+    cell_pv.transform = pv.transform;
+    cell_pv.lv = pv.lv;
+
+    ++depth_;
+    this->place_pv(NoTransformation{}, cell_pv, &cell);
+    --depth_;
+
+    // Build the array and place it in the parent
+    RectArrayProto::Input array;
+    array.label = pv.name;
+    array.grid = grid;
+    array.fills = {std::make_shared<UnitProto>(std::move(cell))};
+    proto->daughters.push_back(
+        {std::make_shared<RectArrayProto>(std::move(array)),
+         parent_transform,
+         ZOrder::media});
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace g4org
 }  // namespace celeritas
@@ -29,6 +29,8 @@ namespace g4org
  * directly inserted into a \c UnitProto as volumes (specifically, the logical
  * volume becomes a \c UnitProto::MaterialInput), or a \c LogicalVolume is
  * turned into a \em new \c UnitProto that can be used in multiple locations.
+ * Lattices of physical volumes become a \c RectArrayProto whose cells are
+ * each filled with a \c UnitProto.
  */
 class ProtoConstructor
 {
@@ -58,6 +60,11 @@ class ProtoConstructor
                   PhysicalVolume const& pv,
                   ProtoInput* proto);
 
+    // Place a lattice of physical volumes into the given proto
+    void place_lattice(VariantTransform const& parent_transform,
+                       PhysicalVolume const& pv,
+                       ProtoInput* proto);
+
     // (TODO: make this configurable)
     //! Number of daughters above which we use a "fill" material
     static constexpr int fill_daughter_threshold() { return 2; }
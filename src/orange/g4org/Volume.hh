@@ -10,6 +10,7 @@
 #include <memory>
 #include <vector>
 
+#include "corecel/cont/Array.hh"
 #include "orange/OrangeTypes.hh"
 #include "orange/transform/VariantTransform.hh"
 
@@ -27,12 +28,35 @@ namespace g4org
 //---------------------------------------------------------------------------//
 struct LogicalVolume;
 
+//---------------------------------------------------------------------------//
+/*!
+ * A regular rectilinear array of copies of a logical volume.
+ *
+ * This is constructed from Geant4 replicas, divisions, parameterisations, and
+ * repeated placements whose copies lie on a uniform grid. The space in each
+ * cell that is not occupied by the copy is filled by the parent volume. Cells
+ * are indexed as [x][y][z], matching the rectilinear array daughters.
+ */
+struct Lattice
+{
+    //! Cell boundaries along each axis, in the parent reference frame
+    Array<std::vector<real_type>, 3> grid;
+    //! Volume that fills the remainder of each cell
+    LogicalVolume const* parent{nullptr};
+    //! Copy number of the placement in each cell
+    std::vector<size_type> copy_numbers;
+
+    //! Whether the volume is a lattice
+    explicit operator bool() const { return parent != nullptr; }
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * An unconstructed ORANGE CSG Object with a transform.
  *
  * This holds equivalent information to a Geant4 \c G4VPhysicalVolume, but with
- * \em only ORANGE data structures.
+ * \em only ORANGE data structures. If the volume is a lattice, the transform
+ * is relative to the center of each cell.
  */
 struct PhysicalVolume
 {
@@ -40,6 +64,7 @@ struct PhysicalVolume
     size_type copy_number{};
     VariantTransform transform;
     std::shared_ptr<LogicalVolume const> lv;
+    Lattice lattice;
 };
 
 //---------------------------------------------------------------------------//
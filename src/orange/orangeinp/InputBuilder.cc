@@ -7,13 +7,18 @@
 //---------------------------------------------------------------------------//
 #include "InputBuilder.hh"
 
+#include <algorithm>
 #include <fstream>
+#include <unordered_set>
 #include <nlohmann/json.hpp>
 
+#include "corecel/Config.hh"
+
 #include "corecel/cont/Range.hh"
 #include "corecel/io/JsonPimpl.hh"
 #include "corecel/io/Logger.hh"
 #include "corecel/io/ScopedTimeLog.hh"
+#include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ScopedMem.hh"
 #include "corecel/sys/ScopedProfiling.hh"
 
@@ -84,6 +89,59 @@ class JsonProtoOutput
     nlohmann::json output_;
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Group universes into levels that can be built concurrently.
+ *
+ * A universe's bounding box is determined by all the universes that place it,
+ * so it can be built only after all of its parents. Each level contains the
+ * universes whose parents are all in previous levels.
+ */
+std::vector<std::vector<UniverseId>>
+calc_build_levels(detail::ProtoMap const& protos)
+{
+    // Find the unique daughters of each universe
+    std::vector<std::vector<UniverseId>> daughters(protos.size());
+    std::vector<size_type> num_parents(protos.size(), 0);
+    for (auto uid : range(UniverseId{protos.size()}))
+    {
+        std::unordered_set<UniverseId> visited;
+        for (auto const* d : protos.at(uid)->daughters())
+        {
+            auto daughter_id = protos.find(d);
+            if (visited.insert(daughter_id).second)
+            {
+                daughters[uid.get()].push_back(daughter_id);
+                ++num_parents[daughter_id.get()];
+            }
+        }
+    }
+
+    std::vector<std::vector<UniverseId>> result;
+    std::vector<UniverseId> level{orange_global_universe};
+    size_type num_universes{0};
+    while (!level.empty())
+    {
+        std::vector<UniverseId> next_level;
+        for (auto uid : level)
+        {
+            for (auto daughter_id : daughters[uid.get()])
+            {
+                if (--num_parents[daughter_id.get()] == 0)
+                {
+                    next_level.push_back(daughter_id);
+                }
+            }
+        }
+        std::sort(next_level.begin(), next_level.end());
+        num_universes += level.size();
+        result.push_back(std::move(level));
+        level = std::move(next_level);
+    }
+    CELER_ENSURE(num_universes == protos.size());
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace
 
@@ -99,6 +157,9 @@ InputBuilder::InputBuilder(Options&& opts) : opts_{std::move(opts)}
 //---------------------------------------------------------------------------//
 /*!
  * Construct an ORANGE geometry.
+ *
+ * Universes whose parents have all been built are independent, so they are
+ * built in parallel when OpenMP is enabled.
  */
 auto InputBuilder::operator()(ProtoInterface const& global) const -> result_type
 {
@@ -128,9 +189,21 @@ auto InputBuilder::operator()(ProtoInterface const& global) const -> result_type
         }
         return pbopts;
     }());
-    for (auto uid : range(UniverseId{protos.size()}))
+    auto build_universe = [&protos, &builder](UniverseId uid) {
+        auto build_one = builder.for_universe(uid);
+        protos.at(uid)->build(build_one);
+    };
+    for (auto const& level : calc_build_levels(protos))
     {
-        protos.at(uid)->build(builder);
+        MultiExceptionHandler capture_exception;
+#if CELERITAS_USE_OPENMP
+#    pragma omp parallel for schedule(dynamic)
+#endif
+        for (size_type i = 0; i < level.size(); ++i)
+        {
+            CELER_TRY_HANDLE(build_universe(level[i]), capture_exception);
+        }
+        log_and_rethrow(std::move(capture_exception));
     }
 
     if (!opts_.debug_output_file.empty())
@@ -0,0 +1,195 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/orangeinp/RectArrayProto.cc
+//---------------------------------------------------------------------------//
+#include "RectArrayProto.hh"
+
+#include <unordered_set>
+#include <nlohmann/json.hpp>
+
+#include "corecel/cont/ArrayIO.json.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/io/JsonPimpl.hh"
+#include "corecel/math/ArrayOperators.hh"
+#include "orange/BoundingBoxUtils.hh"
+#include "orange/OrangeInput.hh"
+
+#include "ObjectIO.json.hh"
+#include "Shape.hh"
+#include "Transformed.hh"
+#include "detail/ProtoBuilder.hh"
+
+namespace celeritas
+{
+namespace orangeinp
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with required input data.
+ */
+RectArrayProto::RectArrayProto(Input&& inp) : input_{std::move(inp)}
+{
+    CELER_VALIDATE(input_, << "no fills or grid points are defined");
+
+    num_cells_ = 1;
+    for (auto ax : range(Axis::size_))
+    {
+        auto const& edges = input_.grid[to_int(ax)];
+        for (auto i : range(edges.size() - 1))
+        {
+            CELER_VALIDATE(edges[i] < edges[i + 1],
+                           << "grid for " << to_char(ax) << " axis in '"
+                           << input_.label
+                           << "' is not monotonically increasing");
+        }
+        num_cells_ *= edges.size() - 1;
+    }
+
+    CELER_VALIDATE(input_.fills.size() == 1
+                       || input_.fills.size() == num_cells_,
+                   << "number of fills (" << input_.fills.size() << ") in '"
+                   << input_.label << "' does not match number of cells ("
+                   << num_cells_ << ")");
+    CELER_VALIDATE(std::all_of(input_.fills.begin(),
+                               input_.fills.end(),
+                               [](SPConstProto const& p) {
+                                   return static_cast<bool>(p);
+                               }),
+                   << "missing fill in '" << input_.label << "'");
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Short unique name of this object.
+ */
+std::string_view RectArrayProto::label() const
+{
+    return input_.label;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the boundary of this universe as an object.
+ */
+auto RectArrayProto::interior() const -> SPConstObject
+{
+    Real3 half_width;
+    Real3 center;
+    for (auto ax : range(to_int(Axis::size_)))
+    {
+        auto const& edges = input_.grid[ax];
+        half_width[ax] = (edges.back() - edges.front()) / 2;
+        center[ax] = (edges.back() + edges.front()) / 2;
+    }
+
+    return Transformed::or_object(
+        std::make_shared<BoxShape>(std::string{input_.label}, Box{half_width}),
+        Translation{center});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a list of all unique daughters.
+ */
+auto RectArrayProto::daughters() const -> VecProto
+{
+    VecProto result;
+    std::unordered_set<ProtoInterface const*> visited;
+    for (auto const& p : input_.fills)
+    {
+        if (visited.insert(p.get()).second)
+        {
+            result.push_back(p.get());
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct a universe input from this object.
+ *
+ * Each fill is translated to the center of its cell, and its bounding box is
+ * expanded to include the cell.
+ */
+void RectArrayProto::build(ProtoBuilder& input) const
+{
+    CELER_VALIDATE(input.next_id() != orange_global_universe,
+                   << "rect array '" << input_.label
+                   << "' cannot be the global universe");
+
+    RectArrayInput result;
+    result.label = input_.label;
+    for (auto ax : range(to_int(Axis::size_)))
+    {
+        result.grid[ax].assign(input_.grid[ax].begin(),
+                               input_.grid[ax].end());
+    }
+
+    BoundingBoxBumper<real_type> bump_bbox{input.tol()};
+    auto const& grid = input_.grid;
+    result.daughters.reserve(num_cells_);
+    for (auto i : range(grid[0].size() - 1))
+    {
+        for (auto j : range(grid[1].size() - 1))
+        {
+            for (auto k : range(grid[2].size() - 1))
+            {
+                Real3 const lower{grid[0][i], grid[1][j], grid[2][k]};
+                Real3 const upper{
+                    grid[0][i + 1], grid[1][j + 1], grid[2][k + 1]};
+                Real3 center;
+                Real3 half_width;
+                for (auto ax : range(to_int(Axis::size_)))
+                {
+                    center[ax] = (upper[ax] + lower[ax]) / 2;
+                    half_width[ax] = (upper[ax] - lower[ax]) / 2;
+                }
+
+                auto const& fill = input_.fills.size() == 1
+                                       ? input_.fills.front()
+                                       : input_.fills[result.daughters.size()];
+                DaughterInput d;
+                d.universe_id = input.find_universe_id(fill.get());
+                d.transform = Translation{center};
+                result.daughters.push_back(std::move(d));
+
+                // Fill must cover the cell in its local reference frame
+                input.expand_bbox(result.daughters.back().universe_id,
+                                  bump_bbox(BBox{-half_width, half_width}));
+            }
+        }
+    }
+    CELER_ASSERT(result.daughters.size() == num_cells_);
+
+    input.insert(std::move(result));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write the proto to a JSON object.
+ */
+void RectArrayProto::output(JsonPimpl* j) const
+{
+    using json = nlohmann::json;
+
+    auto obj = json::object({{"label", input_.label}});
+    obj["grid"] = input_.grid;
+    obj["fills"] = [&fills = input_.fills] {
+        auto result = json::array();
+        for (auto const& p : fills)
+        {
+            result.push_back(p->label());
+        }
+        return result;
+    }();
+
+    j->obj = std::move(obj);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace orangeinp
+}  // namespace celeritas
@@ -0,0 +1,100 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/orangeinp/RectArrayProto.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "corecel/cont/Array.hh"
+#include "geocel/Types.hh"
+
+#include "ProtoInterface.hh"
+
+namespace celeritas
+{
+namespace orangeinp
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct a rectilinear array of universes.
+ *
+ * The array is defined by the cell boundaries along each axis. Each cell is
+ * filled by a universe whose local origin is placed at the center of the
+ * cell: the fill must cover the entire cell. The fills are ordered \c
+ * [x][y][z] (with z varying fastest), or a single fill may be given for every
+ * cell.
+ *
+ * The interior of the array is the box spanned by the grid. As with all
+ * rect arrays in ORANGE, the outermost grid surfaces are implicit: the array
+ * must be truncated by its placement in a parent universe.
+ */
+class RectArrayProto : public ProtoInterface
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using GridEdges = Array<std::vector<real_type>, 3>;
+    using VecSPProto = std::vector<SPConstProto>;
+    //!@}
+
+    //! Required input data to create an array proto
+    struct Input
+    {
+        GridEdges grid;  //!< Cell boundaries along each axis
+        VecSPProto fills;  //!< Universe in each cell, or one for all
+        std::string label;
+
+        // True if fully defined
+        explicit inline operator bool() const;
+    };
+
+  public:
+    // Construct with required input data
+    explicit RectArrayProto(Input&& inp);
+
+    // Short unique name of this object
+    std::string_view label() const final;
+
+    // Get the boundary of this universe as an object
+    SPConstObject interior() const final;
+
+    // Get a list of all daughters
+    VecProto daughters() const final;
+
+    // Construct a universe input from this object
+    void build(ProtoBuilder&) const final;
+
+    // Write the proto to a JSON object
+    void output(JsonPimpl*) const final;
+
+    //// ACCESSORS ////
+
+    //! Number of cells in the array
+    size_type num_cells() const { return num_cells_; }
+
+  private:
+    Input input_;
+    size_type num_cells_{};
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * True if fully defined.
+ */
+RectArrayProto::Input::operator bool() const
+{
+    return !this->fills.empty()
+           && std::all_of(this->grid.begin(), this->grid.end(), [](auto& v) {
+                  return v.size() >= 2;
+              });
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace orangeinp
+}  // namespace celeritas
@@ -26,15 +26,16 @@ ProtoBuilder::ProtoBuilder(OrangeInput* inp,
                            ProtoMap const& protos,
                            Options const& opts)
     : inp_{inp}
-    , protos_{protos}
+    , protos_{&protos}
     , save_json_{opts.save_json}
-    , bboxes_{protos_.size()}
+    , shared_{std::make_shared<SharedData>()}
 {
     CELER_EXPECT(inp_);
     CELER_EXPECT(opts.tol);
 
     inp_->tol = opts.tol;
-    inp_->universes.reserve(protos_.size());
+    inp_->universes.resize(protos_->size());
+    shared_->bboxes.resize(protos_->size());
 }
 
 //---------------------------------------------------------------------------//
@@ -48,8 +49,10 @@ ProtoBuilder::ProtoBuilder(OrangeInput* inp,
  */
 void ProtoBuilder::expand_bbox(UniverseId uid, BBox const& local_bbox)
 {
-    CELER_EXPECT(uid < bboxes_.size());
-    BBox& target = bboxes_[uid.get()];
+    CELER_EXPECT(uid < shared_->bboxes.size());
+
+    std::lock_guard<std::mutex> scoped_lock{shared_->lock};
+    BBox& target = shared_->bboxes[uid.get()];
     target = calc_union(target, local_bbox);
 }
 
@@ -60,22 +63,24 @@ void ProtoBuilder::expand_bbox(UniverseId uid, BBox const& local_bbox)
 void ProtoBuilder::save_json(JsonPimpl&& jp) const
 {
     CELER_EXPECT(this->save_json());
-    CELER_EXPECT(inp_->universes.size() < protos_.size());
+    CELER_EXPECT(next_id_ < protos_->size());
 
-    save_json_(UniverseId(inp_->universes.size()), std::move(jp));
+    std::lock_guard<std::mutex> scoped_lock{shared_->lock};
+    save_json_(next_id_, std::move(jp));
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Add a universe to the input.
+ * Add a universe to the input and advance to the next universe.
  *
  * This may be called *once* per proto.
  */
 void ProtoBuilder::insert(VariantUniverseInput&& unit)
 {
-    CELER_EXPECT(inp_->universes.size() < protos_.size());
+    CELER_EXPECT(next_id_ < protos_->size());
 
-    inp_->universes.emplace_back(std::move(unit));
+    inp_->universes[next_id_.get()] = std::move(unit);
+    ++next_id_;
 }
 
 //---------------------------------------------------------------------------//
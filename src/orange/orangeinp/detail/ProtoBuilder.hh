@@ -8,6 +8,8 @@
 #pragma once
 
 #include <functional>
+#include <memory>
+#include <mutex>
 
 #include "orange/OrangeInput.hh"
 #include "orange/OrangeTypes.hh"
@@ -38,6 +40,11 @@ namespace detail
  * The bounding box for a universe starts as "null" and is expanded by the
  * universes that use it: this allows, for example, different masked components
  * of an array to be used in multiple universes.
+ *
+ * Universes can be built concurrently: \c for_universe returns a builder for
+ * a single universe that shares the output and bounding boxes with this one.
+ * The shared data is guarded so that two universes can expand the bounding
+ * box of a common daughter at the same time.
  */
 class ProtoBuilder
 {
@@ -70,8 +77,11 @@ class ProtoBuilder
     // Find a universe ID
     inline UniverseId find_universe_id(ProtoInterface const*) const;
 
-    //! Get the next universe ID
-    UniverseId next_id() const { return UniverseId(inp_->universes.size()); }
+    //! Get the ID of the universe being built
+    UniverseId next_id() const { return next_id_; }
+
+    // Get a builder for the given universe that shares this builder's data
+    inline ProtoBuilder for_universe(UniverseId) const;
 
     // Get the bounding box of a universe
     inline BBox const& bbox(UniverseId) const;
@@ -86,10 +96,17 @@ class ProtoBuilder
     void insert(VariantUniverseInput&& unit);
 
   private:
+    struct SharedData
+    {
+        std::vector<BBox> bboxes;
+        std::mutex lock;
+    };
+
     OrangeInput* inp_;
-    ProtoMap const& protos_;
+    ProtoMap const* protos_;
     SaveUnivJson save_json_;
-    std::vector<BBox> bboxes_;
+    std::shared_ptr<SharedData> shared_;
+    UniverseId next_id_{0};
 };
 
 //---------------------------------------------------------------------------//
@@ -100,7 +117,19 @@ class ProtoBuilder
  */
 UniverseId ProtoBuilder::find_universe_id(ProtoInterface const* p) const
 {
-    return protos_.find(p);
+    return protos_->find(p);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a builder for the given universe that shares this builder's data.
+ */
+ProtoBuilder ProtoBuilder::for_universe(UniverseId uid) const
+{
+    CELER_EXPECT(uid < protos_->size());
+    ProtoBuilder result{*this};
+    result.next_id_ = uid;
+    return result;
 }
 
 //---------------------------------------------------------------------------//
@@ -109,8 +138,8 @@ UniverseId ProtoBuilder::find_universe_id(ProtoInterface const* p) const
  */
 BBox const& ProtoBuilder::bbox(UniverseId uid) const
 {
-    CELER_EXPECT(uid < bboxes_.size());
-    return bboxes_[uid.get()];
+    CELER_EXPECT(uid < shared_->bboxes.size());
+    return shared_->bboxes[uid.get()];
 }
 
 //---------------------------------------------------------------------------//
@@ -15,6 +15,7 @@
 
 #include "detail/InfixEvaluator.hh"
 #include "detail/LogicEvaluator.hh"
+#include "detail/SafetyGridCalculator.hh"
 #include "detail/SenseCalculator.hh"
 #include "detail/SurfaceFunctors.hh"
 #include "detail/Types.hh"
@@ -291,12 +292,27 @@ SimpleUnitTracker::intersect(LocalState const& state,
  * Complex surfaces might return the distance to internal surfaces that do not
  * represent the edge of a volume. Such distances are conservative but will
  * necessarily slow down the simulation.
+ *
+ * If the unit has a precomputed safety grid, its interpolated lower bound is
+ * returned unless it is smaller than a voxel diagonal, in which case the
+ * exact calculation is performed.
  */
 CELER_FUNCTION real_type SimpleUnitTracker::safety(Real3 const& pos,
                                                    LocalVolumeId volid) const
 {
     CELER_EXPECT(volid);
 
+    if (SafetyGridRecord const& grid = unit_record_.safety_grid)
+    {
+        detail::SafetyGridCalculator calc_grid_safety{
+            grid, params_.reals[grid.values]};
+        real_type result = calc_grid_safety(pos);
+        if (result >= grid.diagonal)
+        {
+            return result;
+        }
+    }
+
     VolumeView vol = this->make_local_volume(volid);
     if (!vol.simple_safety())
     {
@@ -0,0 +1,107 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/univ/detail/SafetyGridCalculator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/math/Algorithms.hh"
+#include "orange/OrangeData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Interpolate a conservative safety distance from a precomputed grid.
+ *
+ * The result is the trilinear interpolation of the node safeties, less the
+ * voxel diagonal. Each node within a diagonal of the point is either in the
+ * same volume (whose safety at the node exceeds the safety at the point by at
+ * most their separation) or in a different volume (whose safety is at most
+ * the separation), so the result never exceeds the true safety. Points
+ * outside the grid return zero.
+ */
+class SafetyGridCalculator
+{
+  public:
+    // Construct with grid metadata and node values
+    inline CELER_FUNCTION
+    SafetyGridCalculator(SafetyGridRecord const& grid,
+                         Span<real_type const> values);
+
+    // Calculate a lower bound on the safety distance
+    inline CELER_FUNCTION real_type operator()(Real3 const& pos) const;
+
+  private:
+    SafetyGridRecord const& grid_;
+    Span<real_type const> values_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with grid metadata and node values.
+ */
+CELER_FUNCTION
+SafetyGridCalculator::SafetyGridCalculator(SafetyGridRecord const& grid,
+                                           Span<real_type const> values)
+    : grid_{grid}, values_{values}
+{
+    CELER_EXPECT(grid_);
+    CELER_EXPECT(values_.size() == grid_.values.size());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate a lower bound on the safety distance.
+ */
+CELER_FUNCTION real_type
+SafetyGridCalculator::operator()(Real3 const& pos) const
+{
+    // Find the lower node and fractional position along each axis
+    Array<size_type, 3> idx;
+    Real3 frac;
+    for (auto ax : range(3))
+    {
+        real_type u = (pos[ax] - grid_.origin[ax]) * grid_.inv_delta[ax];
+        if (!(u >= 0 && u <= static_cast<real_type>(grid_.dims[ax] - 1)))
+        {
+            // Outside the grid
+            return 0;
+        }
+        idx[ax] = celeritas::min(static_cast<size_type>(u), grid_.dims[ax] - 2);
+        frac[ax] = u - static_cast<real_type>(idx[ax]);
+    }
+
+    // Interpolate between the eight corners of the voxel
+    size_type const stride_y = grid_.dims[2];
+    size_type const stride_x = grid_.dims[1] * stride_y;
+    size_type const base = idx[0] * stride_x + idx[1] * stride_y + idx[2];
+    real_type result = 0;
+    for (auto i : range(2))
+    {
+        real_type wx = i ? frac[0] : 1 - frac[0];
+        for (auto j : range(2))
+        {
+            real_type wxy = wx * (j ? frac[1] : 1 - frac[1]);
+            size_type offset = base + i * stride_x + j * stride_y;
+            result += wxy
+                      * ((1 - frac[2]) * values_[offset]
+                         + frac[2] * values_[offset + 1]);
+        }
+    }
+
+    return celeritas::max(result - grid_.diagonal, real_type{0});
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -7,13 +7,16 @@
 //---------------------------------------------------------------------------//
 #include "accel/detail/HitProcessor.hh"
 
+#include <G4LogicalVolume.hh>
 #include <G4ParticleTable.hh>
+#include <G4VSensitiveDetector.hh>
 
 #include "geocel/UnitUtils.hh"
 #include "celeritas/SimpleCmsTestBase.hh"
 #include "celeritas/phys/PDGNumber.hh"
 #include "celeritas/user/DetectorSteps.hh"
 #include "celeritas/user/StepData.hh"
+#include "accel/SDBatchInterface.hh"
 #include "accel/SDTestBase.hh"
 #include "accel/SimpleSensitiveDetector.hh"
 
@@ -29,6 +32,36 @@ namespace detail
 {
 namespace test
 {
+//---------------------------------------------------------------------------//
+/*!
+ * Sensitive detector that only accepts batches of hits.
+ */
+class BatchSensitiveDetector final : public G4VSensitiveDetector,
+                                     public SDBatchInterface
+{
+  public:
+    BatchSensitiveDetector() : G4VSensitiveDetector("batch") {}
+
+    void
+    ProcessHitBatch(DetectorStepOutput const& steps, SpanConstIndex hits) final
+    {
+        ++num_batches;
+        for (auto i : hits)
+        {
+            energy_deposition.push_back(steps.energy_deposition[i].value());
+        }
+    }
+
+    size_type num_batches{0};
+    std::vector<real_type> energy_deposition;
+
+  protected:
+    bool ProcessHits(G4Step*, G4TouchableHistory*) final
+    {
+        ADD_FAILURE() << "batch detector was sent a single hit";
+        return false;
+    }
+};
 
 //---------------------------------------------------------------------------//
 class SimpleCmsTest : public ::celeritas::test::SDTestBase,
@@ -320,6 +353,67 @@ TEST_F(SimpleCmsTest, touchable_edgecase)
     }
 }
 
+//---------------------------------------------------------------------------//
+TEST_F(SimpleCmsTest, batch)
+{
+    // Temporarily replace the EM calorimeter SD with a batch detector
+    auto volumes = this->make_detector_volumes();
+    auto* em_lv = const_cast<G4LogicalVolume*>(volumes->front());
+    ASSERT_EQ("em_calorimeter", em_lv->GetName());
+    G4VSensitiveDetector* orig_sd = em_lv->GetSensitiveDetector();
+    BatchSensitiveDetector batch_sd;
+    em_lv->SetSensitiveDetector(&batch_sd);
+    HitProcessor process_hits{volumes,
+                              this->make_particles(),
+                              selection_,
+                              locate_touchable_,
+                              StreamId{0}};
+    em_lv->SetSensitiveDetector(orig_sd);
+
+    // Interleave batch and single-hit detectors
+    auto dso_hits = this->make_dso();
+    dso_hits.detector = {
+        DetectorId{0},  // em_calorimeter
+        DetectorId{1},  // had_calorimeter
+        DetectorId{0},  // em_calorimeter
+    };
+    process_hits(dso_hits);
+    dso_hits = this->make_dso();
+    dso_hits.energy_deposition = {
+        MevEnergy{0.4},
+        MevEnergy{0.5},
+        MevEnergy{0.6},
+    };
+    process_hits(dso_hits);
+
+    // Batch detector receives hits in their original order
+    EXPECT_EQ(2, batch_sd.num_batches);
+    static real_type const expected_batch_edep[] = {0.1, 0.3, 0.5};
+    EXPECT_VEC_SOFT_EQ(expected_batch_edep, batch_sd.energy_deposition);
+    EXPECT_EQ(0, this->get_hits("em_calorimeter").energy_deposition.size());
+
+    // Other detectors are sent one step at a time
+    {
+        auto& result = this->get_hits("had_calorimeter");
+        static real_type const expected_energy_deposition[] = {0.2, 0.6};
+        EXPECT_VEC_SOFT_EQ(expected_energy_deposition,
+                           result.energy_deposition);
+        static char const* const expected_particle[] = {"e-", "gamma"};
+        EXPECT_VEC_EQ(expected_particle, result.particle);
+    }
+    {
+        auto& result = this->get_hits("si_tracker");
+        static real_type const expected_energy_deposition[] = {0.4};
+        EXPECT_VEC_SOFT_EQ(expected_energy_deposition,
+                           result.energy_deposition);
+    }
+
+    // Inactive batch detectors are skipped
+    batch_sd.Activate(false);
+    process_hits(dso_hits);
+    EXPECT_EQ(2, batch_sd.num_batches);
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace detail
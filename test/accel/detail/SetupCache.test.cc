@@ -0,0 +1,123 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/SetupCache.test.cc
+//---------------------------------------------------------------------------//
+#include "accel/detail/SetupCache.hh"
+
+#include <filesystem>
+#include <random>
+
+#include "corecel/Config.hh"
+
+#include "celeritas/SimpleCmsTestBase.hh"
+#include "celeritas/geo/GeoParams.hh"
+#include "celeritas/io/ImportData.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+class SetupCacheTest : public ::celeritas::test::SimpleCmsTestBase
+{
+  protected:
+    void SetUp() override
+    {
+        // Load the Geant4 geometry and physics before hashing
+        this->imported_data();
+
+        cache_dir_ = std::filesystem::temp_directory_path()
+                     / (this->make_unique_filename("-")
+                        + std::to_string(std::random_device{}()));
+        std::filesystem::create_directories(cache_dir_);
+    }
+
+    void TearDown() override
+    {
+        std::error_code ec;
+        std::filesystem::remove_all(cache_dir_, ec);
+    }
+
+    std::string calc_key() const
+    {
+        return SetupCache::calc_key(this->get_world_volume(),
+                                    this->build_import_data_selection());
+    }
+
+    SetupCache make_cache() const
+    {
+        return SetupCache{cache_dir_.string(), this->calc_key()};
+    }
+
+    std::filesystem::path cache_dir_;
+};
+
+//---------------------------------------------------------------------------//
+
+TEST_F(SetupCacheTest, key)
+{
+    auto key = this->calc_key();
+    EXPECT_EQ(16, key.size());
+    EXPECT_EQ(std::string::npos, key.find_first_not_of("0123456789abcdef"))
+        << key;
+
+    // Hashing reads but does not change the setup
+    EXPECT_EQ(key, this->calc_key());
+}
+
+TEST_F(SetupCacheTest, physics)
+{
+    int num_builds{0};
+    auto build = [this, &num_builds] {
+        ++num_builds;
+        return this->imported_data();
+    };
+
+    auto first = this->make_cache().physics(build);
+    ASSERT_TRUE(first);
+    EXPECT_EQ(1, num_builds);
+
+    // A new cache with the same key loads the saved data
+    auto second = this->make_cache().physics(build);
+    ASSERT_TRUE(second);
+    EXPECT_EQ(CELERITAS_USE_ROOT ? 1 : 2, num_builds);
+
+    auto const& expected = this->imported_data();
+    EXPECT_EQ(expected.elements.size(), second->elements.size());
+    EXPECT_EQ(expected.geo_materials.size(), second->geo_materials.size());
+    EXPECT_EQ(expected.particles.size(), second->particles.size());
+    EXPECT_EQ(expected.processes.size(), second->processes.size());
+    EXPECT_EQ(expected.volumes.size(), second->volumes.size());
+}
+
+TEST_F(SetupCacheTest, geometry)
+{
+    auto first = this->make_cache().geometry(this->get_world_volume());
+    ASSERT_TRUE(first);
+
+    if (CELERITAS_CORE_GEO == CELERITAS_CORE_GEO_ORANGE)
+    {
+        // Converted geometry was saved
+        auto key = this->calc_key();
+        EXPECT_TRUE(std::filesystem::exists(
+            cache_dir_ / ("celeritas-setup-" + key + ".org.json")));
+    }
+
+    auto second = this->make_cache().geometry(this->get_world_volume());
+    ASSERT_TRUE(second);
+    EXPECT_EQ(first->volumes().size(), second->volumes().size());
+    EXPECT_EQ(first->volumes().at(VolumeId{1}).name,
+              second->volumes().at(VolumeId{1}).name);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace detail
+}  // namespace celeritas
@@ -20,10 +20,14 @@
 #include "celeritas/ext/GeantPhysicsOptions.hh"
 #include "celeritas/field/RZMapFieldInput.hh"
 #include "celeritas/field/UniformFieldData.hh"
+#include "celeritas/geo/GeoMaterialParams.hh"
+#include "celeritas/geo/GeoParams.hh"
+#include "celeritas/global/alongstep/AlongStepNeutralWoodcockAction.hh"
 #include "celeritas/global/alongstep/AlongStepRZMapFieldMscAction.hh"
 #include "celeritas/global/alongstep/AlongStepUniformMscAction.hh"
 #include "celeritas/phys/PDGNumber.hh"
 #include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/WoodcockParams.hh"
 
 #include "AlongStepTestBase.hh"
 #include "celeritas_test.hh"
@@ -42,6 +46,52 @@ class KnAlongStepTest : public SimpleTestBase, public AlongStepTestBase
 {
 };
 
+class KnWoodcockAlongStepTest : public KnAlongStepTest
+{
+  public:
+    SPConstAction build_along_step() override
+    {
+        // Delta-track photons in a single volume
+        WoodcockParams::Input input;
+        input.particles = {this->particle()->find(pdg::gamma())};
+        input.regions = {{this->geometry()->volumes().find_unique(region_)}};
+        input.convex = {convex_};
+        auto woodcock = std::make_shared<WoodcockParams>(*this->geomaterial(),
+                                                         *this->material(),
+                                                         *this->particle(),
+                                                         *this->physics(),
+                                                         input);
+
+        auto& action_reg = *this->action_reg();
+        auto result = std::make_shared<AlongStepNeutralWoodcockAction>(
+            action_reg.next_id(), std::move(woodcock));
+        action_reg.insert(result);
+        return result;
+    }
+
+  protected:
+    std::string region_{"inner"};
+    bool convex_{false};
+};
+
+//! Delta-track in the world volume, which surrounds a vacuum box
+class KnWoodcockNonconvexTest : public KnWoodcockAlongStepTest
+{
+  public:
+    KnWoodcockNonconvexTest() { region_ = "world"; }
+
+    SPConstGeoMaterial build_geomaterial() override
+    {
+        GeoMaterialParams::Input input;
+        input.geometry = this->geometry();
+        input.materials = this->material();
+        input.volume_to_mat = {MaterialId{1}, MaterialId{0}, MaterialId{}};
+        input.volume_labels
+            = {Label{"inner"}, Label{"world"}, Label{"[EXTERIOR]"}};
+        return std::make_shared<GeoMaterialParams>(std::move(input));
+    }
+};
+
 class MockAlongStepTest : public MockTestBase, public AlongStepTestBase
 {
 };
@@ -206,6 +256,77 @@ TEST_F(KnAlongStepTest, basic)
     }
 }
 
+TEST_F(KnWoodcockAlongStepTest, basic)
+{
+    size_type num_tracks = 1000;
+    Input inp;
+    inp.particle_id = this->particle()->find(pdg::gamma());
+    {
+        SCOPED_TRACE("collision inside region");
+        inp.energy = MevEnergy{1};
+        auto result = this->run(inp, num_tracks);
+        EXPECT_SOFT_EQ(0, result.eloss);
+        EXPECT_SOFT_EQ(0.29293418473158, result.displacement);
+        EXPECT_SOFT_EQ(1, result.angle);
+        EXPECT_SOFT_EQ(9.7712326282598e-12, result.time);
+        EXPECT_SOFT_EQ(0.29293418473158, result.step);
+        EXPECT_SOFT_EQ(0.733, result.mfp);
+        EXPECT_SOFT_EQ(1, result.alive);
+    }
+    {
+        SCOPED_TRACE("tentative collision outside region");
+        inp.energy = MevEnergy{10};
+        auto result = this->run(inp, num_tracks);
+        EXPECT_SOFT_EQ(0, result.eloss);
+        EXPECT_SOFT_EQ(5, result.displacement);
+        EXPECT_SOFT_EQ(5, result.step);
+        EXPECT_SOFT_EQ(0.69964826661365, result.mfp);
+        EXPECT_SOFT_EQ(1, result.alive);
+        EXPECT_EQ("geo-boundary", result.action);
+    }
+    {
+        SCOPED_TRACE("outside region");
+        inp.energy = MevEnergy{10};
+        inp.position = {0, 0, -10};
+        auto result = this->run(inp, num_tracks);
+        EXPECT_SOFT_EQ(5, result.displacement);
+        EXPECT_SOFT_EQ(5, result.step);
+        EXPECT_SOFT_EQ(5.0000004137019e-11, result.mfp);
+        EXPECT_EQ("geo-boundary", result.action);
+    }
+}
+
+TEST_F(KnWoodcockNonconvexTest, leave_region)
+{
+    Input inp;
+    inp.particle_id = this->particle()->find(pdg::gamma());
+    inp.energy = MevEnergy{30};
+    inp.position = {0, 0, -10};
+    auto result = this->run(inp, 1);
+
+    // The flight to the tentative collision crosses the vacuum box
+    EXPECT_SOFT_EQ(5, result.displacement);
+    EXPECT_SOFT_EQ(5, result.step);
+    EXPECT_SOFT_EQ(0.23604447085004, result.mfp);
+    EXPECT_EQ("geo-boundary", result.action);
+}
+
+TEST_F(KnWoodcockNonconvexTest, declared_convex)
+{
+    // Incorrectly declaring the region convex skips the vacuum box
+    convex_ = true;
+
+    Input inp;
+    inp.particle_id = this->particle()->find(pdg::gamma());
+    inp.energy = MevEnergy{30};
+    inp.position = {0, 0, -10};
+    auto result = this->run(inp, 1);
+    EXPECT_SOFT_EQ(21.182449146104, result.displacement);
+    EXPECT_SOFT_EQ(21.182449146104, result.step);
+    EXPECT_SOFT_EQ(1, result.mfp);
+    EXPECT_EQ("physics-integral-rejected", result.action);
+}
+
 TEST_F(MockAlongStepTest, basic)
 {
     size_type num_tracks = 10;
@@ -0,0 +1,90 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/HostScheduler.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/global/detail/HostScheduler.hh"
+
+#include <atomic>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+class HostSchedulerTest : public ::testing::TestWithParam<HostScheduling>
+{
+  protected:
+    //! Count the number of times each index is executed
+    std::vector<int> count_executions(size_type size)
+    {
+        std::vector<std::atomic<int>> counts(size);
+        auto execute_range = [&counts](size_type begin, size_type end) {
+            EXPECT_LE(begin, end);
+            for (auto i : range(begin, end))
+            {
+                ++counts[i];
+            }
+        };
+        launch_host(GetParam(), &pool_, size, execute_range);
+        return {counts.begin(), counts.end()};
+    }
+
+    HostWorkerPool pool_{4};
+};
+
+TEST_P(HostSchedulerTest, all_executed_once)
+{
+    for (size_type size : {0u, 1u, 63u, 64u, 1000u, 4097u})
+    {
+        auto counts = this->count_executions(size);
+        EXPECT_EQ(std::vector<int>(size, 1), counts) << "size=" << size;
+    }
+}
+
+TEST_P(HostSchedulerTest, nested)
+{
+    // Launch from inside a parallel region as concurrent streams would
+    std::vector<std::vector<int>> counts(4);
+#ifdef _OPENMP
+#    pragma omp parallel
+#    pragma omp single
+#endif
+    for (auto stream : range(counts.size()))
+    {
+#ifdef _OPENMP
+#    pragma omp task
+#endif
+        counts[stream] = this->count_executions(1000 * (stream + 1));
+    }
+
+    for (auto stream : range(counts.size()))
+    {
+        EXPECT_EQ(std::vector<int>(1000 * (stream + 1), 1), counts[stream]);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(HostScheduler,
+                         HostSchedulerTest,
+                         ::testing::Values(HostScheduling::serial,
+                                           HostScheduling::parallel,
+                                           HostScheduling::task,
+                                           HostScheduling::pool),
+                         [](auto const& info) {
+                             return std::string{to_cstring(info.param)};
+                         });
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace detail
+}  // namespace celeritas
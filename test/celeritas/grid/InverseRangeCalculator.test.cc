@@ -30,7 +30,7 @@ class InverseRangeCalculatorTest : public CalculatorTestBase
 
         // InverseRange is 1/20 of energy
         auto value_span = this->mutable_values();
-        for (real_type& xs : value_span)
+        for (auto& xs : value_span)
         {
             xs *= .05;
         }
@@ -8,6 +8,7 @@
 #include "celeritas/grid/ValueGridInserter.hh"
 
 #include <algorithm>
+#include <type_traits>
 
 #include "corecel/cont/Range.hh"
 
@@ -24,7 +25,7 @@ namespace test
 class ValueGridInserterTest : public Test
 {
   protected:
-    Collection<real_type, Ownership::value, MemSpace::host> real_storage;
+    Collection<table_real_type, Ownership::value, MemSpace::host> real_storage;
     Collection<XsGridData, Ownership::value, MemSpace::host> grid_storage;
 };
 
@@ -62,6 +63,24 @@ TEST_F(ValueGridInserterTest, all)
     }
     EXPECT_EQ(2, grid_storage.size());
 }
+
+TEST_F(ValueGridInserterTest, deviation)
+{
+    double max_deviation = 0;
+    ValueGridInserter insert(&real_storage, &grid_storage, &max_deviation);
+
+    double const values[] = {1.0 / 3, 0, 2};
+    insert(UniformGridData::from_bounds(0.0, 1.0, 3), make_span(values));
+    if constexpr (std::is_same_v<table_real_type, double>)
+    {
+        EXPECT_EQ(0, max_deviation);
+    }
+    else
+    {
+        EXPECT_GT(max_deviation, 0);
+        EXPECT_LT(max_deviation, 1e-7);
+    }
+}
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace celeritas
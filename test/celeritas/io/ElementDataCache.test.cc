@@ -0,0 +1,203 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/ElementDataCache.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/io/ElementDataCache.hh"
+
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+#include "corecel/ScopedLogStorer.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/io/Logger.hh"
+#include "celeritas/io/AtomicRelaxationReader.hh"
+#include "celeritas/io/LivermorePEReader.hh"
+#include "celeritas/io/SeltzerBergerReader.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+class ElementDataCacheTest : public ::celeritas::test::Test
+{
+  protected:
+    void SetUp() override
+    {
+        data_path_ = this->test_data_path("celeritas", "");
+
+        // Write cache files to a new directory unique to this test
+        auto dir = std::filesystem::temp_directory_path()
+                   / (this->make_unique_filename("-")
+                      + std::to_string(std::random_device{}()));
+        std::filesystem::create_directories(dir);
+        cache_dir_ = dir.string();
+    }
+
+    void TearDown() override { std::filesystem::remove_all(cache_dir_); }
+
+    //! Path to a file in the cache directory
+    std::string cache_file(std::string const& filename) const
+    {
+        return cache_dir_ + '/' + filename;
+    }
+
+    //! Whether any stored log message contains the given string
+    static bool logged(ScopedLogStorer const& log, std::string const& str)
+    {
+        for (auto const& msg : log.messages())
+        {
+            if (msg.find(str) != std::string::npos)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::string data_path_;
+    std::string cache_dir_;
+};
+
+TEST_F(ElementDataCacheTest, livermore_pe)
+{
+    LivermorePEReader read_direct(data_path_.c_str());
+    auto const expected = read_direct(AtomicNumber{19});
+
+    CachedElementReader read_cached{read_direct, cache_dir_};
+    EXPECT_EQ(cache_dir_, read_cached.directory());
+
+    // First read misses the cache and saves it; second read loads it
+    for (int i = 0; i < 2; ++i)
+    {
+        SCOPED_TRACE(i == 0 ? "miss" : "hit");
+        auto const result = read_cached(AtomicNumber{19});
+        EXPECT_EQ(expected.xs_lo.vector_type, result.xs_lo.vector_type);
+        EXPECT_VEC_EQ(expected.xs_lo.x, result.xs_lo.x);
+        EXPECT_VEC_EQ(expected.xs_lo.y, result.xs_lo.y);
+        EXPECT_VEC_EQ(expected.xs_hi.x, result.xs_hi.x);
+        EXPECT_VEC_EQ(expected.xs_hi.y, result.xs_hi.y);
+        EXPECT_EQ(expected.thresh_lo, result.thresh_lo);
+        EXPECT_EQ(expected.thresh_hi, result.thresh_hi);
+        ASSERT_EQ(expected.shells.size(), result.shells.size());
+        for (auto j : range(expected.shells.size()))
+        {
+            auto const& exp_shell = expected.shells[j];
+            auto const& shell = result.shells[j];
+            EXPECT_EQ(exp_shell.binding_energy, shell.binding_energy);
+            EXPECT_VEC_EQ(exp_shell.param_lo, shell.param_lo);
+            EXPECT_VEC_EQ(exp_shell.param_hi, shell.param_hi);
+            EXPECT_VEC_EQ(exp_shell.xs, shell.xs);
+            EXPECT_VEC_EQ(exp_shell.energy, shell.energy);
+        }
+    }
+    EXPECT_TRUE(std::ifstream(this->cache_file("livermore-pe-19.bin")).good());
+
+    // Data from a different source invalidates the cache
+    CachedElementReader read_other{LivermorePEReader{"/nonexistent"},
+                                   cache_dir_};
+    EXPECT_THROW(read_other(AtomicNumber{19}), RuntimeError);
+}
+
+TEST_F(ElementDataCacheTest, atomic_relaxation)
+{
+    AtomicRelaxationReader read_direct(data_path_.c_str(), data_path_.c_str());
+    auto const expected = read_direct(AtomicNumber{19});
+    CachedElementReader read_cached{read_direct, cache_dir_};
+
+    for (int i = 0; i < 2; ++i)
+    {
+        ScopedLogStorer scoped_log_{&celeritas::world_logger()};
+        auto result = read_cached(std::vector{AtomicNumber{19}});
+        EXPECT_TRUE(logged(scoped_log_, i == 0 ? "(0 from cache)"
+                                               : "(1 from cache)"))
+            << scoped_log_;
+
+        ASSERT_EQ(1, result.count(19));
+        auto const& shells = result[19].shells;
+        ASSERT_EQ(expected.shells.size(), shells.size());
+        for (auto j : range(shells.size()))
+        {
+            auto const& exp_shell = expected.shells[j];
+            EXPECT_EQ(exp_shell.designator, shells[j].designator);
+            ASSERT_EQ(exp_shell.fluor.size(), shells[j].fluor.size());
+            ASSERT_EQ(exp_shell.auger.size(), shells[j].auger.size());
+            for (auto k : range(exp_shell.auger.size()))
+            {
+                auto const& exp_tr = exp_shell.auger[k];
+                auto const& tr = shells[j].auger[k];
+                EXPECT_EQ(exp_tr.initial_shell, tr.initial_shell);
+                EXPECT_EQ(exp_tr.auger_shell, tr.auger_shell);
+                EXPECT_EQ(exp_tr.probability, tr.probability);
+                EXPECT_EQ(exp_tr.energy, tr.energy);
+            }
+        }
+    }
+}
+
+TEST_F(ElementDataCacheTest, seltzer_berger)
+{
+    SeltzerBergerReader read_direct(data_path_.c_str());
+    auto const expected = read_direct(AtomicNumber{29});
+    CachedElementReader read_cached{read_direct, cache_dir_};
+
+    // Write the cache, then corrupt it
+    read_cached(AtomicNumber{29});
+    {
+        std::ofstream(this->cache_file("seltzer-berger-29.bin"),
+                      std::ios::binary)
+            << "CELERELD garbage";
+    }
+
+    // Corrupt file is ignored and rewritten
+    for (char const* expected_msg : {"(0 from cache)", "(1 from cache)"})
+    {
+        ScopedLogStorer scoped_log_{&celeritas::world_logger()};
+        auto result = read_cached(std::vector{AtomicNumber{29}});
+        EXPECT_TRUE(logged(scoped_log_, expected_msg)) << scoped_log_;
+        EXPECT_EQ(expected, result[29]);
+    }
+}
+
+TEST_F(ElementDataCacheTest, disabled)
+{
+    SeltzerBergerReader read_direct(data_path_.c_str());
+    CachedElementReader read_uncached{read_direct, ""};
+    EXPECT_EQ(read_direct(AtomicNumber{29}), read_uncached(AtomicNumber{29}));
+    EXPECT_FALSE(
+        std::ifstream(this->cache_file("seltzer-berger-29.bin")).good());
+}
+
+TEST_F(ElementDataCacheTest, modified_source)
+{
+    // Copy the source data so that it can be modified
+    std::string source_dir = this->cache_file("source");
+    std::filesystem::create_directory(source_dir);
+    std::filesystem::copy_file(data_path_ + "/br29", source_dir + "/br29");
+
+    CachedElementReader read_cached{SeltzerBergerReader{source_dir.c_str()},
+                                    cache_dir_};
+    auto const expected = read_cached(AtomicNumber{29});
+
+    // Changing the source file contents in place invalidates the cache
+    for (char const* expected_msg : {"(1 from cache)", "(0 from cache)"})
+    {
+        ScopedLogStorer scoped_log_{&celeritas::world_logger()};
+        auto result = read_cached(std::vector{AtomicNumber{29}});
+        EXPECT_TRUE(logged(scoped_log_, expected_msg)) << scoped_log_;
+        EXPECT_EQ(expected, result[29]);
+
+        std::ofstream(source_dir + "/br29", std::ios::app) << "\n";
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
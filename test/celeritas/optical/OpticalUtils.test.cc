@@ -100,6 +100,35 @@ TEST(OpticalUtilsTest, find_distribution_index)
     EXPECT_EQ(9, find_distribution_index(make_span(offsets), 42));
 }
 
+TEST(OpticalUtilsTest, bunch_photons)
+{
+    using detail::bunch_photons;
+
+    optical::GeneratorDistributionData dist;
+    dist.num_photons = 1001;
+    bunch_photons(1, &dist);
+    EXPECT_EQ(1001, dist.num_photons);
+    EXPECT_SOFT_EQ(1, dist.weight);
+
+    bunch_photons(100, &dist);
+    EXPECT_EQ(11, dist.num_photons);
+    EXPECT_SOFT_EQ(91, dist.weight);
+    EXPECT_SOFT_EQ(1001, dist.num_photons * dist.weight);
+
+    // Fewer photons than the bunch size
+    dist = {};
+    dist.num_photons = 7;
+    bunch_photons(100, &dist);
+    EXPECT_EQ(1, dist.num_photons);
+    EXPECT_SOFT_EQ(7, dist.weight);
+
+    // No photons
+    dist = {};
+    bunch_photons(100, &dist);
+    EXPECT_EQ(0, dist.num_photons);
+    EXPECT_SOFT_EQ(1, dist.weight);
+}
+
 TEST(OpticalUtilsTest, copy_if_vacant_host)
 {
     using TS = TrackStatus;
@@ -0,0 +1,191 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/optical/VisibilityLibrary.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/optical/VisibilityLibrary.hh"
+
+#include <memory>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionStateStore.hh"
+#include "corecel/data/Ref.hh"
+#include "corecel/grid/UniformGridData.hh"
+#include "corecel/io/OutputInterface.hh"
+#include "celeritas/optical/detail/OpticalUtils.hh"
+#include "celeritas/optical/detail/VisibilityLookupAction.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace optical
+{
+namespace test
+{
+using namespace ::celeritas::test;
+//---------------------------------------------------------------------------//
+
+class VisibilityLibraryTest : public ::celeritas::test::Test
+{
+  protected:
+    using Grid = VisibilityLibrary::Grid;
+    using VecReal = VisibilityLibrary::VecReal;
+
+    void SetUp() override
+    {
+        // 2 x 3 x 1 voxels spanning [0, 2) x [-3, 3) x [0, 10)
+        grid_[0] = UniformGridData::from_bounds(0, 2, 3);
+        grid_[1] = UniformGridData::from_bounds(-3, 3, 4);
+        grid_[2] = UniformGridData::from_bounds(0, 10, 2);
+
+        tally_params_.num_sensors = 2;
+    }
+
+    //! Fake visibility: sensor 0 sees +x, sensor 1 sees +y
+    static VecReal calc_visibility(Real3 const& pos)
+    {
+        return {pos[0] / 10, (pos[1] + 3) / 100};
+    }
+
+    HostCRef<VisibilityTallyParamsData> tally_params() const
+    {
+        return make_ref(tally_params_);
+    }
+
+    Grid grid_;
+    HostVal<VisibilityTallyParamsData> tally_params_;
+};
+
+TEST_F(VisibilityLibraryTest, build)
+{
+    auto input = VisibilityLibrary::build(grid_, 2, &calc_visibility);
+    ASSERT_TRUE(input);
+    VisibilityLibrary lib(input);
+    EXPECT_EQ(2, lib.num_sensors());
+    EXPECT_EQ(6, lib.num_voxels());
+
+    static float const expected_visibility[] = {0.05f,
+                                                0.01f,
+                                                0.05f,
+                                                0.03f,
+                                                0.05f,
+                                                0.05f,
+                                                0.15f,
+                                                0.01f,
+                                                0.15f,
+                                                0.03f,
+                                                0.15f,
+                                                0.05f};
+    EXPECT_VEC_SOFT_EQ(expected_visibility, input.visibility);
+}
+
+TEST_F(VisibilityLibraryTest, file_roundtrip)
+{
+    VisibilityLibrary orig(
+        VisibilityLibrary::build(grid_, 2, &calc_visibility));
+    std::string filename = this->make_unique_filename(".vis");
+    orig.write(filename);
+
+    auto loaded = VisibilityLibrary::from_file(filename);
+    ASSERT_TRUE(loaded);
+    EXPECT_EQ(orig.num_sensors(), loaded->num_sensors());
+    EXPECT_EQ(orig.num_voxels(), loaded->num_voxels());
+    for (auto ax : range(3))
+    {
+        auto const& expected = orig.host_ref().grid[ax];
+        auto const& actual = loaded->host_ref().grid[ax];
+        EXPECT_EQ(expected.size, actual.size);
+        EXPECT_SOFT_EQ(expected.front, actual.front);
+        EXPECT_SOFT_EQ(expected.back, actual.back);
+    }
+
+    auto const& expected = orig.host_ref().visibility;
+    auto const& actual = loaded->host_ref().visibility;
+    ASSERT_EQ(expected.size(), actual.size());
+    for (auto i : range(expected.size()))
+    {
+        EXPECT_EQ(expected[ItemId<float>(i)], actual[ItemId<float>(i)]);
+    }
+
+    EXPECT_THROW(VisibilityLibrary::from_file(filename + ".missing"),
+                 RuntimeError);
+}
+
+TEST_F(VisibilityLibraryTest, lookup)
+{
+    VisibilityLibrary lib(
+        VisibilityLibrary::build(grid_, 2, &calc_visibility));
+    CollectionStateStore<VisibilityStateData, MemSpace::host> state(
+        this->tally_params(), StreamId{0}, 1);
+
+    std::vector<GeneratorDistributionData> distributions(3);
+    for (auto& d : distributions)
+    {
+        d.step_length = 1;
+        d.material = OpticalMaterialId{0};
+    }
+    // Midpoint in voxel (1, 2, 0)
+    distributions[0].num_photons = 100;
+    distributions[0].points[StepPoint::pre].pos = {1.25, 1.5, 4};
+    distributions[0].points[StepPoint::post].pos = {1.75, 2.5, 6};
+    // Midpoint in voxel (0, 0, 0)
+    distributions[1].num_photons = 1000;
+    distributions[1].points[StepPoint::pre].pos = {0.5, -2, 1};
+    distributions[1].points[StepPoint::post].pos = {0.5, -2, 2};
+    // Midpoint outside the grid
+    distributions[2].num_photons = 1000;
+    distributions[2].points[StepPoint::pre].pos = {0.5, -2, 9};
+    distributions[2].points[StepPoint::post].pos = {0.5, -2, 12};
+
+    ::celeritas::detail::visibility_lookup(
+        lib.host_ref(), state.ref(), make_span(distributions), StreamId{0});
+
+    auto const& num_detected = state.ref().num_detected;
+    EXPECT_SOFT_NEAR(100 * 0.15 + 1000 * 0.05,
+                     num_detected[DetectorId{0}],
+                     1e-6);
+    EXPECT_SOFT_NEAR(100 * 0.05 + 1000 * 0.01,
+                     num_detected[DetectorId{1}],
+                     1e-6);
+
+    // Bunching into weighted photons preserves the expected detected count
+    CollectionStateStore<VisibilityStateData, MemSpace::host> bunched_state(
+        this->tally_params(), StreamId{0}, 1);
+    for (auto& d : distributions)
+    {
+        ::celeritas::detail::bunch_photons(7, &d);
+    }
+    EXPECT_EQ(15, distributions[0].num_photons);
+    ::celeritas::detail::visibility_lookup(lib.host_ref(),
+                                           bunched_state.ref(),
+                                           make_span(distributions),
+                                           StreamId{0});
+    for (auto det : range(DetectorId{2}))
+    {
+        EXPECT_SOFT_NEAR(num_detected[det],
+                         bunched_state.ref().num_detected[det],
+                         1e-6);
+    }
+}
+
+TEST_F(VisibilityLibraryTest, output)
+{
+    auto lib = std::make_shared<VisibilityLibrary>(
+        VisibilityLibrary::build(grid_, 2, &calc_visibility));
+    ::celeritas::detail::VisibilityLookupAction action(
+        ActionId{0}, AuxId{0}, lib, 1);
+
+    // No stream has tallied yet
+    EXPECT_JSON_EQ(
+        R"json({"_category":"result","_index":["sensor"],"_label":"optical-visibility-lookup","num_detected":[0.0,0.0]})json",
+        to_string(action));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace optical
+}  // namespace celeritas
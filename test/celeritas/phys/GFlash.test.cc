@@ -0,0 +1,326 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/GFlash.test.cc
+//---------------------------------------------------------------------------//
+#include <cmath>
+#include <random>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/data/AuxStateVec.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "corecel/data/CollectionStateStore.hh"
+#include "corecel/data/StackAllocator.hh"
+#include "geocel/UnitUtils.hh"
+#include "celeritas/geo/GeoParams.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
+#include "celeritas/global/Stepper.hh"
+#include "celeritas/mat/MaterialParams.hh"
+#include "celeritas/phys/GFlashAction.hh"
+#include "celeritas/phys/GFlashParams.hh"
+#include "celeritas/phys/GFlashProfileTally.hh"
+#include "celeritas/phys/GFlashShowerSampler.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/Primary.hh"
+#include "celeritas/user/SimpleCalo.hh"
+#include "celeritas/user/StepCollector.hh"
+
+#include "DiagnosticRngEngine.hh"
+#include "celeritas_test.hh"
+#include "../SimpleTestBase.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+//! Approximate properties of lead
+GFlashMaterial make_lead()
+{
+    GFlashMaterial result;
+    result.zeff = 82;
+    result.radiation_length = 0.5612;
+    result.critical_energy = units::MevEnergy{610 / (82 + 1.24)};
+    result.moliere_radius = 21.2 * result.radiation_length
+                            / result.critical_energy.value();
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+class GFlashShowerSamplerTest : public ::celeritas::test::Test
+{
+  protected:
+    using Energy = units::MevEnergy;
+
+    GFlashCoefficients coeffs_;
+    GFlashMaterial lead_ = make_lead();
+};
+
+TEST_F(GFlashShowerSamplerTest, low_energy)
+{
+    // Below the critical energy there is no shower maximum
+    GFlashShowerSampler sample(coeffs_, lead_, 5, Energy{5});
+    EXPECT_FALSE(sample);
+}
+
+TEST_F(GFlashShowerSamplerTest, sample)
+{
+    DiagnosticRngEngine<std::mt19937> rng;
+    real_type const max_radius = 3;
+
+    GFlashShowerSampler sample(coeffs_, lead_, max_radius, Energy{1e4});
+    ASSERT_TRUE(sample);
+    EXPECT_SOFT_EQ(6.3606094163343, sample.depth_max());
+    EXPECT_SOFT_EQ(3.9710715695545, sample.alpha());
+
+    size_type const num_samples = 10000;
+    real_type sum_depth = 0;
+    for ([[maybe_unused]] auto i : range(num_samples))
+    {
+        auto s = sample(rng);
+        EXPECT_LE(0, s.depth);
+        EXPECT_LE(0, s.radius);
+        EXPECT_GE(max_radius * lead_.moliere_radius, s.radius);
+        sum_depth += s.depth;
+    }
+
+    // Mean depth of the gamma distribution is alpha T / (alpha - 1)
+    real_type expected_depth = sample.alpha() * sample.depth_max()
+                               / (sample.alpha() - 1)
+                               * lead_.radiation_length;
+    EXPECT_SOFT_NEAR(expected_depth, sum_depth / num_samples, 0.02);
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(GFlashShowerSamplerTest, fit_longitudinal)
+{
+    // Tabulate the exact gamma profile for the default coefficients, deep
+    // enough that truncating the tail doesn't bias the moments
+    auto make_profile = [this](real_type energy) {
+        GFlashParams::LongitudinalProfile result;
+        result.energy = Energy{energy};
+        result.material = lead_;
+        result.bin_width = 0.05;
+        result.edep.resize(2000);
+
+        GFlashShowerSampler sample(coeffs_, lead_, 5, result.energy);
+        real_type alpha = sample.alpha();
+        real_type beta = (alpha - 1) / sample.depth_max();
+        for (auto i : range(result.edep.size()))
+        {
+            real_type t = (i + real_type(0.5)) * result.bin_width;
+            result.edep[i] = std::exp((alpha - 1) * std::log(beta * t)
+                                      - beta * t - std::lgamma(alpha));
+        }
+        return result;
+    };
+
+    GFlashParams::VecProfile profiles{
+        make_profile(1e3), make_profile(1e4), make_profile(1e5)};
+
+    GFlashCoefficients guess;
+    guess.t1 = 0;
+    guess.a1 = 1;
+    guess.a2 = 1;
+    auto fit = GFlashParams::fit_longitudinal(profiles, guess);
+    EXPECT_SOFT_NEAR(coeffs_.t1, fit.t1, 1e-2);
+    EXPECT_SOFT_NEAR(coeffs_.a1, fit.a1, 1e-2);
+    EXPECT_SOFT_NEAR(coeffs_.a2, fit.a2, 1e-2);
+    EXPECT_EQ(coeffs_.a3, fit.a3);
+
+    // A single profile only updates the energy-independent terms
+    fit = GFlashParams::fit_longitudinal({profiles[1]}, coeffs_);
+    EXPECT_SOFT_NEAR(coeffs_.t1, fit.t1, 1e-2);
+    EXPECT_SOFT_NEAR(coeffs_.a1, fit.a1, 1e-2);
+    EXPECT_EQ(coeffs_.a2, fit.a2);
+
+    // Empty profiles are rejected
+    EXPECT_THROW(GFlashParams::fit_longitudinal({}, coeffs_), RuntimeError);
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(GFlashShowerSamplerTest, profile_tally)
+{
+    GFlashProfileTally::Input inp;
+    inp.volumes = {VolumeId{0}, VolumeId{2}};
+    inp.origin = {1, 0, 0};
+    inp.axis = {1, 0, 0};
+    inp.energy = Energy{1e4};
+    inp.material = lead_;
+    inp.bin_width = 0.5;
+    inp.num_bins = 4;
+    GFlashProfileTally tally(inp, 1);
+
+    // Construct step data with the tally's filters and selection
+    HostVal<StepParamsData> params;
+    params.selection = tally.selection();
+    {
+        std::vector<DetectorId> detector(3);
+        for (auto const& [vid, did] : tally.filters().detectors)
+        {
+            detector[vid.get()] = did;
+        }
+        make_builder(&params.detector)
+            .insert_back(detector.begin(), detector.end());
+        params.nonzero_energy_deposition = true;
+    }
+    HostCRef<StepParamsData> params_ref;
+    params_ref = params;
+    CollectionStateStore<StepStateData, MemSpace::host> steps(
+        params_ref, StreamId{0}, 5);
+
+    // Depths (in units of half a radiation length) of the step midpoints
+    real_type const half_x0 = lead_.radiation_length / 2;
+    real_type const depth[] = {0.5, 1.5, 1.75, 3.5, -0.5};
+    DetectorId const det[] = {DetectorId{0}, DetectorId{0}, DetectorId{},
+                              DetectorId{0}, DetectorId{0}};
+    auto& data = steps.ref().data;
+    for (auto i : range(5u))
+    {
+        TrackSlotId tid{i};
+        data.track_id[tid] = TrackId{i};
+        data.detector[tid] = det[i];
+        real_type x = 1 + depth[i] * half_x0;
+        data.points[StepPoint::pre].pos[tid] = {x - 0.1, 0, 0};
+        data.points[StepPoint::post].pos[tid] = {x + 0.1, 1, 0};
+        data.energy_deposition[tid] = Energy{real_type(i + 1)};
+    }
+    tally.process_steps(
+        StepInterface::HostStepState{steps.ref(), StreamId{0}});
+
+    auto profile = tally.profile();
+    EXPECT_EQ(1e4, profile.energy.value());
+    EXPECT_EQ(0.5, profile.bin_width);
+    // Third step is outside the detector, last is before the origin
+    static double const expected_edep[] = {1, 2, 0, 4};
+    EXPECT_VEC_SOFT_EQ(expected_edep, profile.edep);
+}
+
+//---------------------------------------------------------------------------//
+class GFlashActionTest : public SimpleTestBase
+{
+  protected:
+    using Energy = units::MevEnergy;
+
+    void SetUp() override
+    {
+        inner_ = this->geometry()->volumes().find_unique("inner");
+        ASSERT_TRUE(inner_);
+
+        // Score energy in all volumes
+        calo_ = std::make_shared<SimpleCalo>(
+            std::vector<Label>{Label{"inner"}, Label{"world"}},
+            *this->geometry(),
+            1);
+        auto collector = std::make_shared<StepCollector>(
+            StepCollector::VecInterface{calo_},
+            this->geometry(),
+            1,
+            this->core()->action_reg().get());
+
+        GFlashParams::Input inp;
+        inp.volumes = {inner_};
+        inp.min_energy = Energy{1000};
+        inp.num_spots = 50;
+        inp.spot_capacity = 128;
+        action_ = GFlashAction::make_and_insert(
+            *this->core(), inp, std::move(collector));
+    }
+
+    VolumeId inner_;
+    std::shared_ptr<SimpleCalo> calo_;
+    std::shared_ptr<GFlashAction> action_;
+};
+
+TEST_F(GFlashActionTest, params)
+{
+    auto const& data = action_->params()->host_ref();
+    auto mat_id = data.volume_material[inner_];
+    ASSERT_TRUE(mat_id);
+    EXPECT_EQ("Al", this->material()->id_to_label(mat_id).name);
+
+    GFlashMaterial const& mat = data.materials[mat_id];
+    EXPECT_TRUE(mat);
+    EXPECT_SOFT_EQ(13, mat.zeff);
+    EXPECT_SOFT_EQ(610 / (13 + 1.24), mat.critical_energy.value());
+    EXPECT_SOFT_EQ(21.2 * mat.radiation_length / mat.critical_energy.value(),
+                   mat.moliere_radius);
+
+    // Particles are found
+    EXPECT_TRUE(data.scalars.electron);
+    EXPECT_FALSE(data.scalars.positron);
+    EXPECT_TRUE(data.scalars.gamma);
+}
+
+TEST_F(GFlashActionTest, host)
+{
+    StepperInput inp;
+    inp.params = this->core();
+    inp.stream_id = StreamId{0};
+    inp.num_track_slots = 8;
+    Stepper<MemSpace::host> step(inp);
+
+    // Four high-energy photons starting at the back of the inner box
+    Primary p;
+    p.particle_id = this->particle()->find(pdg::gamma());
+    p.energy = Energy{2000};
+    p.position = from_cm({0, 0, -4.9});
+    p.direction = {0, 0, 1};
+    p.event_id = EventId{0};
+    std::vector<Primary> primaries(4, p);
+
+    auto const& state = get<GFlashState<MemSpace::host>>(step.state().aux(),
+                                                          action_->aux_id());
+    VolumeId world = this->geometry()->volumes().find_unique("world");
+    real_type const half_width = from_cm(5);
+    real_type const spot_energy = 2000.0 / 50;
+
+    // Check the spots of the last step and count those in the inner box
+    auto count_inner = [&] {
+        StackAllocator<GFlashSpot> allocated(state.store.ref().spots);
+        auto spots = allocated.get();
+        EXPECT_EQ(100, spots.size());
+
+        size_type result{0};
+        for (GFlashSpot const& spot : spots)
+        {
+            EXPECT_LE(-half_width, spot.pos[2]);
+            EXPECT_SOFT_EQ(spot_energy, spot.energy.value());
+            EXPECT_EQ(EventId{0}, spot.event);
+            EXPECT_EQ(p.particle_id, spot.particle);
+            bool is_inner = std::fabs(spot.pos[0]) < half_width
+                            && std::fabs(spot.pos[1]) < half_width
+                            && spot.pos[2] < half_width;
+            EXPECT_EQ(is_inner ? inner_ : world, spot.volume);
+            result += is_inner;
+        }
+        EXPECT_LT(0, result);
+        EXPECT_GT(spots.size(), result);
+        return result;
+    };
+
+    // Only two showers fit in the spot stack: the others are retried
+    auto counts = step(make_span(primaries));
+    EXPECT_EQ(4, counts.active);
+    EXPECT_EQ(2, counts.alive);
+    size_type num_inner = count_inner();
+    auto edep = calo_->calc_total_energy_deposition();
+    EXPECT_SOFT_EQ(spot_energy * num_inner, edep[0]);
+    EXPECT_SOFT_EQ(2 * 2000, edep[0] + edep[1]);
+
+    counts = step();
+    EXPECT_EQ(2, counts.active);
+    EXPECT_EQ(0, counts.alive);
+    num_inner += count_inner();
+    edep = calo_->calc_total_energy_deposition();
+    EXPECT_SOFT_EQ(spot_energy * num_inner, edep[0]);
+    EXPECT_SOFT_EQ(4 * 2000, edep[0] + edep[1]);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
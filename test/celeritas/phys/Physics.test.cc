@@ -7,7 +7,11 @@
 //---------------------------------------------------------------------------//
 #include "Physics.test.hh"
 
+#include <algorithm>
 #include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 #include "corecel/cont/Range.hh"
 #include "corecel/data/CollectionStateStore.hh"
@@ -140,11 +144,65 @@ TEST_F(PhysicsParamsTest, output)
     {
         GTEST_SKIP() << "Test results are based on CGS units";
     }
+    if (!std::is_same_v<table_real_type, real_type>)
+    {
+        GTEST_SKIP() << "Test results are based on full-precision tables";
+    }
     EXPECT_JSON_EQ(
-        R"json({"_category":"internal","_label":"physics","models":{"label":["mock-model-1","mock-model-2","mock-model-3","mock-model-4","mock-model-5","mock-model-6","mock-model-7","mock-model-8","mock-model-9","mock-model-10","mock-model-11"],"process_id":[0,0,1,2,2,2,3,3,4,4,5]},"options":{"fixed_step_limiter":0.0,"linear_loss_limit":0.01,"lowest_electron_energy":[0.001,"MeV"],"max_step_over_range":0.2,"min_eprime_over_e":0.8,"min_range":0.1},"processes":{"label":["scattering","absorption","purrs","hisses","meows","barks"]},"sizes":{"integral_xs":8,"model_groups":8,"model_ids":11,"process_groups":5,"process_ids":8,"reals":231,"value_grid_ids":89,"value_grids":89,"value_tables":35}})json",
+        R"json({"_category":"internal","_label":"physics","models":{"label":["mock-model-1","mock-model-2","mock-model-3","mock-model-4","mock-model-5","mock-model-6","mock-model-7","mock-model-8","mock-model-9","mock-model-10","mock-model-11"],"process_id":[0,0,1,2,2,2,3,3,4,4,5]},"options":{"fixed_step_limiter":0.0,"linear_loss_limit":0.01,"lowest_electron_energy":[0.001,"MeV"],"max_step_over_range":0.2,"min_eprime_over_e":0.8,"min_range":0.1},"processes":{"label":["scattering","absorption","purrs","hisses","meows","barks"]},"sizes":{"integral_xs":8,"model_groups":8,"model_ids":11,"process_groups":5,"process_ids":8,"reals":39,"table_reals":192,"value_grid_ids":89,"value_grids":89,"value_tables":35}})json",
         to_string(out));
 }
 
+TEST_F(PhysicsParamsTest, table_deviation)
+{
+    std::vector<std::string> tables;
+    double max_deviation = 0;
+    for (auto const& [table, dev] : this->physics()->table_deviation())
+    {
+        tables.push_back(table);
+        max_deviation = std::max(max_deviation, dev);
+    }
+    static char const* const expected_tables[] = {
+        "anti-celeriton/hisses/energy_loss",
+        "anti-celeriton/hisses/macro_xs",
+        "anti-celeriton/hisses/range",
+        "anti-celeriton/meows/macro_xs",
+        "anti-celeriton/mock-model-10/micro_xs",
+        "anti-celeriton/mock-model-7/micro_xs",
+        "anti-celeriton/mock-model-8/micro_xs",
+        "celeriton/meows/macro_xs",
+        "celeriton/mock-model-2/micro_xs",
+        "celeriton/mock-model-4/micro_xs",
+        "celeriton/mock-model-5/micro_xs",
+        "celeriton/mock-model-6/micro_xs",
+        "celeriton/mock-model-9/micro_xs",
+        "celeriton/purrs/energy_loss",
+        "celeriton/purrs/macro_xs",
+        "celeriton/purrs/range",
+        "celeriton/scattering/macro_xs",
+        "electron/barks/energy_loss",
+        "electron/barks/macro_xs",
+        "electron/barks/range",
+        "electron/mock-model-11/micro_xs",
+        "gamma/absorption/macro_xs",
+        "gamma/mock-model-1/micro_xs",
+        "gamma/mock-model-3/micro_xs",
+        "gamma/scattering/macro_xs",
+    };
+    EXPECT_VEC_EQ(expected_tables, tables);
+
+    if (std::is_same_v<table_real_type, real_type>)
+    {
+        // Mock data is constructed at runtime precision
+        EXPECT_EQ(0, max_deviation);
+    }
+    else
+    {
+        EXPECT_GT(max_deviation, 0);
+        EXPECT_LT(max_deviation, 1e-7);
+    }
+}
+
 //---------------------------------------------------------------------------//
 // PHYSICS TRACK VIEW (HOST)
 //---------------------------------------------------------------------------//
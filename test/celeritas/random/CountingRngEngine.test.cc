@@ -0,0 +1,83 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/random/CountingRngEngine.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/random/CountingRngEngine.hh"
+
+#include <random>
+
+#include "corecel/cont/Range.hh"
+#include "celeritas/random/distribution/GenerateCanonical.hh"
+#include "celeritas/random/distribution/RejectionSampler.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// Sample from a triangular distribution with a rejection loop
+template<class Engine>
+double sample_triangle(Engine& rng)
+{
+    double x;
+    do
+    {
+        count_iteration(rng);
+        x = generate_canonical<double>(rng);
+    } while (RejectionSampler<double>(x)(rng));
+    return x;
+}
+
+//---------------------------------------------------------------------------//
+
+TEST(CountingRngEngineTest, sequence)
+{
+    SamplingCounters counters;
+    CountingRngEngine<std::mt19937> rng{std::mt19937{}, &counters};
+    std::mt19937 reference;
+
+    for ([[maybe_unused]] auto i : range(10))
+    {
+        EXPECT_EQ(reference(), rng());
+    }
+    EXPECT_EQ(10, counters.draws);
+    EXPECT_EQ(0, counters.iterations);
+
+    // Canonical doubles use two 32-bit draws and floats use one
+    generate_canonical<double>(rng);
+    EXPECT_EQ(12, counters.draws);
+    generate_canonical<float>(rng);
+    EXPECT_EQ(13, counters.draws);
+}
+
+TEST(CountingRngEngineTest, iterations)
+{
+    SamplingCounters counters;
+    CountingRngEngine<std::mt19937> rng{std::mt19937{}, &counters};
+    std::mt19937 reference;
+
+    // Each iteration draws one canonical for the sample and one to reject
+    size_type num_samples = 1000;
+    double counted_sum = 0;
+    double reference_sum = 0;
+    for ([[maybe_unused]] auto i : range(num_samples))
+    {
+        counted_sum += sample_triangle(rng);
+        reference_sum += sample_triangle(reference);
+    }
+    EXPECT_EQ(4 * counters.iterations, counters.draws);
+    // Expected number of iterations is two per sample
+    EXPECT_SOFT_NEAR(2.0, double(counters.iterations) / num_samples, 0.05);
+    // Expected value is 2/3
+    EXPECT_SOFT_NEAR(2.0 / 3, counted_sum / num_samples, 0.02);
+    EXPECT_SOFT_NEAR(2.0 / 3, reference_sum / num_samples, 0.02);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -0,0 +1,232 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/random/PhiloxRngEngine.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/random/PhiloxRngEngine.hh"
+
+#include <utility>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/data/CollectionStateStore.hh"
+#include "celeritas/random/PhiloxRngParams.hh"
+
+#include "RngTally.hh"
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+class PhiloxRngEngineTest : public Test
+{
+  protected:
+    using HostStore = CollectionStateStore<PhiloxRngStateData, MemSpace::host>;
+    using uint_t = PhiloxUInt;
+
+    void SetUp() override
+    {
+        params = std::make_shared<PhiloxRngParams>(12345);
+    }
+
+    std::shared_ptr<PhiloxRngParams> params;
+};
+
+TEST_F(PhiloxRngEngineTest, known_answer)
+{
+    // Known-answer tests from the Random123 reference implementation
+    auto block = PhiloxRngEngine::generate_block({0u, 0u, 0u, 0u}, {0u, 0u});
+    static uint_t const expected_zero[]
+        = {0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u};
+    EXPECT_VEC_EQ(expected_zero, block);
+
+    block = PhiloxRngEngine::generate_block(
+        {0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu},
+        {0xffffffffu, 0xffffffffu});
+    static uint_t const expected_ones[]
+        = {0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu};
+    EXPECT_VEC_EQ(expected_ones, block);
+
+    block = PhiloxRngEngine::generate_block(
+        {0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u},
+        {0xa4093822u, 0x299f31d0u});
+    static uint_t const expected_pi[]
+        = {0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u};
+    EXPECT_VEC_EQ(expected_pi, block);
+}
+
+TEST_F(PhiloxRngEngineTest, host)
+{
+    auto const& key = params->host_ref().key;
+    EXPECT_EQ(0xa9d111a0u, key[0]);
+    EXPECT_EQ(0x22118258u, key[1]);
+
+    HostStore states(params->host_ref(), StreamId{1}, 4);
+    auto const& counter = states.ref().state[TrackSlotId{2}].counter;
+    static uint_t const expected_counter[] = {0u, 0u, 2u, 1u};
+    EXPECT_VEC_EQ(expected_counter, counter);
+
+    // Values are consecutive words of consecutive blocks
+    PhiloxRngEngine rng(params->host_ref(), states.ref(), TrackSlotId{2});
+    std::vector<uint_t> values;
+    for ([[maybe_unused]] auto i : range(8))
+    {
+        values.push_back(rng());
+    }
+    static uint_t const expected_counter_after[] = {8u, 0u, 2u, 1u};
+    EXPECT_VEC_EQ(expected_counter_after, counter);
+
+    std::vector<uint_t> expected;
+    for (uint_t i : range(2u))
+    {
+        auto block = PhiloxRngEngine::generate_block({i, 0u, 2u, 1u}, key);
+        expected.insert(expected.end(), block.begin(), block.end());
+    }
+    EXPECT_VEC_EQ(expected, values);
+}
+
+TEST_F(PhiloxRngEngineTest, moments)
+{
+    unsigned int num_samples = 1 << 12;
+    unsigned int num_seeds = 1 << 8;
+
+    HostStore states(params->host_ref(), StreamId{0}, num_seeds);
+    RngTally tally;
+
+    for (unsigned int i = 0; i < num_seeds; ++i)
+    {
+        PhiloxRngEngine rng(params->host_ref(), states.ref(), TrackSlotId{i});
+        for (unsigned int j = 0; j < num_samples; ++j)
+        {
+            tally(generate_canonical(rng));
+        }
+    }
+    tally.check(num_samples * num_seeds, 1e-3);
+}
+
+TEST_F(PhiloxRngEngineTest, jump)
+{
+    HostStore states(params->host_ref(), StreamId{0}, 2);
+    PhiloxRngEngine rng(params->host_ref(), states.ref(), TrackSlotId{0});
+    PhiloxRngEngine skip_rng(params->host_ref(), states.ref(), TrackSlotId{1});
+
+    PhiloxRngInitializer init;
+    init.subsequence = 1234;
+    rng = init;
+    for (ull_int offset = 0; offset < 1024; ++offset)
+    {
+        // Initialize and skip ahead
+        init.offset = offset;
+        skip_rng = init;
+        ASSERT_EQ(rng(), skip_rng()) << "offset " << offset;
+    }
+    for (ull_int count : {1, 4, 21, 170, 65535})
+    {
+        // Skip ahead without initializing
+        skip_rng.discard(count);
+        for (ull_int i = 0; i < count; ++i)
+        {
+            rng();
+        }
+        EXPECT_EQ(rng(), skip_rng());
+    }
+
+    // Different subsequences are different
+    init.offset = 0;
+    rng = init;
+    init.subsequence += 1;
+    skip_rng = init;
+    EXPECT_NE(rng(), skip_rng());
+}
+
+TEST_F(PhiloxRngEngineTest, batch)
+{
+    auto const& key = params->host_ref().key;
+
+    // Batched blocks are the same as individual blocks
+    std::vector<PhiloxBlock> counters;
+    for (uint_t i : range(7u))
+    {
+        counters.push_back({i * 0x9e3779b9u, i, 3u * i, 0xffffffffu - i});
+    }
+    std::vector<PhiloxBlock> blocks(counters.size());
+    PhiloxRngEngine::generate_blocks(
+        make_span(std::as_const(counters)), key, make_span(blocks));
+    for (auto i : range(counters.size()))
+    {
+        EXPECT_EQ(PhiloxRngEngine::generate_block(counters[i], key), blocks[i])
+            << "block " << i;
+    }
+
+    HostStore states(params->host_ref(), StreamId{0}, 2);
+    PhiloxRngEngine rng(params->host_ref(), states.ref(), TrackSlotId{0});
+    PhiloxRngEngine ref_rng(params->host_ref(), states.ref(), TrackSlotId{1});
+    auto const& counter = states.ref().state[TrackSlotId{0}].counter;
+    auto const& ref_counter = states.ref().state[TrackSlotId{1}].counter;
+
+    PhiloxRngInitializer init;
+    init.subsequence = 4321;
+    for (ull_int offset : {0, 1, 3, 6})
+    {
+        init.offset = offset;
+        for (std::size_t size : {0, 1, 3, 4, 9, 17, 40})
+        {
+            // Bulk 32-bit values match sequential values
+            rng = init;
+            ref_rng = init;
+            std::vector<uint_t> values(size);
+            rng.generate(make_span(values));
+            std::vector<uint_t> expected(size);
+            for (auto& v : expected)
+            {
+                v = ref_rng();
+            }
+            EXPECT_VEC_EQ(expected, values);
+            EXPECT_VEC_EQ(ref_counter, counter);
+            EXPECT_EQ(ref_rng(), rng());
+
+            // Bulk canonical values match sequential values
+            rng = init;
+            ref_rng = init;
+            std::vector<real_type> xi(size);
+            rng.fill(make_span(xi));
+            std::vector<real_type> expected_xi(size);
+            for (auto& v : expected_xi)
+            {
+                v = generate_canonical(ref_rng);
+            }
+            EXPECT_VEC_EQ(expected_xi, xi);
+            EXPECT_VEC_EQ(ref_counter, counter);
+            EXPECT_EQ(ref_rng(), rng());
+        }
+    }
+}
+
+TEST_F(PhiloxRngEngineTest, slot_independence)
+{
+    // The same subsequence in different slots and streams gives the same
+    // values
+    HostStore states(params->host_ref(), StreamId{0}, 8);
+    HostStore other_states(params->host_ref(), StreamId{3}, 8);
+
+    PhiloxRngInitializer init;
+    init.subsequence = (ull_int{5} << 32) | 17;
+    PhiloxRngEngine rng(params->host_ref(), states.ref(), TrackSlotId{1});
+    rng = init;
+    PhiloxRngEngine other_rng(
+        params->host_ref(), other_states.ref(), TrackSlotId{6});
+    other_rng = init;
+    for ([[maybe_unused]] auto i : range(100))
+    {
+        ASSERT_EQ(rng(), other_rng());
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
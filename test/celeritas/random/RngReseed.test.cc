@@ -82,6 +82,15 @@ TEST_F(RngReseedTest, reseed)
                                                    2861073075u,
                                                    1771581540u,
                                                    3600889717u};
+#elif CELERITAS_CORE_RNG == CELERITAS_CORE_RNG_PHILOX
+    static unsigned int const expected_values[] = {3292802889u,
+                                                   416350694u,
+                                                   2029576861u,
+                                                   3707552278u,
+                                                   2421967700u,
+                                                   877304618u,
+                                                   3291117927u,
+                                                   3449261392u};
 #endif
     EXPECT_VEC_EQ(values, expected_values);
 }
@@ -14,8 +14,10 @@
 #include <string>
 #include <type_traits>
 
+#include "corecel/cont/Range.hh"
 #include "corecel/data/CollectionStateStore.hh"
 #include "corecel/io/detail/ReprImpl.hh"
+#include "celeritas/random/XorwowRngBatch.hh"
 #include "celeritas/random/XorwowRngParams.hh"
 #include "celeritas/random/detail/GenerateCanonical32.hh"
 
@@ -259,6 +261,81 @@ TEST_F(XorwowRngEngineTest, jump)
     }
 }
 
+TEST_F(XorwowRngEngineTest, local)
+{
+    HostStore states(params->host_ref(), StreamId{0}, 2);
+    XorwowRngEngine rng(params->host_ref(), states.ref(), TrackSlotId{0});
+    XorwowRngEngine ref_rng(params->host_ref(), states.ref(), TrackSlotId{1});
+    XorwowState& ref_state = states.ref().state[TrackSlotId{1}];
+    ref_state = states.ref().state[TrackSlotId{0}];
+
+    {
+        // Local engine draws from a copy of the state
+        XorwowLocalRngEngine local = rng.make_local();
+        for (int i = 0; i < 10; ++i)
+        {
+            EXPECT_EQ(ref_rng(), local());
+        }
+        EXPECT_NE(ref_state.weylstate,
+                  states.ref().state[TrackSlotId{0}].weylstate);
+        local.store();
+        EXPECT_EQ(ref_state.weylstate,
+                  states.ref().state[TrackSlotId{0}].weylstate);
+    }
+    {
+        // Bulk fill is identical to sequential sampling
+        std::vector<real_type> expected(17);
+        for (auto& v : expected)
+        {
+            v = generate_canonical(ref_rng);
+        }
+        std::vector<real_type> actual(expected.size());
+        fill_canonical(rng, make_span(actual));
+        EXPECT_VEC_EQ(expected, actual);
+        EXPECT_EQ(ref_rng(), rng());
+    }
+}
+
+TEST_F(XorwowRngEngineTest, batch)
+{
+    size_type const num_slots = 11;
+    size_type const num_draws = 5;
+    HostStore states(params->host_ref(), StreamId{0}, 2 * num_slots);
+    HostStore ref_states(params->host_ref(), StreamId{0}, 2 * num_slots);
+
+    // Sample every other slot in bulk
+    std::vector<TrackSlotId> slots;
+    for (auto i : range(num_slots))
+    {
+        slots.push_back(TrackSlotId{2 * i + 1});
+    }
+    std::vector<real_type> actual(num_slots * num_draws);
+    fill_canonical_batch(states.ref(), make_span(slots), make_span(actual));
+
+    // Sample each slot sequentially
+    std::vector<real_type> expected(actual.size());
+    for (auto i : range(num_slots))
+    {
+        XorwowRngEngine rng(params->host_ref(), ref_states.ref(), slots[i]);
+        for (auto j : range(num_draws))
+        {
+            expected[j * num_slots + i] = generate_canonical(rng);
+        }
+    }
+    EXPECT_VEC_EQ(expected, actual);
+
+    // Check that the states were written back and unused slots are unchanged
+    for (auto i : range(TrackSlotId{2 * num_slots}))
+    {
+        auto const& a = states.ref().state[i];
+        auto const& e = ref_states.ref().state[i];
+        EXPECT_EQ(e.weylstate, a.weylstate) << "slot " << i.get();
+        EXPECT_TRUE(std::equal(
+            e.xorstate.begin(), e.xorstate.end(), a.xorstate.begin()))
+            << "slot " << i.get();
+    }
+}
+
 TEST_F(XorwowRngEngineTest, TEST_IF_CELER_DEVICE(device))
 {
     // Create and initialize states
@@ -8,8 +8,10 @@
 #include "celeritas/random/distribution/ExponentialDistribution.hh"
 
 #include <random>
+#include <vector>
 
 #include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
 
 #include "DiagnosticRngEngine.hh"
 #include "celeritas_test.hh"
@@ -49,6 +51,24 @@ TEST(ExponentialDistributionTest, all)
     EXPECT_EQ(2 * num_samples, rng.count());
 }
 
+TEST(ExponentialDistributionTest, fill)
+{
+    ExponentialDistribution<double> sample(0.25);
+    test::DiagnosticRngEngine<std::mt19937> rng;
+    test::DiagnosticRngEngine<std::mt19937> ref_rng;
+
+    // Bulk samples are identical to sequential samples
+    std::vector<double> expected(13);
+    for (double& x : expected)
+    {
+        x = sample(ref_rng);
+    }
+    std::vector<double> actual(expected.size());
+    sample(rng, make_span(actual));
+    EXPECT_VEC_EQ(expected, actual);
+    EXPECT_EQ(ref_rng.count(), rng.count());
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace celeritas
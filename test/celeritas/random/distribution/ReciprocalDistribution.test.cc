@@ -42,6 +42,14 @@ TEST(ReciprocalDistributionTest, bin)
     EXPECT_VEC_EQ(expected_counters, counters);
 }
 
+TEST(ReciprocalDistributionTest, transform)
+{
+    ReciprocalDistribution<double> sample_recip{0.1, 0.9};
+    EXPECT_DOUBLE_EQ(0.1, sample_recip.transform(0));
+    EXPECT_DOUBLE_EQ(0.3, sample_recip.transform(0.5));
+    EXPECT_DOUBLE_EQ(0.9, sample_recip.transform(1));
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace celeritas
@@ -10,13 +10,18 @@
 #include <memory>
 #include <vector>
 
+#include "corecel/Config.hh"
+
+#include "corecel/cont/Range.hh"
 #include "corecel/data/Collection.hh"
 #include "corecel/io/LogContextException.hh"
 #include "corecel/sys/ActionRegistry.hh"
 #include "geocel/UnitUtils.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/ext/GeantPhysicsOptions.hh"
+#include "celeritas/geo/GeoParams.hh"
 #include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
 #include "celeritas/global/CoreTrackData.hh"
 #include "celeritas/global/CoreTrackView.hh"
 #include "celeritas/global/Stepper.hh"
@@ -24,6 +29,7 @@
 #include "celeritas/phys/ParticleParams.hh"
 #include "celeritas/phys/Primary.hh"
 #include "celeritas/track/TrackInitParams.hh"
+#include "celeritas/track/detail/SpatialKeyCalculator.hh"
 #include "celeritas/track/detail/TrackSortUtils.hh"
 
 #include "celeritas_test.hh"
@@ -158,6 +164,36 @@ class TestTrackSortActionIdEm3Stepper : public TestEm3NoMsc
     }
 };
 
+#define TestTrackSpatialEm3Stepper \
+    TEST_IF_CELERITAS_GEANT(TestTrackSpatialEm3Stepper)
+class TestTrackSpatialEm3Stepper : public TestEm3NoMsc
+{
+  protected:
+    auto build_init() -> SPConstTrackInit override
+    {
+        TrackInitParams::Input input;
+        input.capacity = 4096;
+        input.max_events = 4096;
+        input.track_order = TrackOrder::reindex_spatial;
+        return std::make_shared<TrackInitParams>(input);
+    }
+};
+
+#define TestTrackSpatialActionEm3Stepper \
+    TEST_IF_CELERITAS_GEANT(TestTrackSpatialActionEm3Stepper)
+class TestTrackSpatialActionEm3Stepper : public TestEm3NoMsc
+{
+  protected:
+    auto build_init() -> SPConstTrackInit override
+    {
+        TrackInitParams::Input input;
+        input.capacity = 4096;
+        input.max_events = 4096;
+        input.track_order = TrackOrder::reindex_spatial_step_limit_action;
+        return std::make_shared<TrackInitParams>(input);
+    }
+};
+
 #define TestActionCountEm3Stepper \
     TEST_IF_CELERITAS_GEANT(TestActionCountEm3Stepper)
 template<MemSpace M>
@@ -345,6 +381,136 @@ TEST_F(TestTrackPartitionEm3Stepper,
     }
 }
 
+TEST(SpatialKeyCalculatorTest, keys)
+{
+    using detail::SpatialKeyCalculator;
+    auto calc_key = SpatialKeyCalculator::from_bbox(
+        BBox{{-1, -1, -1}, {1, 1, 1}});
+
+    // Morton order within a volume: offset by 1.5 grid cells
+    real_type const dx = real_type(1.5) * 2
+                         / (1 << SpatialKeyCalculator::pos_bits);
+    EXPECT_EQ(0, calc_key(VolumeId{0}, {-1, -1, -1}));
+    EXPECT_EQ(1, calc_key(VolumeId{0}, {-1 + dx, -1, -1}));
+    EXPECT_EQ(2, calc_key(VolumeId{0}, {-1, -1 + dx, -1}));
+    EXPECT_EQ(4, calc_key(VolumeId{0}, {-1, -1, -1 + dx}));
+    EXPECT_LT(calc_key(VolumeId{0}, {-0.5, -0.5, -0.5}),
+              calc_key(VolumeId{0}, {0.5, 0.5, 0.5}));
+
+    // Out-of-bounds positions are clamped
+    EXPECT_EQ(calc_key(VolumeId{0}, {-1, -1, -1}),
+              calc_key(VolumeId{0}, {-10, -10, -10}));
+    EXPECT_EQ(calc_key(VolumeId{0}, {1, 1, 1}),
+              calc_key(VolumeId{0}, {10, 10, 10}));
+
+    // Volume takes precedence over position
+    EXPECT_LT(calc_key(VolumeId{0}, {1, 1, 1}),
+              calc_key(VolumeId{1}, {-1, -1, -1}));
+    EXPECT_LT(calc_key(VolumeId{1}, {1, 1, 1}),
+              SpatialKeyCalculator::invalid_key);
+    EXPECT_EQ(0x9249249249ull, SpatialKeyCalculator::spread_bits(~0ull));
+
+    // Without the volume prefix, only position matters
+    auto calc_pos_key = SpatialKeyCalculator::from_bbox(
+        BBox{{-1, -1, -1}, {1, 1, 1}}, /* use_volume = */ false);
+    EXPECT_EQ(0, calc_pos_key(VolumeId{1}, {-1, -1, -1}));
+    EXPECT_EQ(calc_pos_key(VolumeId{0}, {0.5, 0.5, 0.5}),
+              calc_pos_key(VolumeId{3}, {0.5, 0.5, 0.5}));
+    EXPECT_LT(calc_pos_key(VolumeId{1}, {-1, -1, -1}),
+              calc_pos_key(VolumeId{0}, {1, 1, 1}));
+    EXPECT_EQ(calc_key(VolumeId{0}, {0.5, 0.5, 0.5}),
+              calc_pos_key(VolumeId{0}, {0.5, 0.5, 0.5}));
+}
+
+TEST_F(TestTrackSpatialEm3Stepper, host_is_sorted)
+{
+    // Initialize some primaries and take a few steps
+    auto step = this->make_stepper<MemSpace::host>(128);
+    auto primaries = this->make_primaries(8);
+    step(make_span(primaries));
+    for (auto i = 0; i < 4; ++i)
+    {
+        step();
+    }
+
+    auto const& params = *this->core();
+    auto& state = dynamic_cast<CoreState<MemSpace::host>&>(*step.sp_state());
+    auto calc_key = detail::SpatialKeyCalculator::from_bbox(
+        params.geometry()->bbox());
+    detail::sort_tracks_spatial(
+        params.ptr<MemSpace::host>(), state.ptr(), calc_key);
+
+    auto const& states = state.ref();
+    std::vector<detail::SpatialKeyCalculator::result_type> keys;
+    for (auto i : range(states.size()))
+    {
+        TrackSlotId slot{states.track_slots[ThreadId{i}]};
+        keys.push_back(detail::calc_spatial_key(
+            params.host_ref(), states, calc_key, slot));
+    }
+    EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+    EXPECT_NE(detail::SpatialKeyCalculator::invalid_key, keys.front());
+
+    // Transport continues with the sorting action
+    for (auto i = 0; i < 4; ++i)
+    {
+        step();
+    }
+}
+
+TEST_F(TestTrackSpatialActionEm3Stepper, host_is_sorted)
+{
+    // Spatial sort and action sort are both registered
+    EXPECT_TRUE(this->action_reg()->find_action("sort-tracks-spatial"));
+    EXPECT_TRUE(this->action_reg()->find_action("sort-tracks-post-step"));
+
+    auto step = this->make_stepper<MemSpace::host>(128);
+    auto primaries = this->make_primaries(8);
+    step(make_span(primaries));
+    for (auto i = 0; i < 4; ++i)
+    {
+        step();
+    }
+
+    // Sorting by action preserves the spatial order within each action
+    auto const& params = *this->core();
+    auto& state = dynamic_cast<CoreState<MemSpace::host>&>(*step.sp_state());
+    auto calc_key = detail::SpatialKeyCalculator::from_bbox(
+        params.geometry()->bbox());
+    detail::sort_tracks_spatial(
+        params.ptr<MemSpace::host>(), state.ptr(), calc_key);
+    detail::sort_tracks(
+        state.ref(),
+        TrackOrder::reindex_step_limit_action,
+        state.action_thread_offsets()[AllItems<ThreadId, MemSpace::host>{}]);
+
+    auto const& states = state.ref();
+    auto const& offsets = state.action_thread_offsets();
+    size_type num_threads{0};
+    for (auto a : range(offsets.size() - 1))
+    {
+        Range<ThreadId> threads{offsets[ActionId{a}],
+                                offsets[ActionId{a + 1}]};
+        std::vector<detail::SpatialKeyCalculator::result_type> keys;
+        for (ThreadId tid : threads)
+        {
+            TrackSlotId slot{states.track_slots[tid]};
+            EXPECT_EQ(ActionId{a}, states.sim.post_step_action[slot]);
+            keys.push_back(detail::calc_spatial_key(
+                params.host_ref(), states, calc_key, slot));
+        }
+        EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()))
+            << "for action " << a;
+        num_threads += threads.size();
+    }
+    EXPECT_LT(0, num_threads);
+
+    for (auto i = 0; i < 4; ++i)
+    {
+        step();
+    }
+}
+
 TEST_F(TestTrackSortActionIdEm3Stepper, host_is_sorted)
 {
     // Initialize some primaries and take a step
@@ -385,6 +551,54 @@ TEST_F(TestTrackSortActionIdEm3Stepper, host_is_sorted)
     }
 }
 
+TEST_F(TestTrackSortActionIdEm3Stepper, host_permute)
+{
+    if (CELERITAS_CORE_GEO != CELERITAS_CORE_GEO_ORANGE)
+    {
+        GTEST_SKIP() << "state permutation requires ORANGE";
+    }
+
+    // Initialize some primaries and take a few steps
+    auto step = this->make_stepper<MemSpace::host>(128);
+    auto primaries = this->make_primaries(8);
+    step(make_span(primaries));
+    for (auto i = 0; i < 4; ++i)
+    {
+        step();
+    }
+
+    auto const& states = step.state_ref();
+    auto get_track_ids = [&states] {
+        // Get the track ID in each thread
+        std::vector<TrackId::size_type> result;
+        for (auto i : range(states.size()))
+        {
+            TrackSlotId slot{states.track_slots[ThreadId{i}]};
+            result.push_back(states.sim.track_ids[slot].unchecked_get());
+        }
+        return result;
+    };
+
+    detail::sort_tracks(states, TrackOrder::reindex_step_limit_action);
+    auto expected_track_ids = get_track_ids();
+    EXPECT_LT(0, detail::calc_fragmentation(states));
+
+    // Permuting preserves the tracks in each thread
+    detail::permute_tracks(states);
+    EXPECT_EQ(0, detail::calc_fragmentation(states));
+    EXPECT_VEC_EQ(expected_track_ids, get_track_ids());
+    for (auto i : range(states.size()))
+    {
+        EXPECT_EQ(i, states.track_slots[ThreadId{i}]);
+    }
+
+    // Transport continues from the permuted states
+    for (auto i = 0; i < 4; ++i)
+    {
+        step();
+    }
+}
+
 TEST_F(TestTrackSortActionIdEm3Stepper, TEST_IF_CELER_DEVICE(device_is_sorted))
 {
     // Initialize some primaries and take a step
@@ -446,7 +660,9 @@ TEST_F(TestActionCountEm3StepperH, host_count_actions)
     // can't access the collection in CoreState, so test do the counting in a
     // temporary instead
     HostActionThreads buffer;
+    HostActionThreads sorted_buffer;
     resize(&buffer, num_actions + 1);
+    resize(&sorted_buffer, num_actions + 1);
 
     auto loop = [&] {
         detail::sort_tracks(step.state_ref(),
@@ -457,6 +673,15 @@ TEST_F(TestActionCountEm3StepperH, host_count_actions)
                                         TrackOrder::reindex_step_limit_action);
 
         check_action_count(buffer, step.state().size());
+
+        // Sorting again must give the same offsets as counting
+        detail::sort_tracks(step.state_ref(),
+                            TrackOrder::reindex_step_limit_action,
+                            sorted_buffer[AllActionThreads{}]);
+        for (auto i : range(buffer.size()))
+        {
+            EXPECT_EQ(buffer[ActionId{i}], sorted_buffer[ActionId{i}]);
+        }
         step();
     };
 
@@ -0,0 +1,211 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/UserLimits.test.cc
+//---------------------------------------------------------------------------//
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/io/OutputInterface.hh"
+#include "geocel/UnitUtils.hh"
+#include "celeritas/geo/GeoParams.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
+#include "celeritas/global/Stepper.hh"
+#include "celeritas/io/ImportData.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/Primary.hh"
+#include "celeritas/track/UserLimitsAction.hh"
+#include "celeritas/track/UserLimitsParams.hh"
+
+#include "celeritas_test.hh"
+#include "../SimpleTestBase.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+class UserLimitsTest : public SimpleTestBase
+{
+  protected:
+    using Energy = units::MevEnergy;
+
+    void SetUp() override
+    {
+        inner_ = this->geometry()->volumes().find_unique("inner");
+        ASSERT_TRUE(inner_);
+    }
+
+    //! Imported data with user limits in the inner box region
+    ImportData make_import(ImportUserLimits const& limits) const
+    {
+        ImportData result;
+        result.regions.resize(2);
+        result.regions[0].name = "DefaultRegionForTheWorld";
+        result.regions[1].name = "inner_region";
+        result.regions[1].user_limits = true;
+        result.regions[1].limits = limits;
+
+        result.volumes.resize(2);
+        result.volumes[0].name = "inner";
+        result.volumes[0].geo_material_id = 0;
+        result.volumes[0].region_id = 1;
+        result.volumes[1].name = "world";
+        result.volumes[1].geo_material_id = 1;
+        result.volumes[1].region_id = 0;
+        return result;
+    }
+
+    std::shared_ptr<UserLimitsAction> make_action(ImportUserLimits const& ul)
+    {
+        auto params = UserLimitsParams::from_import(this->make_import(ul),
+                                                    *this->geometry());
+        CELER_ASSERT(params);
+        return UserLimitsAction::make_and_insert(*this->core(),
+                                                 std::move(params));
+    }
+
+    std::vector<Primary> make_primaries(size_type count, Energy energy) const
+    {
+        Primary p;
+        p.particle_id = this->particle()->find(pdg::gamma());
+        p.energy = energy;
+        p.position = from_cm({0, 0, 0});
+        p.direction = {0, 0, 1};
+        p.event_id = EventId{0};
+        return std::vector<Primary>(count, p);
+    }
+
+    StepperInput make_stepper_input() const
+    {
+        StepperInput inp;
+        inp.params = this->core();
+        inp.stream_id = StreamId{0};
+        inp.num_track_slots = 8;
+        return inp;
+    }
+
+    VolumeId inner_;
+};
+
+TEST_F(UserLimitsTest, from_import)
+{
+    // No limits
+    EXPECT_FALSE(UserLimitsParams::from_import(
+        this->make_import(ImportUserLimits{}), *this->geometry()));
+
+    ImportUserLimits ul;
+    ul.min_kinetic_energy = 1.5;
+    ul.max_time = 1e-6;
+    auto params = UserLimitsParams::from_import(this->make_import(ul),
+                                                *this->geometry());
+    ASSERT_TRUE(params);
+    EXPECT_EQ(1, params->num_limits());
+
+    auto const& data = params->host_ref();
+    auto const num_volumes = this->geometry()->volumes().size();
+    ASSERT_EQ(num_volumes, data.volume_limits.size());
+    for (auto vid : range(VolumeId{num_volumes}))
+    {
+        EXPECT_EQ(vid == inner_ ? UserLimitsId{0} : UserLimitsId{},
+                  data.volume_limits[vid]);
+    }
+    UserLimits const& limits = data.limits[UserLimitsId{0}];
+    EXPECT_SOFT_EQ(1.5, limits.min_energy.value());
+    EXPECT_SOFT_EQ(1e-6, limits.max_time);
+    EXPECT_EQ(numeric_limits<real_type>::infinity(), limits.max_track_length);
+}
+
+TEST_F(UserLimitsTest, min_energy)
+{
+    ImportUserLimits ul;
+    ul.min_kinetic_energy = 20;
+    auto action = this->make_action(ul);
+
+    Stepper<MemSpace::host> step(this->make_stepper_input());
+    auto primaries = this->make_primaries(4, Energy{10});
+    auto counts = step(make_span(primaries));
+    EXPECT_EQ(4, counts.active);
+    EXPECT_EQ(0, counts.alive);
+    EXPECT_EQ(0, counts.queued);
+
+    auto tally = action->calc_tally();
+    ASSERT_EQ(1, tally.energy.size());
+    EXPECT_SOFT_EQ(40, tally.energy[0]);
+    EXPECT_EQ(4, tally.num_killed[0]);
+    EXPECT_JSON_EQ(
+        R"json({"_category":"result","_index":["limits"],"_label":"user-limits","_units":{"energy":"MeV"},"energy":[40.0],"num_killed":[4]})json",
+        to_string(*action));
+
+    action->clear();
+    tally = action->calc_tally();
+    EXPECT_EQ(0, tally.energy[0]);
+    EXPECT_EQ(0, tally.num_killed[0]);
+}
+
+TEST_F(UserLimitsTest, max_time)
+{
+    ImportUserLimits ul;
+    ul.max_time = 1e-9;
+    auto action = this->make_action(ul);
+
+    Stepper<MemSpace::host> step(this->make_stepper_input());
+    auto primaries = this->make_primaries(4, Energy{10});
+    primaries[1].time = 1e-8;
+    primaries[3].time = 1e-8;
+    auto counts = step(make_span(primaries));
+    EXPECT_EQ(4, counts.active);
+    EXPECT_EQ(2, counts.alive);
+
+    auto tally = action->calc_tally();
+    EXPECT_SOFT_EQ(20, tally.energy[0]);
+    EXPECT_EQ(2, tally.num_killed[0]);
+}
+
+TEST_F(UserLimitsTest, max_track_length)
+{
+    ImportUserLimits ul;
+    ul.max_track_length = 1e-3;
+    auto action = this->make_action(ul);
+
+    // Start outside the limited volume, heading toward it
+    Stepper<MemSpace::host> step(this->make_stepper_input());
+    auto primaries = this->make_primaries(1, Energy{10});
+    primaries.front().position = from_cm({0, 0, -10});
+    auto counts = step(make_span(primaries));
+    ASSERT_EQ(1, counts.alive);
+
+    // The first step ends on the boundary of the limited volume
+    auto const& sim
+        = dynamic_cast<CoreState<MemSpace::host> const&>(step.state())
+              .ref()
+              .sim;
+    TrackSlotId slot;
+    for (auto i : range(TrackSlotId{sim.size()}))
+    {
+        if (sim.status[i] == TrackStatus::alive)
+        {
+            slot = i;
+        }
+    }
+    ASSERT_TRUE(slot);
+    EXPECT_SOFT_EQ(from_cm(5), sim.track_length[slot]);
+    EXPECT_EQ(0, action->calc_tally().num_killed[0]);
+
+    // The track is killed at the start of the next step
+    counts = step();
+    EXPECT_EQ(0, counts.alive);
+    auto tally = action->calc_tally();
+    EXPECT_SOFT_EQ(10, tally.energy[0]);
+    EXPECT_EQ(1, tally.num_killed[0]);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
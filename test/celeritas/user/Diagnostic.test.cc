@@ -5,9 +5,12 @@
 //---------------------------------------------------------------------------//
 //! \file celeritas/user/Diagnostic.test.cc
 //---------------------------------------------------------------------------//
+#include <numeric>
+
 #include "corecel/Config.hh"
 
 #include "corecel/cont/Span.hh"
+#include "corecel/io/OutputInterface.hh"
 #include "corecel/io/StringUtils.hh"
 #include "corecel/sys/ActionRegistry.hh"
 #include "geocel/UnitUtils.hh"
@@ -18,6 +21,7 @@
 #include "celeritas/phys/PDGNumber.hh"
 #include "celeritas/phys/ParticleParams.hh"
 #include "celeritas/phys/Primary.hh"
+#include "celeritas/user/SamplingDiagnostic.hh"
 
 #include "DiagnosticTestBase.hh"
 #include "TestMacros.hh"
@@ -103,6 +107,25 @@ class TestEm3DiagnosticTest : public TestEm3Base, public DiagnosticTestBase
     }
 };
 
+//---------------------------------------------------------------------------//
+
+class SimpleComptonSamplingTest : public SimpleComptonDiagnosticTest
+{
+  public:
+    void SetUp() override
+    {
+        SimpleComptonDiagnosticTest::SetUp();
+        if (CELERITAS_SAMPLING_COUNTERS)
+        {
+            sampling_diagnostic_
+                = SamplingDiagnostic::make_and_insert(*this->core(), 8);
+        }
+    }
+
+  protected:
+    std::shared_ptr<SamplingDiagnostic> sampling_diagnostic_;
+};
+
 //---------------------------------------------------------------------------//
 // SIMPLE COMPTON
 //---------------------------------------------------------------------------//
@@ -130,6 +153,41 @@ TEST_F(SimpleComptonDiagnosticTest, host)
     }
 }
 
+TEST_F(SimpleComptonSamplingTest, host)
+{
+    if (!CELERITAS_SAMPLING_COUNTERS)
+    {
+        EXPECT_THROW(SamplingDiagnostic::make_and_insert(*this->core(), 8),
+                     RuntimeError);
+        GTEST_SKIP() << "CELERITAS_SAMPLING_COUNTERS is disabled";
+    }
+    ASSERT_TRUE(sampling_diagnostic_);
+
+    this->run<MemSpace::host>(256, 32);
+
+    auto kn_action = this->action_reg()->find_action("scat-klein-nishina");
+    ASSERT_TRUE(kn_action);
+    auto sum = [](std::vector<size_type> const& v) {
+        return std::accumulate(v.begin(), v.end(), size_type{0});
+    };
+
+    // Every interaction draws at least one random number
+    auto draws = sampling_diagnostic_->calc_draws();
+    ASSERT_EQ(this->action_reg()->num_actions(), draws.size());
+    auto const& kn_draws = draws[kn_action.unchecked_get()];
+    ASSERT_EQ(8, kn_draws.size());
+    EXPECT_EQ(0, kn_draws.front());
+    EXPECT_LT(0, sum(kn_draws));
+
+    // Each sampled interaction is binned once by rejection iterations
+    auto iterations = sampling_diagnostic_->calc_iterations();
+    EXPECT_EQ(sum(kn_draws), sum(iterations[kn_action.unchecked_get()]));
+
+    auto output = to_string(*sampling_diagnostic_);
+    EXPECT_NE(std::string::npos, output.find("\"scat-klein-nishina\""))
+        << output;
+}
+
 //---------------------------------------------------------------------------//
 // TESTEM3
 //---------------------------------------------------------------------------//
@@ -7,6 +7,9 @@
 //---------------------------------------------------------------------------//
 #include "celeritas/user/StepCollector.hh"
 
+#include <fstream>
+#include <nlohmann/json.hpp>
+
 #include "corecel/cont/Span.hh"
 #include "corecel/io/LogContextException.hh"
 #include "corecel/sys/ActionRegistry.hh"
@@ -245,6 +248,45 @@ TEST_F(KnCaloTest, single_track)
     }
 }
 
+TEST_F(KnCaloTest, end_event)
+{
+    std::string basename = this->make_unique_filename("-");
+    calo_->set_event_output(basename);
+
+    // Transport one event and reduce it
+    this->run_impl<MemSpace::host>(1, 64);
+    collector_->end_event(StreamId{0}, EventId{0});
+    auto first = calo_->event_energy_deposition(StreamId{0});
+    ASSERT_EQ(1, first.size());
+    EXPECT_VEC_SOFT_EQ(first, calo_->calc_total_energy_deposition());
+
+    // Stream state was reset: an empty event deposits nothing
+    collector_->end_event(StreamId{0}, EventId{1});
+    EXPECT_VEC_EQ(std::vector<real_type>{0},
+                  calo_->event_energy_deposition(StreamId{0}));
+    EXPECT_VEC_SOFT_EQ(first, calo_->calc_total_energy_deposition());
+
+    // Each event is written as a line
+    std::ifstream infile(basename + "0.jsonl");
+    ASSERT_TRUE(infile) << "failed to open " << basename << "0.jsonl";
+    std::vector<int> events;
+    std::vector<double> edep;
+    for (std::string line; std::getline(infile, line);)
+    {
+        auto j = nlohmann::json::parse(line);
+        events.push_back(j.at("event").get<int>());
+        edep.push_back(j.at("energy_deposition").at(0).get<double>());
+    }
+    static int const expected_events[] = {0, 1};
+    EXPECT_VEC_EQ(expected_events, events);
+    std::vector<double> expected_edep{first.front(), 0};
+    EXPECT_VEC_SOFT_EQ(expected_edep, edep);
+
+    calo_->clear();
+    EXPECT_VEC_EQ(std::vector<real_type>{0},
+                  calo_->calc_total_energy_deposition());
+}
+
 //---------------------------------------------------------------------------//
 // TESTEM3
 //---------------------------------------------------------------------------//
@@ -0,0 +1,125 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/HostWorkerPool.test.cc
+//---------------------------------------------------------------------------//
+#include "corecel/sys/HostWorkerPool.hh"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+class HostWorkerPoolTest : public ::celeritas::test::Test
+{
+  protected:
+    //! Count the number of times each index is executed
+    std::vector<int>
+    count_executions(HostWorkerPool& pool, size_type size, size_type chunk)
+    {
+        std::vector<std::atomic<int>> counts(size);
+        pool(size, chunk, [&counts, chunk](size_type begin, size_type end) {
+            EXPECT_LT(begin, end);
+            EXPECT_LE(end - begin, chunk);
+            for (auto i : range(begin, end))
+            {
+                ++counts[i];
+            }
+        });
+        return {counts.begin(), counts.end()};
+    }
+};
+
+TEST_F(HostWorkerPoolTest, single)
+{
+    HostWorkerPool pool(1);
+    EXPECT_EQ(1, pool.num_threads());
+
+    auto counts = this->count_executions(pool, 100, 100);
+    EXPECT_EQ(std::vector<int>(100, 1), counts);
+}
+
+TEST_F(HostWorkerPoolTest, multi)
+{
+    HostWorkerPool pool(4);
+    EXPECT_EQ(4, pool.num_threads());
+
+    // Repeat launches to exercise the spin and park paths
+    for (size_type size : {0u, 1u, 10u, 64u, 65u, 1000u, 4097u})
+    {
+        for (size_type chunk : {1u, 7u, 64u})
+        {
+            auto counts = this->count_executions(pool, size, chunk);
+            EXPECT_EQ(std::vector<int>(size, 1), counts)
+                << "size=" << size << ", chunk=" << chunk;
+        }
+    }
+}
+
+TEST_F(HostWorkerPoolTest, threads)
+{
+    HostWorkerPool pool(3);
+
+    // Make each chunk wait for all threads so every thread gets work
+    std::atomic<int> num_waiting{0};
+    std::mutex ids_mutex;
+    std::set<std::thread::id> ids;
+    pool(3, 1, [&](size_type, size_type) {
+        {
+            std::lock_guard<std::mutex> lock(ids_mutex);
+            ids.insert(std::this_thread::get_id());
+        }
+        ++num_waiting;
+        while (num_waiting.load() < 3)
+        {
+            std::this_thread::yield();
+        }
+    });
+    EXPECT_EQ(3, ids.size());
+    EXPECT_EQ(1, ids.count(std::this_thread::get_id()));
+}
+
+TEST_F(HostWorkerPoolTest, nested)
+{
+    HostWorkerPool pool(2);
+
+    // A launch from inside a launch executes on the calling thread
+    std::atomic<int> count{0};
+    pool(4, 1, [&](size_type, size_type) {
+        pool(10, 1, [&](size_type begin, size_type end) {
+            EXPECT_EQ(0, begin);
+            EXPECT_EQ(10, end);
+            count += end - begin;
+        });
+    });
+    EXPECT_EQ(40, count.load());
+}
+
+TEST_F(HostWorkerPoolTest, idle)
+{
+    HostWorkerPool pool(2);
+    pool(100, 1, [](size_type, size_type) {});
+
+    // Let workers park, then wake them up again
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    auto counts = this->count_executions(pool, 100, 3);
+    EXPECT_EQ(std::vector<int>(100, 1), counts);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
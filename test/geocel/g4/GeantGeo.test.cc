@@ -6,6 +6,7 @@
 //! \file geocel/g4/GeantGeo.test.cc
 //---------------------------------------------------------------------------//
 #include <string_view>
+#include <thread>
 #include <G4LogicalVolume.hh>
 
 #include "corecel/Config.hh"
@@ -291,6 +292,34 @@ TEST_F(FourLevelsTest, tracking)
 
 //---------------------------------------------------------------------------//
 
+TEST_F(FourLevelsTest, thread)
+{
+    // Navigate on a thread that is not managed by Geant4
+    TrackingResult result;
+    std::thread worker([&] {
+        detail::initialize_geant_geo_thread();
+        result = this->track({-10, -10, -10}, {1, 0, 0});
+    });
+    worker.join();
+
+    static char const* const expected_volumes[] = {"Shape2",
+                                                   "Shape1",
+                                                   "Envelope",
+                                                   "World",
+                                                   "Envelope",
+                                                   "Shape1",
+                                                   "Shape2",
+                                                   "Shape1",
+                                                   "Envelope",
+                                                   "World"};
+    EXPECT_VEC_EQ(expected_volumes, result.volumes);
+    static real_type const expected_distances[]
+        = {5, 1, 1, 6, 1, 1, 10, 1, 1, 7};
+    EXPECT_VEC_SOFT_EQ(expected_distances, result.distances);
+}
+
+//---------------------------------------------------------------------------//
+
 TEST_F(FourLevelsTest, safety)
 {
     auto geo = this->make_geo_track_view();
@@ -0,0 +1,155 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/OrangeBinaryIO.test.cc
+//---------------------------------------------------------------------------//
+#include "orange/OrangeBinaryIO.hh"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <nlohmann/json.hpp>
+
+#include "orange/OrangeInputIO.json.hh"
+#include "orange/OrangeParams.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+class OrangeBinaryIOTest : public ::celeritas::test::Test
+{
+  protected:
+    OrangeInput load_json(std::string const& basename)
+    {
+        OrangeInput result;
+        std::ifstream infile(
+            this->test_data_path("orange", basename + ".org.json"));
+        CELER_VALIDATE(infile, << "failed to open " << basename);
+        infile >> result;
+        return result;
+    }
+
+    static std::string to_json_string(OrangeInput const& inp)
+    {
+        return nlohmann::json(inp).dump();
+    }
+};
+
+TEST_F(OrangeBinaryIOTest, round_trip)
+{
+    for (std::string basename : {"five-volumes",
+                                 "universes",
+                                 "rect-array",
+                                 "nested-rect-arrays",
+                                 "inputbuilder-hierarchy",
+                                 "testem3"})
+    {
+        SCOPED_TRACE(basename);
+        auto inp = this->load_json(basename);
+
+        std::stringstream ss;
+        write_binary(ss, inp);
+        auto result = read_binary(ss);
+
+        EXPECT_EQ(inp.tol.rel, result.tol.rel);
+        EXPECT_EQ(inp.tol.abs, result.tol.abs);
+        EXPECT_EQ(to_json_string(inp), to_json_string(result));
+    }
+}
+
+TEST_F(OrangeBinaryIOTest, streaming)
+{
+    auto inp = this->load_json("universes");
+
+    // Add data that isn't written to JSON
+    auto& unit = std::get<UnitInput>(inp.universes.front());
+    auto& obz = unit.volumes.back().obz;
+    obz.inner = BBox{{-1, -2, -3}, {1, 2, 3}};
+    obz.outer = BBox{{-2, -3, -4}, {2, 3, 4}};
+    obz.transform_id = TransformId{2};
+
+    std::stringstream ss;
+    {
+        OrangeBinaryWriter write{&ss, inp.tol, inp.universes.size()};
+        for (auto const& u : inp.universes)
+        {
+            EXPECT_FALSE(write.finished());
+            write(u);
+        }
+        EXPECT_TRUE(write.finished());
+    }
+
+    OrangeBinaryReader read{&ss};
+    EXPECT_EQ(inp.universes.size(), read.num_universes());
+    EXPECT_EQ(inp.tol.abs, read.tol().abs);
+
+    auto first = read();
+    EXPECT_FALSE(read.finished());
+    auto const* first_unit = std::get_if<UnitInput>(&first);
+    ASSERT_TRUE(first_unit);
+    EXPECT_EQ(unit.label, first_unit->label);
+    ASSERT_EQ(unit.volumes.size(), first_unit->volumes.size());
+    auto const& result_obz = first_unit->volumes.back().obz;
+    EXPECT_EQ(obz.inner, result_obz.inner);
+    EXPECT_EQ(obz.outer, result_obz.outer);
+    EXPECT_EQ(obz.transform_id, result_obz.transform_id);
+
+    while (!read.finished())
+    {
+        read();
+    }
+    EXPECT_EQ(std::stringstream::traits_type::eof(), ss.peek());
+}
+
+TEST_F(OrangeBinaryIOTest, errors)
+{
+    auto inp = this->load_json("five-volumes");
+    std::string data;
+    {
+        std::ostringstream os;
+        write_binary(os, inp);
+        data = os.str();
+    }
+
+    // Not a binary file
+    {
+        std::istringstream is{nlohmann::json(inp).dump()};
+        EXPECT_THROW(read_binary(is), RuntimeError);
+    }
+    // Unknown version
+    {
+        auto bad_data = data;
+        bad_data[8] = 127;
+        std::istringstream is{bad_data};
+        EXPECT_THROW(read_binary(is), RuntimeError);
+    }
+    // Truncated
+    {
+        std::istringstream is{data.substr(0, data.size() - 4)};
+        EXPECT_THROW(read_binary(is), RuntimeError);
+    }
+}
+
+TEST_F(OrangeBinaryIOTest, params)
+{
+    auto filename = this->make_unique_filename(".org.bin");
+    {
+        std::ofstream outfile(filename, std::ios::out | std::ios::binary);
+        write_binary(outfile, this->load_json("universes"));
+    }
+
+    OrangeParams params{filename};
+    EXPECT_EQ(3, params.universes().size());
+    EXPECT_EQ(1, params.times().count("load_binary"));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
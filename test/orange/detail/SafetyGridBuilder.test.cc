@@ -0,0 +1,143 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/SafetyGridBuilder.test.cc
+//---------------------------------------------------------------------------//
+#include "orange/detail/SafetyGridBuilder.hh"
+
+#include <cmath>
+#include <random>
+
+#include "corecel/cont/Span.hh"
+#include "corecel/io/Repr.hh"
+#include "corecel/math/ArrayUtils.hh"
+#include "orange/OrangeGeoTestBase.hh"
+#include "orange/univ/detail/SafetyGridCalculator.hh"
+#include "celeritas/Constants.hh"
+#include "celeritas/random/distribution/UniformBoxDistribution.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+class SafetyGridBuilderTest : public ::celeritas::test::OrangeGeoTestBase
+{
+  protected:
+    using Options = SafetyGridBuilder::Options;
+    using Result = SafetyGridBuilder::Result;
+
+    void SetUp() override
+    {
+        TwoVolInput geo_inp;
+        geo_inp.radius = 1.5;
+        this->build_geometry(geo_inp);
+    }
+
+    //! Build a grid around the sphere with a fixed number of nodes
+    Result build(size_type max_nodes, real_type spacing = 0) const
+    {
+        Options opts;
+        opts.max_memory = max_nodes * sizeof(real_type);
+        opts.spacing = spacing;
+        SafetyGridBuilder build_grid{this->host_params(), opts};
+        return build_grid(SimpleUnitId{0}, BBox{{-2, -2, -2}, {2, 2, 2}});
+    }
+};
+
+TEST_F(SafetyGridBuilderTest, unbuildable)
+{
+    Options opts;
+    opts.max_memory = 1000 * sizeof(real_type);
+    SafetyGridBuilder build_grid{this->host_params(), opts};
+    EXPECT_FALSE(build_grid(SimpleUnitId{0}, BBox::from_infinite()));
+    EXPECT_FALSE(build_grid(SimpleUnitId{0}, BBox{}));
+    EXPECT_FALSE(build_grid(SimpleUnitId{0}, BBox{{0, 0, 0}, {1, 1, 0}}));
+
+    EXPECT_FALSE(this->build(7));
+}
+
+TEST_F(SafetyGridBuilderTest, dims)
+{
+    {
+        // Memory-limited
+        auto result = this->build(1000);
+        ASSERT_TRUE(result);
+        auto const& grid = result.grid;
+        EXPECT_EQ((SafetyGridRecord::Dims{10, 10, 10}), grid.dims);
+        EXPECT_EQ(1000, result.values.size());
+        EXPECT_VEC_SOFT_EQ((Real3{-2, -2, -2}), grid.origin);
+        EXPECT_VEC_SOFT_EQ((Real3{2.25, 2.25, 2.25}), grid.inv_delta);
+        EXPECT_SOFT_EQ(4 * constants::sqrt_three / 9, grid.diagonal);
+
+        // Corner node is outside the sphere
+        EXPECT_SOFT_EQ(2 * constants::sqrt_three - 1.5, result.values.front());
+        EXPECT_SOFT_EQ(2 * constants::sqrt_three - 1.5, result.values.back());
+    }
+    {
+        // Spacing-limited
+        auto result = this->build(1000, 1.0);
+        ASSERT_TRUE(result);
+        EXPECT_EQ((SafetyGridRecord::Dims{5, 5, 5}), result.grid.dims);
+        EXPECT_SOFT_EQ(constants::sqrt_three, result.grid.diagonal);
+
+        // Node inside the sphere
+        EXPECT_SOFT_EQ(0.5, result.values[2 * 25 + 2 * 5 + 3]);
+        // Safety is undefined at the sphere center
+        EXPECT_EQ(0, result.values[2 * 25 + 2 * 5 + 2]);
+    }
+}
+
+TEST_F(SafetyGridBuilderTest, conservative)
+{
+    auto result = this->build(32768);
+    ASSERT_TRUE(result);
+    EXPECT_EQ((SafetyGridRecord::Dims{32, 32, 32}), result.grid.dims);
+    result.grid.values = ItemRange<real_type>(ItemId<real_type>{0},
+                                              ItemId<real_type>(32768));
+
+    SafetyGridCalculator calc_safety{result.grid, make_span(result.values)};
+
+    // Outside the grid
+    EXPECT_EQ(0, calc_safety({-2.5, 0, 0}));
+    EXPECT_EQ(0, calc_safety({0, 0, 2.01}));
+
+    // At nodes
+    EXPECT_SOFT_EQ(2 * constants::sqrt_three - 1.5 - result.grid.diagonal,
+                   calc_safety({-2, -2, -2}));
+    EXPECT_SOFT_EQ(2 * constants::sqrt_three - 1.5 - result.grid.diagonal,
+                   calc_safety({2, 2, 2}));
+
+    // Random points must never exceed the true safety
+    std::mt19937 rng;
+    UniformBoxDistribution<> sample_pos{{-2, -2, -2}, {2, 2, 2}};
+    size_type num_positive{0};
+    size_type num_samples{1000};
+    double sum_fraction{0};
+    for ([[maybe_unused]] auto i : range(num_samples))
+    {
+        Real3 pos = sample_pos(rng);
+        real_type exact = std::fabs(norm(pos) - real_type(1.5));
+        real_type bound = calc_safety(pos);
+        EXPECT_LE(bound, exact * (1 + 1e-6)) << "at " << repr(pos);
+        if (bound > 0)
+        {
+            ++num_positive;
+            sum_fraction += bound / exact;
+        }
+    }
+    EXPECT_EQ(800, num_positive);
+    EXPECT_SOFT_NEAR(0.608, sum_fraction / num_positive, 0.01);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace detail
+}  // namespace celeritas
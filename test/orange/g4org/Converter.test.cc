@@ -114,13 +114,13 @@ TEST_F(ConverterTest, testem3)
     auto result = convert(this->load_test_gdml(basename)).input;
     write_org_json(result, basename);
 
-    ASSERT_EQ(2, result.universes.size());
+    ASSERT_EQ(4, result.universes.size());
     if (auto* unit = std::get_if<UnitInput>(&result.universes[0]))
     {
         SCOPED_TRACE("universe 0");
         EXPECT_EQ("World0x0", this->genericize_pointers(unit->label.name));
-        EXPECT_EQ(53, unit->volumes.size());
-        EXPECT_EQ(61, unit->surfaces.size());
+        EXPECT_EQ(4, unit->volumes.size());
+        EXPECT_EQ(12, unit->surfaces.size());
         EXPECT_VEC_SOFT_EQ((Real3{-24, -24, -24}), to_cm(unit->bbox.lower()));
         EXPECT_VEC_SOFT_EQ((Real3{24, 24, 24}), to_cm(unit->bbox.upper()));
     }
@@ -129,9 +129,37 @@ TEST_F(ConverterTest, testem3)
         FAIL() << "wrong universe variant";
     }
 
-    if (auto* unit = std::get_if<UnitInput>(&result.universes[1]))
+    // Layers are merged into a lattice of identical cells
+    if (auto* arr = std::get_if<RectArrayInput>(&result.universes[1]))
     {
         SCOPED_TRACE("universe 1");
+        EXPECT_EQ("Layer0x0", this->genericize_pointers(arr->label.name));
+        EXPECT_EQ(51, arr->grid[0].size());
+        EXPECT_EQ(2, arr->grid[1].size());
+        EXPECT_EQ(2, arr->grid[2].size());
+        EXPECT_EQ(50, arr->daughters.size());
+    }
+    else
+    {
+        FAIL() << "wrong universe variant";
+    }
+
+    if (auto* unit = std::get_if<UnitInput>(&result.universes[2]))
+    {
+        SCOPED_TRACE("universe 2");
+        EXPECT_EQ("Layer0x0.cell",
+                  this->genericize_pointers(unit->label.name));
+        EXPECT_VEC_SOFT_EQ((Real3{-0.4, -20, -20}), to_cm(unit->bbox.lower()));
+        EXPECT_VEC_SOFT_EQ((Real3{0.4, 20, 20}), to_cm(unit->bbox.upper()));
+    }
+    else
+    {
+        FAIL() << "wrong universe variant";
+    }
+
+    if (auto* unit = std::get_if<UnitInput>(&result.universes[3]))
+    {
+        SCOPED_TRACE("universe 3");
         EXPECT_EQ("Layer0x0", genericize_pointers(unit->label.name));
         EXPECT_EQ(4, unit->volumes.size());
         EXPECT_EQ(1, unit->surfaces.size());
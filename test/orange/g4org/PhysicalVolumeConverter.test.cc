@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #include "orange/g4org/PhysicalVolumeConverter.hh"
 
+#include <numeric>
+
 #include "corecel/io/StreamableVariant.hh"
 #include "corecel/sys/Environment.hh"
 #include "geocel/GeantGeoUtils.hh"
@@ -141,27 +143,32 @@ TEST_F(PhysicalVolumeConverterTest, testem3)
     {
         // Test calorimeter
         EXPECT_EQ("Calorimeter0x0", this->genericize_pointers(lv->name));
-        ASSERT_EQ(50, lv->children.size());
-
-        auto const& first_layer = lv->children.front();
-        EXPECT_EQ(1, first_layer.copy_number);
-        EXPECT_EQ(50, first_layer.lv.use_count());
-        if (auto* trans = std::get_if<Translation>(&first_layer.transform))
-        {
-            EXPECT_VEC_SOFT_EQ((Real3{-19.6, 0, 0}), trans->translation());
-        }
-        else
-        {
-            ADD_FAILURE() << "Unexpected transform type: "
-                          << StreamableVariant{first_layer.transform};
-        }
-
-        auto const& last_layer = lv->children.back();
-        EXPECT_EQ(50, last_layer.copy_number);
-        EXPECT_EQ(first_layer.lv.get(), last_layer.lv.get());
+        ASSERT_EQ(1, lv->children.size());
 
-        ASSERT_TRUE(first_layer.lv);
-        lv = first_layer.lv.get();
+        // Layers are merged into a lattice that keeps their copy numbers
+        auto const& layers = lv->children.front();
+        ASSERT_TRUE(layers.lattice);
+        EXPECT_EQ(lv, layers.lattice.parent);
+        EXPECT_EQ(1, layers.copy_number);
+        EXPECT_EQ(1, layers.lv.use_count());
+        EXPECT_TRUE(std::holds_alternative<NoTransformation>(layers.transform))
+            << StreamableVariant{layers.transform};
+
+        auto const& grid = layers.lattice.grid;
+        ASSERT_EQ(51, grid[0].size());
+        EXPECT_SOFT_EQ(-20, grid[0].front());
+        EXPECT_SOFT_EQ(-19.2, grid[0][1]);
+        EXPECT_SOFT_EQ(20, grid[0].back());
+        EXPECT_VEC_SOFT_EQ((std::vector<real_type>{-20, 20}), grid[1]);
+        EXPECT_VEC_SOFT_EQ((std::vector<real_type>{-20, 20}), grid[2]);
+
+        std::vector<size_type> expected_copy_numbers(50);
+        std::iota(
+            expected_copy_numbers.begin(), expected_copy_numbers.end(), 1);
+        EXPECT_VEC_EQ(expected_copy_numbers, layers.lattice.copy_numbers);
+
+        ASSERT_TRUE(layers.lv);
+        lv = layers.lv.get();
     }
     {
         // Test layer
@@ -0,0 +1,155 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/orangeinp/RectArrayProto.test.cc
+//---------------------------------------------------------------------------//
+#include "orange/orangeinp/RectArrayProto.hh"
+
+#include <memory>
+
+#include "orange/OrangeInput.hh"
+#include "orange/OrangeParams.hh"
+#include "orange/orangeinp/InputBuilder.hh"
+#include "orange/orangeinp/Shape.hh"
+#include "orange/orangeinp/UnitProto.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace orangeinp
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+using SPConstProto = std::shared_ptr<ProtoInterface const>;
+
+//! Construct a cell containing a sphere surrounded by background
+SPConstProto make_cell(std::string label, real_type half_width)
+{
+    UnitProto::Input inp;
+    inp.boundary.interior = std::make_shared<BoxShape>(
+        label + ":bound", Box{{half_width, half_width, half_width}});
+    inp.background.fill = GeoMaterialId{0};
+    inp.materials.push_back({std::make_shared<SphereShape>(
+                                 label + ":pin", Sphere{half_width / 2}),
+                             GeoMaterialId{1},
+                             Label{label + ":pin"}});
+    inp.label = std::move(label);
+    return std::make_shared<UnitProto>(std::move(inp));
+}
+
+class RectArrayProtoTest : public ::celeritas::test::Test
+{
+  protected:
+    Tolerance<> tol_ = Tolerance<>::from_relative(1e-5);
+};
+
+TEST_F(RectArrayProtoTest, errors)
+{
+    auto cell = make_cell("cell", 1.0);
+    auto make_input = [&cell] {
+        RectArrayProto::Input inp;
+        inp.grid = {{{0, 2, 4}, {0, 2}, {-1, 1}}};
+        inp.fills = {cell};
+        inp.label = "arr";
+        return inp;
+    };
+
+    // Valid with one or all fills
+    EXPECT_NO_THROW(RectArrayProto{make_input()});
+    {
+        auto inp = make_input();
+        inp.fills = {cell, cell};
+        EXPECT_NO_THROW(RectArrayProto{std::move(inp)});
+    }
+
+    // Wrong number of fills
+    {
+        auto inp = make_input();
+        inp.fills = {cell, cell, cell};
+        EXPECT_THROW(RectArrayProto{std::move(inp)}, RuntimeError);
+    }
+    // Non-monotonic grid
+    {
+        auto inp = make_input();
+        inp.grid[1] = {2, 0};
+        EXPECT_THROW(RectArrayProto{std::move(inp)}, RuntimeError);
+    }
+    // Missing grid
+    {
+        auto inp = make_input();
+        inp.grid[2] = {1};
+        EXPECT_THROW(RectArrayProto{std::move(inp)}, RuntimeError);
+    }
+}
+
+TEST_F(RectArrayProtoTest, lattice)
+{
+    auto cell = make_cell("cell", 1.0);
+    auto other = make_cell("other", 1.0);
+
+    auto arr = std::make_shared<RectArrayProto>([&] {
+        RectArrayProto::Input inp;
+        inp.grid = {{{-4, -2, 0, 2, 4}, {-2, 0, 2}, {-1, 1}}};
+        inp.fills.assign(8, cell);
+        inp.fills[5] = other;
+        inp.label = "arr";
+        return inp;
+    }());
+    EXPECT_EQ(8, arr->num_cells());
+    EXPECT_EQ("arr", arr->label());
+    EXPECT_EQ(2, arr->daughters().size());
+    EXPECT_EQ(R"json({"_type":"transformed","daughter":{"_type":"shape","interior":{"_type":"box","halfwidths":[4.0,2.0,1.0]},"label":"arr"},"transform":{"_type":"translation","data":[0.0,0.0,0.0]}})json",
+              to_string(*arr->interior()));
+
+    // Place the array inside a global box
+    UnitProto global{[&] {
+        UnitProto::Input inp;
+        inp.boundary.interior = std::make_shared<BoxShape>(
+            "world", Box{{10, 10, 10}});
+        inp.background.fill = GeoMaterialId{2};
+        inp.daughters.push_back({arr, Translation{{0, 0, 5}}});
+        inp.label = "global";
+        return inp;
+    }()};
+
+    OrangeInput result = InputBuilder{[&] {
+        InputBuilder::Options opts;
+        opts.tol = tol_;
+        return opts;
+    }()}(global);
+    ASSERT_EQ(4, result.universes.size());
+
+    auto const* ra = std::get_if<RectArrayInput>(&result.universes[1]);
+    ASSERT_TRUE(ra);
+    EXPECT_EQ("arr", ra->label.name);
+    EXPECT_VEC_SOFT_EQ((std::vector<double>{-4, -2, 0, 2, 4}), ra->grid[0]);
+    ASSERT_EQ(8, ra->daughters.size());
+    for (auto i : range(ra->daughters.size()))
+    {
+        EXPECT_EQ(i == 5 ? UniverseId{3} : UniverseId{2},
+                  ra->daughters[i].universe_id);
+    }
+    // Cell {2,1,0} is centered at (1, 1, 0)
+    auto const* t = std::get_if<Translation>(&ra->daughters[5].transform);
+    ASSERT_TRUE(t);
+    EXPECT_VEC_SOFT_EQ((Real3{1, 1, 0}), t->translation());
+
+    // Cell universe bounding box is expanded to cover the cell
+    auto const* cell_unit = std::get_if<UnitInput>(&result.universes[2]);
+    ASSERT_TRUE(cell_unit);
+    EXPECT_SOFT_NEAR(1.0, cell_unit->bbox.upper()[0], 1e-4);
+
+    // Construct runtime geometry
+    OrangeParams params{std::move(result)};
+    EXPECT_EQ(4, params.universes().size());
+    EXPECT_EQ(UniverseId{1}, params.universes().find_unique("arr"));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace orangeinp
+}  // namespace celeritas